@@ -58,7 +58,10 @@ namespace ProtoTypes
       ExecutionRequestType = 2,
             
       [ProtoEnum(Name=@"Connected", Value=3)]
-      Connected = 3
+      Connected = 3,
+            
+      [ProtoEnum(Name=@"WatchedLoginsRequestType", Value=4)]
+      WatchedLoginsRequestType = 4
     }
   
 }
\ No newline at end of file
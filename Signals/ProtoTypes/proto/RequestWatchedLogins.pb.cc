@@ -0,0 +1,312 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: RequestWatchedLogins.proto
+
+#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
+#include "RequestWatchedLogins.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/once.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+
+namespace ProtoTypes {
+
+namespace {
+
+const ::google::protobuf::Descriptor* WatchedLoginsRequest_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  WatchedLoginsRequest_reflection_ = NULL;
+
+}  // namespace
+
+
+void protobuf_AssignDesc_RequestWatchedLogins_2eproto() {
+  protobuf_AddDesc_RequestWatchedLogins_2eproto();
+  const ::google::protobuf::FileDescriptor* file =
+    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
+      "RequestWatchedLogins.proto");
+  GOOGLE_CHECK(file != NULL);
+  WatchedLoginsRequest_descriptor_ = file->message_type(0);
+  static const int WatchedLoginsRequest_offsets_[1] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(WatchedLoginsRequest, logins_),
+  };
+  WatchedLoginsRequest_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      WatchedLoginsRequest_descriptor_,
+      WatchedLoginsRequest::default_instance_,
+      WatchedLoginsRequest_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(WatchedLoginsRequest, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(WatchedLoginsRequest, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(WatchedLoginsRequest));
+}
+
+namespace {
+
+GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
+inline void protobuf_AssignDescriptorsOnce() {
+  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
+                 &protobuf_AssignDesc_RequestWatchedLogins_2eproto);
+}
+
+void protobuf_RegisterTypes(const ::std::string&) {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    WatchedLoginsRequest_descriptor_, &WatchedLoginsRequest::default_instance());
+}
+
+}  // namespace
+
+void protobuf_ShutdownFile_RequestWatchedLogins_2eproto() {
+  delete WatchedLoginsRequest::default_instance_;
+  delete WatchedLoginsRequest_reflection_;
+}
+
+void protobuf_AddDesc_RequestWatchedLogins_2eproto() {
+  static bool already_here = false;
+  if (already_here) return;
+  already_here = true;
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
+    "\n\032RequestWatchedLogins.proto\022\nProtoTypes"
+    "\"&\n\024WatchedLoginsRequest\022\016\n\006logins\030\001 \003(\005", 80);
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
+    "RequestWatchedLogins.proto", &protobuf_RegisterTypes);
+  WatchedLoginsRequest::default_instance_ = new WatchedLoginsRequest();
+  WatchedLoginsRequest::default_instance_->InitAsDefaultInstance();
+  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_RequestWatchedLogins_2eproto);
+}
+
+// Force AddDescriptors() to be called at static initialization time.
+struct StaticDescriptorInitializer_RequestWatchedLogins_2eproto {
+  StaticDescriptorInitializer_RequestWatchedLogins_2eproto() {
+    protobuf_AddDesc_RequestWatchedLogins_2eproto();
+  }
+} static_descriptor_initializer_RequestWatchedLogins_2eproto_;
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int WatchedLoginsRequest::kLoginsFieldNumber;
+#endif  // !_MSC_VER
+
+WatchedLoginsRequest::WatchedLoginsRequest()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void WatchedLoginsRequest::InitAsDefaultInstance() {
+}
+
+WatchedLoginsRequest::WatchedLoginsRequest(const WatchedLoginsRequest& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void WatchedLoginsRequest::SharedCtor() {
+  _cached_size_ = 0;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+WatchedLoginsRequest::~WatchedLoginsRequest() {
+  SharedDtor();
+}
+
+void WatchedLoginsRequest::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void WatchedLoginsRequest::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* WatchedLoginsRequest::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return WatchedLoginsRequest_descriptor_;
+}
+
+const WatchedLoginsRequest& WatchedLoginsRequest::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_RequestWatchedLogins_2eproto();
+  return *default_instance_;
+}
+
+WatchedLoginsRequest* WatchedLoginsRequest::default_instance_ = NULL;
+
+WatchedLoginsRequest* WatchedLoginsRequest::New() const {
+  return new WatchedLoginsRequest;
+}
+
+void WatchedLoginsRequest::Clear() {
+  logins_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool WatchedLoginsRequest::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // repeated int32 logins = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_logins:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 1, 8, input, this->mutable_logins())));
+        } else if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag)
+                   == ::google::protobuf::internal::WireFormatLite::
+                      WIRETYPE_LENGTH_DELIMITED) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitiveNoInline<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, this->mutable_logins())));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(8)) goto parse_logins;
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void WatchedLoginsRequest::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // repeated int32 logins = 1;
+  for (int i = 0; i < this->logins_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(
+      1, this->logins(i), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* WatchedLoginsRequest::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // repeated int32 logins = 1;
+  for (int i = 0; i < this->logins_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteInt32ToArray(1, this->logins(i), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int WatchedLoginsRequest::ByteSize() const {
+  int total_size = 0;
+
+  // repeated int32 logins = 1;
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->logins_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        Int32Size(this->logins(i));
+    }
+    total_size += 1 * this->logins_size() + data_size;
+  }
+
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void WatchedLoginsRequest::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const WatchedLoginsRequest* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const WatchedLoginsRequest*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void WatchedLoginsRequest::MergeFrom(const WatchedLoginsRequest& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  logins_.MergeFrom(from.logins_);
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void WatchedLoginsRequest::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void WatchedLoginsRequest::CopyFrom(const WatchedLoginsRequest& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WatchedLoginsRequest::IsInitialized() const {
+
+  return true;
+}
+
+void WatchedLoginsRequest::Swap(WatchedLoginsRequest* other) {
+  if (other != this) {
+    logins_.Swap(&other->logins_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata WatchedLoginsRequest::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = WatchedLoginsRequest_descriptor_;
+  metadata.reflection = WatchedLoginsRequest_reflection_;
+  return metadata;
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ProtoTypes
+
+// @@protoc_insertion_point(global_scope)
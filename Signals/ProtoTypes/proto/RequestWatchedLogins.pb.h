@@ -0,0 +1,171 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: RequestWatchedLogins.proto
+
+#ifndef PROTOBUF_RequestWatchedLogins_2eproto__INCLUDED
+#define PROTOBUF_RequestWatchedLogins_2eproto__INCLUDED
+
+#include <string>
+
+#include <google/protobuf/stubs/common.h>
+
+#if GOOGLE_PROTOBUF_VERSION < 2005000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please update
+#error your headers.
+#endif
+#if 2005000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+
+namespace ProtoTypes {
+
+// Internal implementation detail -- do not call these.
+void  protobuf_AddDesc_RequestWatchedLogins_2eproto();
+void protobuf_AssignDesc_RequestWatchedLogins_2eproto();
+void protobuf_ShutdownFile_RequestWatchedLogins_2eproto();
+
+class WatchedLoginsRequest;
+
+// ===================================================================
+
+class WatchedLoginsRequest : public ::google::protobuf::Message {
+ public:
+  WatchedLoginsRequest();
+  virtual ~WatchedLoginsRequest();
+
+  WatchedLoginsRequest(const WatchedLoginsRequest& from);
+
+  inline WatchedLoginsRequest& operator=(const WatchedLoginsRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const WatchedLoginsRequest& default_instance();
+
+  void Swap(WatchedLoginsRequest* other);
+
+  // implements Message ----------------------------------------------
+
+  WatchedLoginsRequest* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const WatchedLoginsRequest& from);
+  void MergeFrom(const WatchedLoginsRequest& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated int32 logins = 1;
+  inline int logins_size() const;
+  inline void clear_logins();
+  static const int kLoginsFieldNumber = 1;
+  inline ::google::protobuf::int32 logins(int index) const;
+  inline void set_logins(int index, ::google::protobuf::int32 value);
+  inline void add_logins(::google::protobuf::int32 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+      logins() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+      mutable_logins();
+
+  // @@protoc_insertion_point(class_scope:ProtoTypes.WatchedLoginsRequest)
+ private:
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > logins_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
+
+  friend void  protobuf_AddDesc_RequestWatchedLogins_2eproto();
+  friend void protobuf_AssignDesc_RequestWatchedLogins_2eproto();
+  friend void protobuf_ShutdownFile_RequestWatchedLogins_2eproto();
+
+  void InitAsDefaultInstance();
+  static WatchedLoginsRequest* default_instance_;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+// WatchedLoginsRequest
+
+// repeated int32 logins = 1;
+inline int WatchedLoginsRequest::logins_size() const {
+  return logins_.size();
+}
+inline void WatchedLoginsRequest::clear_logins() {
+  logins_.Clear();
+}
+inline ::google::protobuf::int32 WatchedLoginsRequest::logins(int index) const {
+  return logins_.Get(index);
+}
+inline void WatchedLoginsRequest::set_logins(int index, ::google::protobuf::int32 value) {
+  logins_.Set(index, value);
+}
+inline void WatchedLoginsRequest::add_logins(::google::protobuf::int32 value) {
+  logins_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+WatchedLoginsRequest::logins() const {
+  return logins_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+WatchedLoginsRequest::mutable_logins() {
+  return &logins_;
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ProtoTypes
+
+#ifndef SWIG
+namespace google {
+namespace protobuf {
+
+
+}  // namespace google
+}  // namespace protobuf
+#endif  // SWIG
+
+// @@protoc_insertion_point(global_scope)
+
+#endif  // PROTOBUF_RequestWatchedLogins_2eproto__INCLUDED
@@ -50,6 +50,14 @@ namespace ProtoTypes
       get { return _Description; }
       set { _Description = value; }
     }
+    private ulong _SequenceId = default(ulong);
+    [ProtoMember(5, IsRequired = false, Name=@"SequenceId", DataFormat = DataFormat.TwosComplement)]
+    [DefaultValue(default(ulong))]
+    public ulong SequenceId
+    {
+      get { return _SequenceId; }
+      set { _SequenceId = value; }
+    }
     private IExtension extensionObject;
     IExtension IExtensible.GetExtensionObject(bool createIfMissing)
       { return Extensible.GetExtensionObject(ref extensionObject, createIfMissing); }
@@ -66,7 +74,10 @@ namespace ProtoTypes
       ConnectSignal = 1,
             
       [ProtoEnum(Name=@"SignalOrdersStatus", Value=2)]
-      SignalOrdersStatus = 2
+      SignalOrdersStatus = 2,
+            
+      [ProtoEnum(Name=@"ExecutionReport", Value=3)]
+      ExecutionReport = 3
     }
   
 }
\ No newline at end of file
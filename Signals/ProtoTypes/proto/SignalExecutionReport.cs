@@ -0,0 +1,172 @@
+//------------------------------------------------------------------------------
+// <auto-generated>
+//     This code was generated by a tool.
+//
+//     Changes to this file may cause incorrect behavior and will be lost if
+//     the code is regenerated.
+// </auto-generated>
+//------------------------------------------------------------------------------
+
+// Generated from: SignalExecutionReport.proto
+// Note: requires additional types generated from: SignalMT4Trade.proto
+
+using System;
+using System.Collections.Generic;
+using System.ComponentModel;
+using ProtoBuf;
+
+namespace ProtoTypes
+{
+  [Serializable, ProtoContract(Name=@"ExecutionOrderReport")]
+  public partial class ExecutionOrderReport : IExtensible
+  {
+    public ExecutionOrderReport() {}
+    
+    private int _Login;
+    [ProtoMember(1, IsRequired = true, Name=@"Login", DataFormat = DataFormat.TwosComplement)]
+    public int Login
+    {
+      get { return _Login; }
+      set { _Login = value; }
+    }
+    private ActionType _ActionType;
+    [ProtoMember(2, IsRequired = true, Name=@"ActionType", DataFormat = DataFormat.TwosComplement)]
+    public ActionType ActionType
+    {
+      get { return _ActionType; }
+      set { _ActionType = value; }
+    }
+    private int _OrderID = default(int);
+    [ProtoMember(3, IsRequired = false, Name=@"OrderID", DataFormat = DataFormat.TwosComplement)]
+    [DefaultValue(default(int))]
+    public int OrderID
+    {
+      get { return _OrderID; }
+      set { _OrderID = value; }
+    }
+    private ExecutionResult _Result;
+    [ProtoMember(4, IsRequired = true, Name=@"Result", DataFormat = DataFormat.TwosComplement)]
+    public ExecutionResult Result
+    {
+      get { return _Result; }
+      set { _Result = value; }
+    }
+    private int _Ticket = default(int);
+    [ProtoMember(5, IsRequired = false, Name=@"Ticket", DataFormat = DataFormat.TwosComplement)]
+    [DefaultValue(default(int))]
+    public int Ticket
+    {
+      get { return _Ticket; }
+      set { _Ticket = value; }
+    }
+    private double _Price = (double)0;
+    [ProtoMember(6, IsRequired = false, Name=@"Price", DataFormat = DataFormat.TwosComplement)]
+    [DefaultValue((double)0)]
+    public double Price
+    {
+      get { return _Price; }
+      set { _Price = value; }
+    }
+    private int _RequestId = default(int);
+    [ProtoMember(7, IsRequired = false, Name=@"RequestId", DataFormat = DataFormat.TwosComplement)]
+    [DefaultValue(default(int))]
+    public int RequestId
+    {
+      get { return _RequestId; }
+      set { _RequestId = value; }
+    }
+    private long _QueueTime = default(long);
+    [ProtoMember(8, IsRequired = false, Name=@"QueueTime", DataFormat = DataFormat.TwosComplement)]
+    [DefaultValue(default(long))]
+    public long QueueTime
+    {
+      get { return _QueueTime; }
+      set { _QueueTime = value; }
+    }
+    private long _CheckTime = default(long);
+    [ProtoMember(9, IsRequired = false, Name=@"CheckTime", DataFormat = DataFormat.TwosComplement)]
+    [DefaultValue(default(long))]
+    public long CheckTime
+    {
+      get { return _CheckTime; }
+      set { _CheckTime = value; }
+    }
+    private long _ExecuteTime = default(long);
+    [ProtoMember(10, IsRequired = false, Name=@"ExecuteTime", DataFormat = DataFormat.TwosComplement)]
+    [DefaultValue(default(long))]
+    public long ExecuteTime
+    {
+      get { return _ExecuteTime; }
+      set { _ExecuteTime = value; }
+    }
+    private IExtension extensionObject;
+    IExtension IExtensible.GetExtensionObject(bool createIfMissing)
+      { return Extensible.GetExtensionObject(ref extensionObject, createIfMissing); }
+  }
+  
+  [Serializable, ProtoContract(Name=@"ExecutionSignalReport")]
+  public partial class ExecutionSignalReport : IExtensible
+  {
+    public ExecutionSignalReport() {}
+    
+    private string _Comment;
+    [ProtoMember(1, IsRequired = true, Name=@"Comment", DataFormat = DataFormat.Default)]
+    public string Comment
+    {
+      get { return _Comment; }
+      set { _Comment = value; }
+    }
+    private readonly List<ExecutionOrderReport> _Orders = new List<ExecutionOrderReport>();
+    [ProtoMember(2, Name=@"Orders", DataFormat = DataFormat.Default)]
+    public List<ExecutionOrderReport> Orders
+    {
+      get { return _Orders; }
+    }
+  
+    private IExtension extensionObject;
+    IExtension IExtensible.GetExtensionObject(bool createIfMissing)
+      { return Extensible.GetExtensionObject(ref extensionObject, createIfMissing); }
+  }
+  
+    [ProtoContract(Name=@"ExecutionResult")]
+    public enum ExecutionResult
+    {
+            
+      [ProtoEnum(Name=@"ResultUnknown", Value=0)]
+      ResultUnknown = 0,
+            
+      [ProtoEnum(Name=@"ResultExecuted", Value=1)]
+      ResultExecuted = 1,
+            
+      [ProtoEnum(Name=@"ResultRequestAdded", Value=2)]
+      ResultRequestAdded = 2,
+            
+      [ProtoEnum(Name=@"ResultDuplicate", Value=3)]
+      ResultDuplicate = 3,
+            
+      [ProtoEnum(Name=@"ResultInvalidOrder", Value=4)]
+      ResultInvalidOrder = 4,
+            
+      [ProtoEnum(Name=@"ResultInvalidVolume", Value=5)]
+      ResultInvalidVolume = 5,
+            
+      [ProtoEnum(Name=@"ResultInvalidSymbol", Value=6)]
+      ResultInvalidSymbol = 6,
+            
+      [ProtoEnum(Name=@"ResultInvalidPrice", Value=7)]
+      ResultInvalidPrice = 7,
+            
+      [ProtoEnum(Name=@"ResultInvalidStops", Value=8)]
+      ResultInvalidStops = 8,
+            
+      [ProtoEnum(Name=@"ResultNoMoney", Value=9)]
+      ResultNoMoney = 9,
+            
+      [ProtoEnum(Name=@"ResultRejected", Value=10)]
+      ResultRejected = 10,
+            
+      [ProtoEnum(Name=@"ResultServerError", Value=11)]
+      ResultServerError = 11
+    }
+  
+}
\ No newline at end of file
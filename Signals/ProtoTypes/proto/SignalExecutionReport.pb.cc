@@ -0,0 +1,1032 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: SignalExecutionReport.proto
+
+#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
+#include "SignalExecutionReport.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/once.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+
+namespace ProtoTypes {
+
+namespace {
+
+const ::google::protobuf::Descriptor* ExecutionOrderReport_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  ExecutionOrderReport_reflection_ = NULL;
+const ::google::protobuf::Descriptor* ExecutionSignalReport_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  ExecutionSignalReport_reflection_ = NULL;
+const ::google::protobuf::EnumDescriptor* ExecutionResult_descriptor_ = NULL;
+
+}  // namespace
+
+
+void protobuf_AssignDesc_SignalExecutionReport_2eproto() {
+  protobuf_AddDesc_SignalExecutionReport_2eproto();
+  const ::google::protobuf::FileDescriptor* file =
+    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
+      "SignalExecutionReport.proto");
+  GOOGLE_CHECK(file != NULL);
+  ExecutionOrderReport_descriptor_ = file->message_type(0);
+  static const int ExecutionOrderReport_offsets_[10] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ExecutionOrderReport, login_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ExecutionOrderReport, actiontype_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ExecutionOrderReport, orderid_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ExecutionOrderReport, result_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ExecutionOrderReport, ticket_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ExecutionOrderReport, price_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ExecutionOrderReport, requestid_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ExecutionOrderReport, queuetime_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ExecutionOrderReport, checktime_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ExecutionOrderReport, executetime_),
+  };
+  ExecutionOrderReport_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      ExecutionOrderReport_descriptor_,
+      ExecutionOrderReport::default_instance_,
+      ExecutionOrderReport_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ExecutionOrderReport, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ExecutionOrderReport, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(ExecutionOrderReport));
+  ExecutionSignalReport_descriptor_ = file->message_type(1);
+  static const int ExecutionSignalReport_offsets_[2] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ExecutionSignalReport, comment_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ExecutionSignalReport, orders_),
+  };
+  ExecutionSignalReport_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      ExecutionSignalReport_descriptor_,
+      ExecutionSignalReport::default_instance_,
+      ExecutionSignalReport_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ExecutionSignalReport, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(ExecutionSignalReport, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(ExecutionSignalReport));
+  ExecutionResult_descriptor_ = file->enum_type(0);
+}
+
+namespace {
+
+GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
+inline void protobuf_AssignDescriptorsOnce() {
+  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
+                 &protobuf_AssignDesc_SignalExecutionReport_2eproto);
+}
+
+void protobuf_RegisterTypes(const ::std::string&) {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    ExecutionOrderReport_descriptor_, &ExecutionOrderReport::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    ExecutionSignalReport_descriptor_, &ExecutionSignalReport::default_instance());
+}
+
+}  // namespace
+
+void protobuf_ShutdownFile_SignalExecutionReport_2eproto() {
+  delete ExecutionOrderReport::default_instance_;
+  delete ExecutionOrderReport_reflection_;
+  delete ExecutionSignalReport::default_instance_;
+  delete ExecutionSignalReport_reflection_;
+}
+
+void protobuf_AddDesc_SignalExecutionReport_2eproto() {
+  static bool already_here = false;
+  if (already_here) return;
+  already_here = true;
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  ::ProtoTypes::protobuf_AddDesc_SignalMT4Trade_2eproto();
+  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
+    "\n\033SignalExecutionReport.proto\022\nProtoType"
+    "s\032\024SignalMT4Trade.proto\"\377\001\n\024ExecutionOrd"
+    "erReport\022\r\n\005Login\030\001 \002(\005\022*\n\nActionType\030\002 "
+    "\002(\0162\026.ProtoTypes.ActionType\022\017\n\007OrderID\030\003"
+    " \001(\005\022+\n\006Result\030\004 \002(\0162\033.ProtoTypes.Execut"
+    "ionResult\022\016\n\006Ticket\030\005 \001(\005\022\020\n\005Price\030\006 \001(\001"
+    ":\0010\022\021\n\tRequestId\030\007 \001(\005\022\021\n\tQueueTime\030\010 \001("
+    "\003\022\021\n\tCheckTime\030\t \001(\003\022\023\n\013ExecuteTime\030\n \001("
+    "\003\"Z\n\025ExecutionSignalReport\022\017\n\007Comment\030\001 "
+    "\002(\t\0220\n\006Orders\030\002 \003(\0132 .ProtoTypes.Executi"
+    "onOrderReport*\235\002\n\017ExecutionResult\022\021\n\rRes"
+    "ultUnknown\020\000\022\022\n\016ResultExecuted\020\001\022\026\n\022Resu"
+    "ltRequestAdded\020\002\022\023\n\017ResultDuplicate\020\003\022\026\n"
+    "\022ResultInvalidOrder\020\004\022\027\n\023ResultInvalidVo"
+    "lume\020\005\022\027\n\023ResultInvalidSymbol\020\006\022\026\n\022Resul"
+    "tInvalidPrice\020\007\022\026\n\022ResultInvalidStops\020\010\022"
+    "\021\n\rResultNoMoney\020\t\022\022\n\016ResultRejected\020\n\022\025"
+    "\n\021ResultServerError\020\013", 701);
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
+    "SignalExecutionReport.proto", &protobuf_RegisterTypes);
+  ExecutionOrderReport::default_instance_ = new ExecutionOrderReport();
+  ExecutionSignalReport::default_instance_ = new ExecutionSignalReport();
+  ExecutionOrderReport::default_instance_->InitAsDefaultInstance();
+  ExecutionSignalReport::default_instance_->InitAsDefaultInstance();
+  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_SignalExecutionReport_2eproto);
+}
+
+// Force AddDescriptors() to be called at static initialization time.
+struct StaticDescriptorInitializer_SignalExecutionReport_2eproto {
+  StaticDescriptorInitializer_SignalExecutionReport_2eproto() {
+    protobuf_AddDesc_SignalExecutionReport_2eproto();
+  }
+} static_descriptor_initializer_SignalExecutionReport_2eproto_;
+const ::google::protobuf::EnumDescriptor* ExecutionResult_descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return ExecutionResult_descriptor_;
+}
+bool ExecutionResult_IsValid(int value) {
+  switch(value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int ExecutionOrderReport::kLoginFieldNumber;
+const int ExecutionOrderReport::kActionTypeFieldNumber;
+const int ExecutionOrderReport::kOrderIDFieldNumber;
+const int ExecutionOrderReport::kResultFieldNumber;
+const int ExecutionOrderReport::kTicketFieldNumber;
+const int ExecutionOrderReport::kPriceFieldNumber;
+const int ExecutionOrderReport::kRequestIdFieldNumber;
+const int ExecutionOrderReport::kQueueTimeFieldNumber;
+const int ExecutionOrderReport::kCheckTimeFieldNumber;
+const int ExecutionOrderReport::kExecuteTimeFieldNumber;
+#endif  // !_MSC_VER
+
+ExecutionOrderReport::ExecutionOrderReport()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void ExecutionOrderReport::InitAsDefaultInstance() {
+}
+
+ExecutionOrderReport::ExecutionOrderReport(const ExecutionOrderReport& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void ExecutionOrderReport::SharedCtor() {
+  _cached_size_ = 0;
+  login_ = 0;
+  actiontype_ = 0;
+  orderid_ = 0;
+  result_ = 0;
+  ticket_ = 0;
+  price_ = 0;
+  requestid_ = 0;
+  queuetime_ = GOOGLE_LONGLONG(0);
+  checktime_ = GOOGLE_LONGLONG(0);
+  executetime_ = GOOGLE_LONGLONG(0);
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+ExecutionOrderReport::~ExecutionOrderReport() {
+  SharedDtor();
+}
+
+void ExecutionOrderReport::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void ExecutionOrderReport::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* ExecutionOrderReport::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return ExecutionOrderReport_descriptor_;
+}
+
+const ExecutionOrderReport& ExecutionOrderReport::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_SignalExecutionReport_2eproto();
+  return *default_instance_;
+}
+
+ExecutionOrderReport* ExecutionOrderReport::default_instance_ = NULL;
+
+ExecutionOrderReport* ExecutionOrderReport::New() const {
+  return new ExecutionOrderReport;
+}
+
+void ExecutionOrderReport::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    login_ = 0;
+    actiontype_ = 0;
+    orderid_ = 0;
+    result_ = 0;
+    ticket_ = 0;
+    price_ = 0;
+    requestid_ = 0;
+    queuetime_ = GOOGLE_LONGLONG(0);
+  }
+  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    checktime_ = GOOGLE_LONGLONG(0);
+    executetime_ = GOOGLE_LONGLONG(0);
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool ExecutionOrderReport::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required int32 Login = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &login_)));
+          set_has_login();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(16)) goto parse_ActionType;
+        break;
+      }
+
+      // required .ProtoTypes.ActionType ActionType = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_ActionType:
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::ProtoTypes::ActionType_IsValid(value)) {
+            set_actiontype(static_cast< ::ProtoTypes::ActionType >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(2, value);
+          }
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(24)) goto parse_OrderID;
+        break;
+      }
+
+      // optional int32 OrderID = 3;
+      case 3: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_OrderID:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &orderid_)));
+          set_has_orderid();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(32)) goto parse_Result;
+        break;
+      }
+
+      // required .ProtoTypes.ExecutionResult Result = 4;
+      case 4: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_Result:
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::ProtoTypes::ExecutionResult_IsValid(value)) {
+            set_result(static_cast< ::ProtoTypes::ExecutionResult >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(4, value);
+          }
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(40)) goto parse_Ticket;
+        break;
+      }
+
+      // optional int32 Ticket = 5;
+      case 5: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_Ticket:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &ticket_)));
+          set_has_ticket();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(49)) goto parse_Price;
+        break;
+      }
+
+      // optional double Price = 6 [default = 0];
+      case 6: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED64) {
+         parse_Price:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, &price_)));
+          set_has_price();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(56)) goto parse_RequestId;
+        break;
+      }
+
+      // optional int32 RequestId = 7;
+      case 7: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_RequestId:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &requestid_)));
+          set_has_requestid();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(64)) goto parse_QueueTime;
+        break;
+      }
+
+      // optional int64 QueueTime = 8;
+      case 8: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_QueueTime:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &queuetime_)));
+          set_has_queuetime();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(72)) goto parse_CheckTime;
+        break;
+      }
+
+      // optional int64 CheckTime = 9;
+      case 9: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_CheckTime:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &checktime_)));
+          set_has_checktime();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(80)) goto parse_ExecuteTime;
+        break;
+      }
+
+      // optional int64 ExecuteTime = 10;
+      case 10: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_ExecuteTime:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &executetime_)));
+          set_has_executetime();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void ExecutionOrderReport::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required int32 Login = 1;
+  if (has_login()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->login(), output);
+  }
+
+  // required .ProtoTypes.ActionType ActionType = 2;
+  if (has_actiontype()) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      2, this->actiontype(), output);
+  }
+
+  // optional int32 OrderID = 3;
+  if (has_orderid()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->orderid(), output);
+  }
+
+  // required .ProtoTypes.ExecutionResult Result = 4;
+  if (has_result()) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      4, this->result(), output);
+  }
+
+  // optional int32 Ticket = 5;
+  if (has_ticket()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(5, this->ticket(), output);
+  }
+
+  // optional double Price = 6 [default = 0];
+  if (has_price()) {
+    ::google::protobuf::internal::WireFormatLite::WriteDouble(6, this->price(), output);
+  }
+
+  // optional int32 RequestId = 7;
+  if (has_requestid()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(7, this->requestid(), output);
+  }
+
+  // optional int64 QueueTime = 8;
+  if (has_queuetime()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(8, this->queuetime(), output);
+  }
+
+  // optional int64 CheckTime = 9;
+  if (has_checktime()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(9, this->checktime(), output);
+  }
+
+  // optional int64 ExecuteTime = 10;
+  if (has_executetime()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(10, this->executetime(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* ExecutionOrderReport::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // required int32 Login = 1;
+  if (has_login()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->login(), target);
+  }
+
+  // required .ProtoTypes.ActionType ActionType = 2;
+  if (has_actiontype()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      2, this->actiontype(), target);
+  }
+
+  // optional int32 OrderID = 3;
+  if (has_orderid()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->orderid(), target);
+  }
+
+  // required .ProtoTypes.ExecutionResult Result = 4;
+  if (has_result()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      4, this->result(), target);
+  }
+
+  // optional int32 Ticket = 5;
+  if (has_ticket()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(5, this->ticket(), target);
+  }
+
+  // optional double Price = 6 [default = 0];
+  if (has_price()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteDoubleToArray(6, this->price(), target);
+  }
+
+  // optional int32 RequestId = 7;
+  if (has_requestid()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(7, this->requestid(), target);
+  }
+
+  // optional int64 QueueTime = 8;
+  if (has_queuetime()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(8, this->queuetime(), target);
+  }
+
+  // optional int64 CheckTime = 9;
+  if (has_checktime()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(9, this->checktime(), target);
+  }
+
+  // optional int64 ExecuteTime = 10;
+  if (has_executetime()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(10, this->executetime(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int ExecutionOrderReport::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required int32 Login = 1;
+    if (has_login()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->login());
+    }
+
+    // required .ProtoTypes.ActionType ActionType = 2;
+    if (has_actiontype()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->actiontype());
+    }
+
+    // optional int32 OrderID = 3;
+    if (has_orderid()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->orderid());
+    }
+
+    // required .ProtoTypes.ExecutionResult Result = 4;
+    if (has_result()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->result());
+    }
+
+    // optional int32 Ticket = 5;
+    if (has_ticket()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->ticket());
+    }
+
+    // optional double Price = 6 [default = 0];
+    if (has_price()) {
+      total_size += 1 + 8;
+    }
+
+    // optional int32 RequestId = 7;
+    if (has_requestid()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->requestid());
+    }
+
+    // optional int64 QueueTime = 8;
+    if (has_queuetime()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int64Size(
+          this->queuetime());
+    }
+
+  }
+  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    // optional int64 CheckTime = 9;
+    if (has_checktime()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int64Size(
+          this->checktime());
+    }
+
+    // optional int64 ExecuteTime = 10;
+    if (has_executetime()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int64Size(
+          this->executetime());
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void ExecutionOrderReport::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const ExecutionOrderReport* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const ExecutionOrderReport*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void ExecutionOrderReport::MergeFrom(const ExecutionOrderReport& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_login()) {
+      set_login(from.login());
+    }
+    if (from.has_actiontype()) {
+      set_actiontype(from.actiontype());
+    }
+    if (from.has_orderid()) {
+      set_orderid(from.orderid());
+    }
+    if (from.has_result()) {
+      set_result(from.result());
+    }
+    if (from.has_ticket()) {
+      set_ticket(from.ticket());
+    }
+    if (from.has_price()) {
+      set_price(from.price());
+    }
+    if (from.has_requestid()) {
+      set_requestid(from.requestid());
+    }
+    if (from.has_queuetime()) {
+      set_queuetime(from.queuetime());
+    }
+  }
+  if (from._has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    if (from.has_checktime()) {
+      set_checktime(from.checktime());
+    }
+    if (from.has_executetime()) {
+      set_executetime(from.executetime());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void ExecutionOrderReport::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void ExecutionOrderReport::CopyFrom(const ExecutionOrderReport& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ExecutionOrderReport::IsInitialized() const {
+  if ((_has_bits_[0] & 0x0000000b) != 0x0000000b) return false;
+
+  return true;
+}
+
+void ExecutionOrderReport::Swap(ExecutionOrderReport* other) {
+  if (other != this) {
+    std::swap(login_, other->login_);
+    std::swap(actiontype_, other->actiontype_);
+    std::swap(orderid_, other->orderid_);
+    std::swap(result_, other->result_);
+    std::swap(ticket_, other->ticket_);
+    std::swap(price_, other->price_);
+    std::swap(requestid_, other->requestid_);
+    std::swap(queuetime_, other->queuetime_);
+    std::swap(checktime_, other->checktime_);
+    std::swap(executetime_, other->executetime_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata ExecutionOrderReport::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = ExecutionOrderReport_descriptor_;
+  metadata.reflection = ExecutionOrderReport_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int ExecutionSignalReport::kCommentFieldNumber;
+const int ExecutionSignalReport::kOrdersFieldNumber;
+#endif  // !_MSC_VER
+
+ExecutionSignalReport::ExecutionSignalReport()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+}
+
+void ExecutionSignalReport::InitAsDefaultInstance() {
+}
+
+ExecutionSignalReport::ExecutionSignalReport(const ExecutionSignalReport& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void ExecutionSignalReport::SharedCtor() {
+  _cached_size_ = 0;
+  comment_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+ExecutionSignalReport::~ExecutionSignalReport() {
+  SharedDtor();
+}
+
+void ExecutionSignalReport::SharedDtor() {
+  if (comment_ != &::google::protobuf::internal::kEmptyString) {
+    delete comment_;
+  }
+  if (this != default_instance_) {
+  }
+}
+
+void ExecutionSignalReport::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* ExecutionSignalReport::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return ExecutionSignalReport_descriptor_;
+}
+
+const ExecutionSignalReport& ExecutionSignalReport::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_SignalExecutionReport_2eproto();
+  return *default_instance_;
+}
+
+ExecutionSignalReport* ExecutionSignalReport::default_instance_ = NULL;
+
+ExecutionSignalReport* ExecutionSignalReport::New() const {
+  return new ExecutionSignalReport;
+}
+
+void ExecutionSignalReport::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (has_comment()) {
+      if (comment_ != &::google::protobuf::internal::kEmptyString) {
+        comment_->clear();
+      }
+    }
+  }
+  orders_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool ExecutionSignalReport::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required string Comment = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_comment()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+            this->comment().data(), this->comment().length(),
+            ::google::protobuf::internal::WireFormat::PARSE);
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(18)) goto parse_Orders;
+        break;
+      }
+
+      // repeated .ProtoTypes.ExecutionOrderReport Orders = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_Orders:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_orders()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(18)) goto parse_Orders;
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void ExecutionSignalReport::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required string Comment = 1;
+  if (has_comment()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->comment().data(), this->comment().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      1, this->comment(), output);
+  }
+
+  // repeated .ProtoTypes.ExecutionOrderReport Orders = 2;
+  for (int i = 0; i < this->orders_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, this->orders(i), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+}
+
+::google::protobuf::uint8* ExecutionSignalReport::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // required string Comment = 1;
+  if (has_comment()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
+      this->comment().data(), this->comment().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE);
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->comment(), target);
+  }
+
+  // repeated .ProtoTypes.ExecutionOrderReport Orders = 2;
+  for (int i = 0; i < this->orders_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        2, this->orders(i), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  return target;
+}
+
+int ExecutionSignalReport::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required string Comment = 1;
+    if (has_comment()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->comment());
+    }
+
+  }
+  // repeated .ProtoTypes.ExecutionOrderReport Orders = 2;
+  total_size += 1 * this->orders_size();
+  for (int i = 0; i < this->orders_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->orders(i));
+  }
+
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void ExecutionSignalReport::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const ExecutionSignalReport* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const ExecutionSignalReport*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void ExecutionSignalReport::MergeFrom(const ExecutionSignalReport& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  orders_.MergeFrom(from.orders_);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_comment()) {
+      set_comment(from.comment());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void ExecutionSignalReport::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void ExecutionSignalReport::CopyFrom(const ExecutionSignalReport& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ExecutionSignalReport::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
+
+  for (int i = 0; i < orders_size(); i++) {
+    if (!this->orders(i).IsInitialized()) return false;
+  }
+  return true;
+}
+
+void ExecutionSignalReport::Swap(ExecutionSignalReport* other) {
+  if (other != this) {
+    std::swap(comment_, other->comment_);
+    orders_.Swap(&other->orders_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata ExecutionSignalReport::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = ExecutionSignalReport_descriptor_;
+  metadata.reflection = ExecutionSignalReport_reflection_;
+  return metadata;
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ProtoTypes
+
+// @@protoc_insertion_point(global_scope)
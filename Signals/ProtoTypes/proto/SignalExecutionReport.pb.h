@@ -0,0 +1,690 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: SignalExecutionReport.proto
+
+#ifndef PROTOBUF_SignalExecutionReport_2eproto__INCLUDED
+#define PROTOBUF_SignalExecutionReport_2eproto__INCLUDED
+
+#include <string>
+
+#include <google/protobuf/stubs/common.h>
+
+#if GOOGLE_PROTOBUF_VERSION < 2005000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please update
+#error your headers.
+#endif
+#if 2005000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "SignalMT4Trade.pb.h"
+// @@protoc_insertion_point(includes)
+
+namespace ProtoTypes {
+
+// Internal implementation detail -- do not call these.
+void  protobuf_AddDesc_SignalExecutionReport_2eproto();
+void protobuf_AssignDesc_SignalExecutionReport_2eproto();
+void protobuf_ShutdownFile_SignalExecutionReport_2eproto();
+
+class ExecutionOrderReport;
+class ExecutionSignalReport;
+
+enum ExecutionResult {
+  ResultUnknown = 0,
+  ResultExecuted = 1,
+  ResultRequestAdded = 2,
+  ResultDuplicate = 3,
+  ResultInvalidOrder = 4,
+  ResultInvalidVolume = 5,
+  ResultInvalidSymbol = 6,
+  ResultInvalidPrice = 7,
+  ResultInvalidStops = 8,
+  ResultNoMoney = 9,
+  ResultRejected = 10,
+  ResultServerError = 11
+};
+bool ExecutionResult_IsValid(int value);
+const ExecutionResult ExecutionResult_MIN = ResultUnknown;
+const ExecutionResult ExecutionResult_MAX = ResultServerError;
+const int ExecutionResult_ARRAYSIZE = ExecutionResult_MAX + 1;
+
+const ::google::protobuf::EnumDescriptor* ExecutionResult_descriptor();
+inline const ::std::string& ExecutionResult_Name(ExecutionResult value) {
+  return ::google::protobuf::internal::NameOfEnum(
+    ExecutionResult_descriptor(), value);
+}
+inline bool ExecutionResult_Parse(
+    const ::std::string& name, ExecutionResult* value) {
+  return ::google::protobuf::internal::ParseNamedEnum<ExecutionResult>(
+    ExecutionResult_descriptor(), name, value);
+}
+// ===================================================================
+
+class ExecutionOrderReport : public ::google::protobuf::Message {
+ public:
+  ExecutionOrderReport();
+  virtual ~ExecutionOrderReport();
+
+  ExecutionOrderReport(const ExecutionOrderReport& from);
+
+  inline ExecutionOrderReport& operator=(const ExecutionOrderReport& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const ExecutionOrderReport& default_instance();
+
+  void Swap(ExecutionOrderReport* other);
+
+  // implements Message ----------------------------------------------
+
+  ExecutionOrderReport* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const ExecutionOrderReport& from);
+  void MergeFrom(const ExecutionOrderReport& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required int32 Login = 1;
+  inline bool has_login() const;
+  inline void clear_login();
+  static const int kLoginFieldNumber = 1;
+  inline ::google::protobuf::int32 login() const;
+  inline void set_login(::google::protobuf::int32 value);
+
+  // required .ProtoTypes.ActionType ActionType = 2;
+  inline bool has_actiontype() const;
+  inline void clear_actiontype();
+  static const int kActionTypeFieldNumber = 2;
+  inline ::ProtoTypes::ActionType actiontype() const;
+  inline void set_actiontype(::ProtoTypes::ActionType value);
+
+  // optional int32 OrderID = 3;
+  inline bool has_orderid() const;
+  inline void clear_orderid();
+  static const int kOrderIDFieldNumber = 3;
+  inline ::google::protobuf::int32 orderid() const;
+  inline void set_orderid(::google::protobuf::int32 value);
+
+  // required .ProtoTypes.ExecutionResult Result = 4;
+  inline bool has_result() const;
+  inline void clear_result();
+  static const int kResultFieldNumber = 4;
+  inline ::ProtoTypes::ExecutionResult result() const;
+  inline void set_result(::ProtoTypes::ExecutionResult value);
+
+  // optional int32 Ticket = 5;
+  inline bool has_ticket() const;
+  inline void clear_ticket();
+  static const int kTicketFieldNumber = 5;
+  inline ::google::protobuf::int32 ticket() const;
+  inline void set_ticket(::google::protobuf::int32 value);
+
+  // optional double Price = 6 [default = 0];
+  inline bool has_price() const;
+  inline void clear_price();
+  static const int kPriceFieldNumber = 6;
+  inline double price() const;
+  inline void set_price(double value);
+
+  // optional int32 RequestId = 7;
+  inline bool has_requestid() const;
+  inline void clear_requestid();
+  static const int kRequestIdFieldNumber = 7;
+  inline ::google::protobuf::int32 requestid() const;
+  inline void set_requestid(::google::protobuf::int32 value);
+
+  // optional int64 QueueTime = 8;
+  inline bool has_queuetime() const;
+  inline void clear_queuetime();
+  static const int kQueueTimeFieldNumber = 8;
+  inline ::google::protobuf::int64 queuetime() const;
+  inline void set_queuetime(::google::protobuf::int64 value);
+
+  // optional int64 CheckTime = 9;
+  inline bool has_checktime() const;
+  inline void clear_checktime();
+  static const int kCheckTimeFieldNumber = 9;
+  inline ::google::protobuf::int64 checktime() const;
+  inline void set_checktime(::google::protobuf::int64 value);
+
+  // optional int64 ExecuteTime = 10;
+  inline bool has_executetime() const;
+  inline void clear_executetime();
+  static const int kExecuteTimeFieldNumber = 10;
+  inline ::google::protobuf::int64 executetime() const;
+  inline void set_executetime(::google::protobuf::int64 value);
+
+  // @@protoc_insertion_point(class_scope:ProtoTypes.ExecutionOrderReport)
+ private:
+  inline void set_has_login();
+  inline void clear_has_login();
+  inline void set_has_actiontype();
+  inline void clear_has_actiontype();
+  inline void set_has_orderid();
+  inline void clear_has_orderid();
+  inline void set_has_result();
+  inline void clear_has_result();
+  inline void set_has_ticket();
+  inline void clear_has_ticket();
+  inline void set_has_price();
+  inline void clear_has_price();
+  inline void set_has_requestid();
+  inline void clear_has_requestid();
+  inline void set_has_queuetime();
+  inline void clear_has_queuetime();
+  inline void set_has_checktime();
+  inline void clear_has_checktime();
+  inline void set_has_executetime();
+  inline void clear_has_executetime();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::int32 login_;
+  int actiontype_;
+  ::google::protobuf::int32 orderid_;
+  int result_;
+  double price_;
+  ::google::protobuf::int32 ticket_;
+  ::google::protobuf::int32 requestid_;
+  ::google::protobuf::int64 queuetime_;
+  ::google::protobuf::int64 checktime_;
+  ::google::protobuf::int64 executetime_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(10 + 31) / 32];
+
+  friend void  protobuf_AddDesc_SignalExecutionReport_2eproto();
+  friend void protobuf_AssignDesc_SignalExecutionReport_2eproto();
+  friend void protobuf_ShutdownFile_SignalExecutionReport_2eproto();
+
+  void InitAsDefaultInstance();
+  static ExecutionOrderReport* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class ExecutionSignalReport : public ::google::protobuf::Message {
+ public:
+  ExecutionSignalReport();
+  virtual ~ExecutionSignalReport();
+
+  ExecutionSignalReport(const ExecutionSignalReport& from);
+
+  inline ExecutionSignalReport& operator=(const ExecutionSignalReport& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const ExecutionSignalReport& default_instance();
+
+  void Swap(ExecutionSignalReport* other);
+
+  // implements Message ----------------------------------------------
+
+  ExecutionSignalReport* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const ExecutionSignalReport& from);
+  void MergeFrom(const ExecutionSignalReport& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required string Comment = 1;
+  inline bool has_comment() const;
+  inline void clear_comment();
+  static const int kCommentFieldNumber = 1;
+  inline const ::std::string& comment() const;
+  inline void set_comment(const ::std::string& value);
+  inline void set_comment(const char* value);
+  inline void set_comment(const char* value, size_t size);
+  inline ::std::string* mutable_comment();
+  inline ::std::string* release_comment();
+  inline void set_allocated_comment(::std::string* comment);
+
+  // repeated .ProtoTypes.ExecutionOrderReport Orders = 2;
+  inline int orders_size() const;
+  inline void clear_orders();
+  static const int kOrdersFieldNumber = 2;
+  inline const ::ProtoTypes::ExecutionOrderReport& orders(int index) const;
+  inline ::ProtoTypes::ExecutionOrderReport* mutable_orders(int index);
+  inline ::ProtoTypes::ExecutionOrderReport* add_orders();
+  inline const ::google::protobuf::RepeatedPtrField< ::ProtoTypes::ExecutionOrderReport >&
+      orders() const;
+  inline ::google::protobuf::RepeatedPtrField< ::ProtoTypes::ExecutionOrderReport >*
+      mutable_orders();
+
+  // @@protoc_insertion_point(class_scope:ProtoTypes.ExecutionSignalReport)
+ private:
+  inline void set_has_comment();
+  inline void clear_has_comment();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::std::string* comment_;
+  ::google::protobuf::RepeatedPtrField< ::ProtoTypes::ExecutionOrderReport > orders_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+
+  friend void  protobuf_AddDesc_SignalExecutionReport_2eproto();
+  friend void protobuf_AssignDesc_SignalExecutionReport_2eproto();
+  friend void protobuf_ShutdownFile_SignalExecutionReport_2eproto();
+
+  void InitAsDefaultInstance();
+  static ExecutionSignalReport* default_instance_;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+// ExecutionOrderReport
+
+// required int32 Login = 1;
+inline bool ExecutionOrderReport::has_login() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void ExecutionOrderReport::set_has_login() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void ExecutionOrderReport::clear_has_login() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void ExecutionOrderReport::clear_login() {
+  login_ = 0;
+  clear_has_login();
+}
+inline ::google::protobuf::int32 ExecutionOrderReport::login() const {
+  return login_;
+}
+inline void ExecutionOrderReport::set_login(::google::protobuf::int32 value) {
+  set_has_login();
+  login_ = value;
+}
+
+// required .ProtoTypes.ActionType ActionType = 2;
+inline bool ExecutionOrderReport::has_actiontype() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void ExecutionOrderReport::set_has_actiontype() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void ExecutionOrderReport::clear_has_actiontype() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void ExecutionOrderReport::clear_actiontype() {
+  actiontype_ = 0;
+  clear_has_actiontype();
+}
+inline ::ProtoTypes::ActionType ExecutionOrderReport::actiontype() const {
+  return static_cast< ::ProtoTypes::ActionType >(actiontype_);
+}
+inline void ExecutionOrderReport::set_actiontype(::ProtoTypes::ActionType value) {
+  assert(::ProtoTypes::ActionType_IsValid(value));
+  set_has_actiontype();
+  actiontype_ = value;
+}
+
+// optional int32 OrderID = 3;
+inline bool ExecutionOrderReport::has_orderid() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void ExecutionOrderReport::set_has_orderid() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void ExecutionOrderReport::clear_has_orderid() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void ExecutionOrderReport::clear_orderid() {
+  orderid_ = 0;
+  clear_has_orderid();
+}
+inline ::google::protobuf::int32 ExecutionOrderReport::orderid() const {
+  return orderid_;
+}
+inline void ExecutionOrderReport::set_orderid(::google::protobuf::int32 value) {
+  set_has_orderid();
+  orderid_ = value;
+}
+
+// required .ProtoTypes.ExecutionResult Result = 4;
+inline bool ExecutionOrderReport::has_result() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void ExecutionOrderReport::set_has_result() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void ExecutionOrderReport::clear_has_result() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void ExecutionOrderReport::clear_result() {
+  result_ = 0;
+  clear_has_result();
+}
+inline ::ProtoTypes::ExecutionResult ExecutionOrderReport::result() const {
+  return static_cast< ::ProtoTypes::ExecutionResult >(result_);
+}
+inline void ExecutionOrderReport::set_result(::ProtoTypes::ExecutionResult value) {
+  assert(::ProtoTypes::ExecutionResult_IsValid(value));
+  set_has_result();
+  result_ = value;
+}
+
+// optional int32 Ticket = 5;
+inline bool ExecutionOrderReport::has_ticket() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void ExecutionOrderReport::set_has_ticket() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void ExecutionOrderReport::clear_has_ticket() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void ExecutionOrderReport::clear_ticket() {
+  ticket_ = 0;
+  clear_has_ticket();
+}
+inline ::google::protobuf::int32 ExecutionOrderReport::ticket() const {
+  return ticket_;
+}
+inline void ExecutionOrderReport::set_ticket(::google::protobuf::int32 value) {
+  set_has_ticket();
+  ticket_ = value;
+}
+
+// optional double Price = 6 [default = 0];
+inline bool ExecutionOrderReport::has_price() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+inline void ExecutionOrderReport::set_has_price() {
+  _has_bits_[0] |= 0x00000020u;
+}
+inline void ExecutionOrderReport::clear_has_price() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline void ExecutionOrderReport::clear_price() {
+  price_ = 0;
+  clear_has_price();
+}
+inline double ExecutionOrderReport::price() const {
+  return price_;
+}
+inline void ExecutionOrderReport::set_price(double value) {
+  set_has_price();
+  price_ = value;
+}
+
+// optional int32 RequestId = 7;
+inline bool ExecutionOrderReport::has_requestid() const {
+  return (_has_bits_[0] & 0x00000040u) != 0;
+}
+inline void ExecutionOrderReport::set_has_requestid() {
+  _has_bits_[0] |= 0x00000040u;
+}
+inline void ExecutionOrderReport::clear_has_requestid() {
+  _has_bits_[0] &= ~0x00000040u;
+}
+inline void ExecutionOrderReport::clear_requestid() {
+  requestid_ = 0;
+  clear_has_requestid();
+}
+inline ::google::protobuf::int32 ExecutionOrderReport::requestid() const {
+  return requestid_;
+}
+inline void ExecutionOrderReport::set_requestid(::google::protobuf::int32 value) {
+  set_has_requestid();
+  requestid_ = value;
+}
+
+// optional int64 QueueTime = 8;
+inline bool ExecutionOrderReport::has_queuetime() const {
+  return (_has_bits_[0] & 0x00000080u) != 0;
+}
+inline void ExecutionOrderReport::set_has_queuetime() {
+  _has_bits_[0] |= 0x00000080u;
+}
+inline void ExecutionOrderReport::clear_has_queuetime() {
+  _has_bits_[0] &= ~0x00000080u;
+}
+inline void ExecutionOrderReport::clear_queuetime() {
+  queuetime_ = GOOGLE_LONGLONG(0);
+  clear_has_queuetime();
+}
+inline ::google::protobuf::int64 ExecutionOrderReport::queuetime() const {
+  return queuetime_;
+}
+inline void ExecutionOrderReport::set_queuetime(::google::protobuf::int64 value) {
+  set_has_queuetime();
+  queuetime_ = value;
+}
+
+// optional int64 CheckTime = 9;
+inline bool ExecutionOrderReport::has_checktime() const {
+  return (_has_bits_[0] & 0x00000100u) != 0;
+}
+inline void ExecutionOrderReport::set_has_checktime() {
+  _has_bits_[0] |= 0x00000100u;
+}
+inline void ExecutionOrderReport::clear_has_checktime() {
+  _has_bits_[0] &= ~0x00000100u;
+}
+inline void ExecutionOrderReport::clear_checktime() {
+  checktime_ = GOOGLE_LONGLONG(0);
+  clear_has_checktime();
+}
+inline ::google::protobuf::int64 ExecutionOrderReport::checktime() const {
+  return checktime_;
+}
+inline void ExecutionOrderReport::set_checktime(::google::protobuf::int64 value) {
+  set_has_checktime();
+  checktime_ = value;
+}
+
+// optional int64 ExecuteTime = 10;
+inline bool ExecutionOrderReport::has_executetime() const {
+  return (_has_bits_[0] & 0x00000200u) != 0;
+}
+inline void ExecutionOrderReport::set_has_executetime() {
+  _has_bits_[0] |= 0x00000200u;
+}
+inline void ExecutionOrderReport::clear_has_executetime() {
+  _has_bits_[0] &= ~0x00000200u;
+}
+inline void ExecutionOrderReport::clear_executetime() {
+  executetime_ = GOOGLE_LONGLONG(0);
+  clear_has_executetime();
+}
+inline ::google::protobuf::int64 ExecutionOrderReport::executetime() const {
+  return executetime_;
+}
+inline void ExecutionOrderReport::set_executetime(::google::protobuf::int64 value) {
+  set_has_executetime();
+  executetime_ = value;
+}
+
+// -------------------------------------------------------------------
+
+// ExecutionSignalReport
+
+// required string Comment = 1;
+inline bool ExecutionSignalReport::has_comment() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void ExecutionSignalReport::set_has_comment() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void ExecutionSignalReport::clear_has_comment() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void ExecutionSignalReport::clear_comment() {
+  if (comment_ != &::google::protobuf::internal::kEmptyString) {
+    comment_->clear();
+  }
+  clear_has_comment();
+}
+inline const ::std::string& ExecutionSignalReport::comment() const {
+  return *comment_;
+}
+inline void ExecutionSignalReport::set_comment(const ::std::string& value) {
+  set_has_comment();
+  if (comment_ == &::google::protobuf::internal::kEmptyString) {
+    comment_ = new ::std::string;
+  }
+  comment_->assign(value);
+}
+inline void ExecutionSignalReport::set_comment(const char* value) {
+  set_has_comment();
+  if (comment_ == &::google::protobuf::internal::kEmptyString) {
+    comment_ = new ::std::string;
+  }
+  comment_->assign(value);
+}
+inline void ExecutionSignalReport::set_comment(const char* value, size_t size) {
+  set_has_comment();
+  if (comment_ == &::google::protobuf::internal::kEmptyString) {
+    comment_ = new ::std::string;
+  }
+  comment_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* ExecutionSignalReport::mutable_comment() {
+  set_has_comment();
+  if (comment_ == &::google::protobuf::internal::kEmptyString) {
+    comment_ = new ::std::string;
+  }
+  return comment_;
+}
+inline ::std::string* ExecutionSignalReport::release_comment() {
+  clear_has_comment();
+  if (comment_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = comment_;
+    comment_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void ExecutionSignalReport::set_allocated_comment(::std::string* comment) {
+  if (comment_ != &::google::protobuf::internal::kEmptyString) {
+    delete comment_;
+  }
+  if (comment) {
+    set_has_comment();
+    comment_ = comment;
+  } else {
+    clear_has_comment();
+    comment_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
+}
+
+// repeated .ProtoTypes.ExecutionOrderReport Orders = 2;
+inline int ExecutionSignalReport::orders_size() const {
+  return orders_.size();
+}
+inline void ExecutionSignalReport::clear_orders() {
+  orders_.Clear();
+}
+inline const ::ProtoTypes::ExecutionOrderReport& ExecutionSignalReport::orders(int index) const {
+  return orders_.Get(index);
+}
+inline ::ProtoTypes::ExecutionOrderReport* ExecutionSignalReport::mutable_orders(int index) {
+  return orders_.Mutable(index);
+}
+inline ::ProtoTypes::ExecutionOrderReport* ExecutionSignalReport::add_orders() {
+  return orders_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::ProtoTypes::ExecutionOrderReport >&
+ExecutionSignalReport::orders() const {
+  return orders_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::ProtoTypes::ExecutionOrderReport >*
+ExecutionSignalReport::mutable_orders() {
+  return &orders_;
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ProtoTypes
+
+#ifndef SWIG
+namespace google {
+namespace protobuf {
+
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::ProtoTypes::ExecutionResult>() {
+  return ::ProtoTypes::ExecutionResult_descriptor();
+}
+
+}  // namespace google
+}  // namespace protobuf
+#endif  // SWIG
+
+// @@protoc_insertion_point(global_scope)
+
+#endif  // PROTOBUF_SignalExecutionReport_2eproto__INCLUDED
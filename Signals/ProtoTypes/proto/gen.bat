@@ -4,7 +4,9 @@
 protogen -i:RequestExecution.proto -o:RequestExecution.cs
 protogen -i:SignalMT4Trade.proto -o:SignalMT4Trade.cs
 protogen -i:RequestOrdersStatus.proto -o:RequestOrdersStatus.cs
+protogen -i:RequestWatchedLogins.proto -o:RequestWatchedLogins.cs
 protogen -i:SignalOrdersStatus.proto -o:SignalOrdersStatus.cs
+protogen -i:SignalExecutionReport.proto -o:SignalExecutionReport.cs
 protogen -i:Request.proto -o:Request.cs
 protogen -i:Signal.proto -o:Signal.cs
 
@@ -0,0 +1,47 @@
+#include "Platform.h"
+#include "Benchmark.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+//--- every allocation of the benchmark process goes through here, including protobuf and zmq
+static std::atomic<unsigned long long> ExtAllocations(0);
+
+unsigned long long BenchmarkAllocations()
+{
+	return ExtAllocations.load(std::memory_order_relaxed);
+}
+
+void* operator new(size_t size)
+{
+	ExtAllocations.fetch_add(1, std::memory_order_relaxed);
+	void *ptr = malloc(size == 0 ? 1 : size);
+	if(ptr == NULL)
+		throw std::bad_alloc();
+	return ptr;
+}
+
+void* operator new[](size_t size)
+{
+	return operator new(size);
+}
+
+void operator delete(void *ptr) throw()
+{
+	free(ptr);
+}
+
+void operator delete[](void *ptr) throw()
+{
+	free(ptr);
+}
+
+void operator delete(void *ptr, size_t) throw()
+{
+	free(ptr);
+}
+
+void operator delete[](void *ptr, size_t) throw()
+{
+	free(ptr);
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include <chrono>
+#include <map>
+#include <string>
+
+/// key=value arguments of a benchmark scenario
+class BenchmarkArgs
+{
+public:
+	BenchmarkArgs(int argc, char *argv[]);
+
+	int GetInt(const std::string &name, int def) const;
+	std::string GetString(const std::string &name, const std::string &def) const;
+
+private:
+	std::map<std::string, std::string> values;
+};
+
+/// Monotonic stopwatch
+class Stopwatch
+{
+public:
+	Stopwatch() : start(std::chrono::steady_clock::now()) {}
+
+	void Restart() { start = std::chrono::steady_clock::now(); }
+	double ElapsedUs() const
+	{
+		return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+	}
+
+private:
+	std::chrono::steady_clock::time_point start;
+};
+
+/// Count of heap allocations made by the process so far
+unsigned long long BenchmarkAllocations();
+
+/// Publish plugin settings for the benchmark (host, port from args) and apply them to the processor
+void ApplyBenchmarkSettings(const BenchmarkArgs &args, int equityBurstWindow, bool autoExecution = false);
+/// Route emulator trade hooks to the processor, like the MT4 server calls plugin trade hooks
+void SubscribeProcessorOnEmulator();
+void UnsubscribeProcessorFromEmulator();
+
+//--- scenarios
+int RunMassCloseBenchmark(const BenchmarkArgs &args);
+int RunPipelineBenchmark(const BenchmarkArgs &args);
+int RunConfirmsBenchmark(const BenchmarkArgs &args);
+int RunRouterLoadBenchmark(const BenchmarkArgs &args);
+int RunCodecBenchmark(const BenchmarkArgs &args);
+int RunJournalBenchmark(const BenchmarkArgs &args);
+int RunFailoverBenchmark(const BenchmarkArgs &args);
+int RunTransportBenchmark(const BenchmarkArgs &args);
+int RunCommissionBenchmark(const BenchmarkArgs &args);
+int RunStatusBenchmark(const BenchmarkArgs &args);
+int RunBoardBenchmark(const BenchmarkArgs &args);
+int RunVerdictBenchmark(const BenchmarkArgs &args);
+int RunPrevalidateBenchmark(const BenchmarkArgs &args);
+int RunReversalBenchmark(const BenchmarkArgs &args);
+int RunWarmUpBenchmark(const BenchmarkArgs &args);
+int RunCoalesceBenchmark(const BenchmarkArgs &args);
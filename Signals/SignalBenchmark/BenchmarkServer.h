@@ -0,0 +1,23 @@
+#pragma once
+#include "mt4part/MT4ServerEmulator.h"
+#include "mt4part/EmulatorStore.h"
+
+/// Emulated server of the scenarios. MT4ServerEmulator leaves OrdersGet by time and logins and TradesCalcRates
+/// commented out like the methods it does not emulate, the scenarios read them from the emulator store here
+class BenchmarkServer : public MT4ServerEmulator
+{
+public:
+	BenchmarkServer() : MT4ServerEmulator(NULL) {}
+
+	using MT4ServerEmulator::OrdersGet;
+
+	TradeRecord* __stdcall OrdersGet(const time_t from, const time_t to, const int *logins, const int count, int *total)
+	{
+		return ExtEmulatorStore.OrdersGet(from, to, logins, count, total);
+	}
+
+	double __stdcall TradesCalcRates(LPCSTR group, LPCSTR from, LPCSTR to)
+	{
+		return ExtEmulatorStore.CalcRates(from, to);
+	}
+};
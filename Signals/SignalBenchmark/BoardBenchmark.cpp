@@ -0,0 +1,168 @@
+#include "StdAfx.h"
+#include "Benchmark.h"
+#include "mt4part/Processor.h"
+#include "BenchmarkServer.h"
+#include "mt4part/EmulatorStore.h"
+#include "PositionsBoard.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <iostream>
+
+/// Reader on this host: consistent copies of random logins while the plugin trades
+static void ReadBoard(PositionsBoard *board, int accounts, volatile bool *running, std::atomic<unsigned long long> *reads,
+	std::atomic<unsigned long long> *broken)
+{
+	std::vector<BoardPosition> positions;
+	unsigned int seed = 12345;
+	unsigned long long count = 0, bad = 0;
+	while(*running)
+	{
+		seed = seed * 1103515245 + 12345;
+		if(board->Read(100000 + (seed >> 8) % accounts, positions))
+			for(size_t i = 0; i < positions.size(); i++)
+				if(positions[i].order <= 0 || positions[i].cmd > OP_SELL || positions[i].symbol[sizeof(positions[i].symbol) - 1] != 0)
+					bad++;
+		count++;
+	}
+	reads->fetch_add(count);
+	broken->fetch_add(bad);
+}
+
+/// Positions of the board and open trades of the emulator differ
+static bool BoardDiffers(PositionsBoard &board, BenchmarkServer &server, int login)
+{
+	std::vector<BoardPosition> positions;
+	if(!board.Read(login, positions))
+		return true;
+	UserInfo ui = BaseExecutionSignal::UserInfoLoad(login, &server);
+	int total = 0;
+	TradeRecord *trades = server.OrdersGetOpen(&ui, &total);
+	bool differs = (int)positions.size() != total;
+	for(int i = 0; i < total && !differs; i++)
+	{
+		differs = true;
+		for(size_t j = 0; j < positions.size(); j++)
+			if(positions[j].order == trades[i].order && positions[j].volume == trades[i].volume && positions[j].sl == trades[i].sl)
+				differs = false;
+	}
+	if(trades != NULL)
+		HEAP_FREE(trades);
+	return differs;
+}
+
+/// Open positions board against status requests: load of the watched logins, reads of a reader process
+/// while trade hooks update the board, cost of one login read from the board and asked by a status request
+int RunBoardBenchmark(const BenchmarkArgs &args)
+{
+	EmulatorDataset dataset;
+	dataset.accounts = (std::max)(1, args.GetInt("accounts", 10000));
+	dataset.orders = (std::max)(0, args.GetInt("orders", 50000));
+	int operations = (std::max)(1, args.GetInt("operations", 100000));
+	int readers = (std::max)(1, args.GetInt("readers", 2));
+	int requests = (std::max)(1, args.GetInt("requests", 1000));
+	std::string name = args.GetString("name", "SignalBenchmark_Board");
+	ExtEmulatorStore.Generate(dataset);
+
+	BenchmarkServer server;
+	processor.SetServerInterface(&server);
+	ApplyBenchmarkSettings(args, 0);
+	PositionsBoard::Remove(name);
+	PluginSettings settings = *ExtSettings.Current();
+	settings.positionsBoard = name;
+	settings.positionsBoardLogins = dataset.accounts * 2;
+	processor.Reconfigure(ExtSettings.Publish(settings));
+	SubscribeProcessorOnEmulator();
+
+	std::vector<int> logins(dataset.accounts);
+	for(int i = 0; i < dataset.accounts; i++)
+		logins[i] = 100000 + i;
+	Stopwatch watch;
+	processor.OnWatchedLoginsRequest(logins);
+	std::cout << "board load logins=" << dataset.accounts << " orders=" << ExtEmulatorStore.OrdersTotal()
+		<< " us=" << watch.ElapsedUs() << std::endl;
+
+	PositionsBoard board;
+	if(!board.Open(name, PositionsBoardReader, settings.positionsBoardLogins, settings.positionsBoardPositions))
+	{
+		std::cout << "board can not open " << name << std::endl;
+		processor.Clear();
+		return 1;
+	}
+
+	//--- trades of random logins open and close while the readers copy slots
+	volatile bool running = true;
+	std::atomic<unsigned long long> reads(0), broken(0);
+	std::vector<std::thread> threads;
+	for(int i = 0; i < readers; i++)
+		threads.push_back(std::thread(ReadBoard, &board, dataset.accounts, &running, &reads, &broken));
+
+	const char *symbols[] = { "EURUSD", "GBPUSD", "USDJPY", "EURGBP" };
+	unsigned int seed = dataset.seed * 7919 + 1;
+	unsigned long long generation = board.Generation();
+	watch.Restart();
+	for(int i = 0; i < operations; i++)
+	{
+		seed = seed * 1103515245 + 12345;
+		int login = 100000 + (seed >> 8) % dataset.accounts;
+		UserInfo ui = BaseExecutionSignal::UserInfoLoad(login, &server);
+		int total = 0;
+		TradeRecord *open = (seed & 1) ? server.OrdersGetOpen(&ui, &total) : NULL;
+		TradeTransInfo trans = {0};
+		if(total > 0)
+		{
+			trans.order = open[(seed >> 4) % total].order;
+			server.OrdersClose(&trans, &ui);
+		}
+		else
+		{
+			trans.cmd = (seed >> 3) & 1 ? OP_BUY : OP_SELL;
+			trans.volume = 1 + (seed >> 12) % 100;
+			COPY_STR(trans.symbol, symbols[(seed >> 16) % 4]);
+			server.OrdersOpen(&trans, &ui);
+		}
+		if(open != NULL)
+			HEAP_FREE(open);
+	}
+	double tradeUs = watch.ElapsedUs();
+	running = false;
+	for(size_t i = 0; i < threads.size(); i++)
+		threads[i].join();
+
+	int mismatches = 0;
+	for(int i = 0; i < dataset.accounts; i++)
+		if(BoardDiffers(board, server, logins[i]))
+			mismatches++;
+	std::cout << "board trades operations=" << operations
+		<< " updates=" << board.Generation() - generation
+		<< " readers=" << readers
+		<< " reads_per_sec=" << reads.load() * 1000000.0 / tradeUs
+		<< " broken=" << broken.load()
+		<< " mismatches=" << mismatches << std::endl;
+
+	//--- one login: a copy from the board against a status request answered by the status lane
+	std::vector<BoardPosition> positions;
+	watch.Restart();
+	for(int i = 0; i < requests; i++)
+		board.Read(logins[i % dataset.accounts], positions);
+	double boardUs = watch.ElapsedUs();
+	watch.Restart();
+	for(int i = 0; i < requests; i++)
+	{
+		unsigned long long target = processor.StatusProcessed() + 1;
+		processor.OnTradesRequest(std::vector<int>(1, logins[i % dataset.accounts]));
+		while(processor.StatusProcessed() < target)
+			PlatformSleep(0);
+	}
+	double statusUs = watch.ElapsedUs();
+	std::cout << "board login requests=" << requests
+		<< " board_ns=" << boardUs * 1000.0 / requests
+		<< " status_request_ns=" << statusUs * 1000.0 / requests << std::endl;
+
+	board.Close();
+	UnsubscribeProcessorFromEmulator();
+	processor.Clear();
+	PositionsBoard::Remove(name);
+	return 0;
+}
@@ -0,0 +1,128 @@
+#include "StdAfx.h"
+#include "Benchmark.h"
+#include "mt4part/Processor.h"
+#include "mt4part/PluginSettings.h"
+#include "BenchmarkServer.h"
+#include "mt4part/EmulatorStore.h"
+#include <algorithm>
+#include <atomic>
+#include <vector>
+#include <iostream>
+
+/// Emulated server counting the logins whose orders were read
+class CoalesceServer : public BenchmarkServer
+{
+public:
+	CoalesceServer() :
+		reads(0)
+	{
+	}
+
+	TradeRecord* __stdcall OrdersGet(const time_t from, const time_t to, const int *logins, const int count, int *total)
+	{
+		reads.fetch_add(count);
+		return BenchmarkServer::OrdersGet(from, to, logins, count, total);
+	}
+
+	TradeRecord* __stdcall OrdersGetOpen(const UserInfo *user, int *total)
+	{
+		reads.fetch_add(1);
+		return BenchmarkServer::OrdersGetOpen(user, total);
+	}
+
+	long long Reads() { return reads.exchange(0); }
+
+private:
+	std::atomic<long long> reads;
+};
+
+/// Reconciliation after a router failover: several status requests with overlapping logins at once,
+/// answered one by one without the cache and coalesced with the cache. Trades of some logins change between rounds
+int RunCoalesceBenchmark(const BenchmarkArgs &args)
+{
+	int accounts = (std::max)(1, args.GetInt("accounts", 10000));
+	int ordersPerLogin = (std::max)(0, args.GetInt("orders_per_login", 5));
+	int requesters = (std::max)(1, args.GetInt("requesters", 4));
+	int logins = (std::min)(accounts, (std::max)(1, args.GetInt("logins", 5000)));
+	int rounds = (std::max)(1, args.GetInt("rounds", 5));
+	int touched = (std::max)(0, args.GetInt("touched", 100));
+	int window = (std::max)(1, args.GetInt("status_window", 5));
+
+	EmulatorDataset dataset;
+	dataset.accounts = accounts;
+	dataset.orders = accounts * ordersPerLogin;
+	dataset.groups = 10;
+	ExtEmulatorStore.Generate(dataset);
+
+	CoalesceServer server;
+	processor.SetServerInterface(&server);
+	ApplyBenchmarkSettings(args, 0);
+	SubscribeProcessorOnEmulator();
+
+	//--- every requester asks for its own random logins, the sets overlap
+	std::vector<std::vector<int> > requests(requesters);
+	std::vector<int> all(accounts);
+	for(int i = 0; i < accounts; i++)
+		all[i] = 100000 + i;
+	//--- the cache keeps entries of watched logins, trades of the others do not reach it
+	processor.OnWatchedLoginsRequest(all);
+	for(int r = 0; r < requesters; r++)
+	{
+		std::random_shuffle(all.begin(), all.end());
+		requests[r].assign(all.begin(), all.begin() + logins);
+	}
+
+	int windows[] = { 0, window };
+	for(int m = 0; m < 2; m++)
+	{
+		PluginSettings settings = *ExtSettings.Current();
+		settings.statusCoalesceWindow = windows[m];
+		settings.statusCacheSize = windows[m] == 0 ? 0 : accounts;
+		processor.Reconfigure(ExtSettings.Publish(settings));
+
+		double elapsed = 0, best = 0;
+		long long reads = 0;
+		unsigned long long scans = processor.StatusScans();
+		server.Reads();
+		for(int round = 0; round < rounds; round++)
+		{
+			//--- a stop loss of one order of some logins moves, their entries have to be read again
+			for(int i = 0; i < touched; i++)
+			{
+				int total = 0;
+				TradeRecord *trades = ExtEmulatorStore.OrdersGetOpen(all[(round * touched + i) % accounts], &total);
+				if(total > 0)
+				{
+					trades[0].sl = trades[0].sl == 0.0 ? trades[0].open_price * 0.5 : 0.0;
+					ExtEmulatorStore.OrdersUpdate(&trades[0], NULL, UPDATE_NORMAL);
+				}
+				if(trades != NULL)
+					HEAP_FREE(trades);
+			}
+
+			unsigned long long target = processor.StatusProcessed() + requesters;
+			Stopwatch watch;
+			for(int r = 0; r < requesters; r++)
+				processor.OnTradesRequest(requests[r]);
+			while(processor.StatusProcessed() < target)
+				PlatformSleep(0);
+			double us = watch.ElapsedUs();
+			elapsed += us;
+			best = round == 0 ? us : (std::min)(best, us);
+			reads += server.Reads();
+		}
+		std::cout << "coalesce mode=" << (windows[m] == 0 ? "one_by_one" : "coalesced")
+			<< " window=" << windows[m]
+			<< " requesters=" << requesters
+			<< " logins=" << logins
+			<< " touched=" << touched
+			<< " avg_us=" << elapsed / rounds
+			<< " best_us=" << best
+			<< " scans=" << (processor.StatusScans() - scans) / rounds
+			<< " logins_read=" << reads / rounds << std::endl;
+	}
+
+	UnsubscribeProcessorFromEmulator();
+	processor.Clear();
+	return 0;
+}
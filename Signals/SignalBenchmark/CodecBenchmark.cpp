@@ -0,0 +1,220 @@
+#include "Platform.h"
+#include "Benchmark.h"
+#include "SignalModule.h"
+#include "SignalCodec.h"
+#include "OrdersStatusWriter.h"
+#include "proto/Request.pb.h"
+#include <fstream>
+#include <iostream>
+
+static const char *ExtCodecSymbols[] = { "EURUSD", "GBPUSD", "USDJPY", "EURGBP" };
+
+/// One codec measurement
+struct CodecResult
+{
+	std::string name;
+	int    payload;
+	int    iterations;
+	double nsPerOp;
+	double bytesPerOp;
+	double allocsPerOp;
+};
+
+/// Run body iterations times after a short warm-up, body returns bytes produced
+template<typename Body>
+static CodecResult MeasureCodec(const char *name, int payload, int iterations, Body body)
+{
+	for(int i = 0; i < iterations / 10; i++)
+		body();
+
+	CodecResult result;
+	result.name = name;
+	result.payload = payload;
+	result.iterations = iterations;
+	unsigned long long bytes = 0;
+	unsigned long long allocations = BenchmarkAllocations();
+	Stopwatch watch;
+	for(int i = 0; i < iterations; i++)
+		bytes += body();
+	double elapsedUs = watch.ElapsedUs();
+	result.nsPerOp = elapsedUs * 1000.0 / iterations;
+	result.bytesPerOp = (double)bytes / iterations;
+	result.allocsPerOp = (double)(BenchmarkAllocations() - allocations) / iterations;
+	return result;
+}
+
+static MT4TradeSignal MakeTradeSignal(int index)
+{
+	MT4TradeSignal signal;
+	signal.Side = index & 1 ? TradeSide::Sell : TradeSide::Buy;
+	signal.ActionType = ActionType::Open;
+	signal.DateTime = 1500000000 + index;
+	signal.Equity = 10000.0 + index;
+	signal.Balance = 10000.0;
+	signal.Volume = 0.1;
+	signal.Symbol = ExtCodecSymbols[index % 4];
+	signal.StopLoss = 1.0950;
+	signal.TakeProfit = 1.1050;
+	signal.Login = 100000 + index;
+	signal.Server = "Benchmark";
+	signal.OrderID = 1000000 + index;
+	signal.Comment = "Signal_100001_2000001";
+	signal.Profit = 12.5;
+	signal.ProviderCommission = 0.7;
+	return signal;
+}
+
+static OrdersStatusResponse MakeStatusResponse(int logins, int positions)
+{
+	OrdersStatusResponse response;
+	response.OrdersStatus.resize(logins);
+	for(int i = 0; i < logins; i++)
+	{
+		AccountOrdersStatus &account = response.OrdersStatus[i];
+		account.Login = 100000 + i;
+		account.Status.resize(positions);
+		for(int j = 0; j < positions; j++)
+		{
+			OrderStatus &status = account.Status[j];
+			status.OrderID = 1000000 + i * positions + j;
+			status.Side = j & 1 ? TradeSide::Sell : TradeSide::Buy;
+			status.DateTime = 1500000000 + j;
+			status.Volume = 0.1;
+			status.Symbol = ExtCodecSymbols[j % 4];
+			status.StopLoss = 0.0;
+			status.TakeProfit = 1.1050;
+			status.Comment = "Signal_100001_2000001";
+		}
+	}
+	return response;
+}
+
+static std::string MakeExecutionRequest(int orders)
+{
+	ProtoTypes::ExecutionSignal signal;
+	signal.set_comment("Signal_100001_2000001");
+	signal.set_destination("Benchmark");
+	for(int i = 0; i < orders; i++)
+	{
+		ProtoTypes::ExecutionOrder *order = signal.add_orders();
+		order->set_login(100000 + i);
+		order->set_actiontype(ProtoTypes::Open);
+		order->set_side(i & 1 ? ProtoTypes::Sell : ProtoTypes::Buy);
+		order->set_symbol(ExtCodecSymbols[i % 4]);
+		order->set_volume(0.1);
+		order->set_commission(0.7);
+	}
+	ProtoTypes::Request request;
+	request.set_requesttype(ProtoTypes::ExecutionRequestType);
+	request.set_destination("Benchmark");
+	request.set_content(signal.SerializeAsString());
+	return request.SerializeAsString();
+}
+
+/// SignalModule conversions and envelopes with realistic payload sizes, results as JSON lines
+int RunCodecBenchmark(const BenchmarkArgs &args)
+{
+	int iterations = args.GetInt("iterations", 100000);
+	int orders = args.GetInt("orders", 10);
+	int logins = args.GetInt("logins", 50);
+	int positions = args.GetInt("positions", 20);
+	std::string out = args.GetString("out", "codec.jsonl");
+	std::vector<CodecResult> results;
+
+	MT4TradeSignal tradeSignal = MakeTradeSignal(1);
+	results.push_back(MeasureCodec("MT4TradeSignalToProto", 1, iterations, [&]() -> size_t
+	{
+		ProtoTypes::MT4TradeSignal proto;
+		SignalCodec::MT4TradeSignalToProto(tradeSignal, proto);
+		return proto.ByteSize();
+	}));
+
+	OrdersStatusResponse response = MakeStatusResponse(logins, positions);
+	int statusIterations = (std::max)(1, iterations / (std::max)(1, logins * positions / 10));
+	results.push_back(MeasureCodec("OrdersStatusResponseToProto", logins * positions, statusIterations, [&]() -> size_t
+	{
+		ProtoTypes::OrdersStatusResponse proto;
+		SignalCodec::OrdersStatusResponseToProto(response, proto);
+		return proto.ByteSize();
+	}));
+
+	//--- the writer goes from the order fields to the wire, the bytes have to be those of the proto
+	OrdersStatusWriter writer;
+	results.push_back(MeasureCodec("OrdersStatusWriter", logins * positions, statusIterations, [&]() -> size_t
+	{
+		writer.Clear();
+		for(size_t i = 0; i < response.OrdersStatus.size(); i++)
+		{
+			const AccountOrdersStatus &account = response.OrdersStatus[i];
+			writer.BeginAccount(account.Login);
+			for(size_t j = 0; j < account.Status.size(); j++)
+			{
+				const OrderStatus &status = account.Status[j];
+				writer.AddOrder(status.OrderID, status.Side, status.DateTime, status.Volume,
+					status.Symbol.c_str(), status.StopLoss, status.TakeProfit, status.Comment.c_str());
+			}
+			writer.EndAccount();
+		}
+		return writer.Content().size();
+	}));
+	ProtoTypes::OrdersStatusResponse statusProto;
+	SignalCodec::OrdersStatusResponseToProto(response, statusProto);
+	bool writerMatches = writer.Content() == statusProto.SerializeAsString();
+	if(!writerMatches)
+		std::cout << "codec OrdersStatusWriter output differs from the proto" << std::endl;
+
+	std::string request = MakeExecutionRequest(orders);
+	ProtoTypes::Request envelope;
+	envelope.ParseFromString(request);
+	ProtoTypes::ExecutionSignal executionProto;
+	executionProto.ParseFromString(envelope.content());
+	results.push_back(MeasureCodec("ProtoToExecutionSignal", orders, iterations, [&]() -> size_t
+	{
+		ExecutionSignal signal;
+		SignalCodec::ProtoToExecutionSignal(executionProto, signal);
+		return signal.Orders.size() * sizeof(ExecutionOrder);
+	}));
+
+	//--- full dispatch of a raw router message, the handler only counts
+	SignalModule module;
+	size_t dispatched = 0;
+	module.SubscribeOnExecuteSignal([&](ExecutionSignal signal) { dispatched += signal.Orders.size(); });
+	results.push_back(MeasureCodec("HandleMessage", orders, iterations, [&]() -> size_t
+	{
+		module.HandleMessage(request);
+		return request.size();
+	}));
+
+	std::string message;
+	results.push_back(MeasureCodec("SendSignal", 1, iterations, [&]() -> size_t
+	{
+		ProtoTypes::MT4TradeSignal proto;
+		SignalCodec::MT4TradeSignalToProto(tradeSignal, proto);
+		SignalCodec::BuildSignal(ProtoTypes::TradeSignal, "Benchmark", proto.SerializeAsString(), message);
+		return message.size();
+	}));
+
+	std::ofstream file(out.c_str(), std::ios::out | std::ios::app);
+	for(size_t i = 0; i < results.size(); i++)
+	{
+		const CodecResult &r = results[i];
+		std::cout << "codec name=" << r.name
+			<< " payload=" << r.payload
+			<< " iterations=" << r.iterations
+			<< " ns_per_op=" << r.nsPerOp
+			<< " bytes_per_op=" << r.bytesPerOp
+			<< " allocs_per_op=" << r.allocsPerOp << std::endl;
+		file << "{\"scenario\":\"codec\",\"name\":\"" << r.name
+			<< "\",\"payload\":" << r.payload
+			<< ",\"iterations\":" << r.iterations
+			<< ",\"ns_per_op\":" << r.nsPerOp
+			<< ",\"bytes_per_op\":" << r.bytesPerOp
+			<< ",\"allocs_per_op\":" << r.allocsPerOp << "}" << std::endl;
+	}
+	if(!file)
+	{
+		std::cout << "codec failed to write " << out << std::endl;
+		return 1;
+	}
+	return dispatched > 0 && writerMatches ? 0 : 1;
+}
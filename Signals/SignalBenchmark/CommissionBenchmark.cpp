@@ -0,0 +1,165 @@
+#include "StdAfx.h"
+#include "Benchmark.h"
+#include "mt4part/CommissionTable.h"
+#include "BenchmarkServer.h"
+#include "mt4part/EmulatorStore.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <iostream>
+
+/// Account of a group of the emulator, all the commission needs of it
+static UserInfo GroupUser(BenchmarkServer &server, const ConGroup &group)
+{
+	UserInfo ui = {0};
+	ui.login = 100000;
+	COPY_STR(ui.group, group.group);
+	server.GroupsGet(ui.group, &ui.grp);
+	return ui;
+}
+
+/// Commission of an order as OpenOrderSignal::GetTradingCommission computed it before the table,
+/// kept here on its own so the table is not checked against itself
+static double FormulaCommission(BenchmarkServer &server, const ConSymbol &symbol, const UserInfo &ui, double provider_commission, int volume)
+{
+	if(strstr(symbol.symbol, "bo") != NULL || strstr(symbol.symbol, "bin") != NULL)
+		return 0.0;
+
+	std::string sym = symbol.symbol;
+	std::string cur = sym.substr(3, 3);
+	double rate = server.TradesCalcRates(ui.group, cur.c_str(), ui.grp.currency);
+	if(rate <= 0)
+		rate = server.TradesCalcRates(ui.group, "USD", ui.grp.currency);
+	if(symbol.digits == 3 || symbol.digits == 5)
+		rate *= 10;
+
+	double point_price_per_lot = symbol.contract_size * symbol.point * rate;
+	return provider_commission * point_price_per_lot * (0.01 * volume);
+}
+
+/// Formula commissions of every symbol and group, in the order CompareTable walks them
+static std::vector<double> FormulaCommissions(BenchmarkServer &server, const std::vector<ConSymbol> &symbols, const std::vector<UserInfo> &users)
+{
+	std::vector<double> commissions;
+	for(size_t s = 0; s < symbols.size(); s++)
+		for(size_t u = 0; u < users.size(); u++)
+			commissions.push_back(FormulaCommission(server, symbols[s], users[u], 2.0, 10));
+	return commissions;
+}
+
+static bool SameCommission(double a, double b)
+{
+	return fabs(a - b) <= 1e-9 * (std::max)(1.0, fabs(b));
+}
+
+/// Table against the formula for every symbol and group, returns the count of different commissions.
+/// With previous set a commission of before the last change is stale, not wrong: the table reuses it up to the refresh interval
+static int CompareTable(BenchmarkServer &server, CCommissionTable &table, const std::vector<ConSymbol> &symbols, const std::vector<UserInfo> &users,
+	const std::vector<double> &expected, const std::vector<double> *previous, int &stale)
+{
+	int mismatches = 0;
+	size_t index = 0;
+	for(size_t s = 0; s < symbols.size(); s++)
+	{
+		for(size_t u = 0; u < users.size(); u++, index++)
+		{
+			double actual = table.Commission(&server, symbols[s], users[u], 2.0, 10);
+			if(SameCommission(actual, expected[index]))
+				continue;
+			if(previous != NULL && SameCommission(actual, (*previous)[index]))
+			{
+				stale++;
+				continue;
+			}
+			std::cout << "commission mismatch symbol=" << symbols[s].symbol << " group=" << users[u].group
+				<< " expected=" << expected[index] << " actual=" << actual << std::endl;
+			mismatches++;
+		}
+	}
+	return mismatches;
+}
+
+/// Commission table: commissions against the formula for every symbol of the emulator dataset
+/// and every group currency. After the rates and after the symbol configuration change the table may
+/// answer with the commission of before the change until the refresh interval passes, never longer.
+/// Then the cost of one commission with and without the table
+int RunCommissionBenchmark(const BenchmarkArgs &args)
+{
+	int iterations = (std::max)(1, args.GetInt("iterations", 1000000));
+
+	EmulatorDataset dataset;
+	dataset.accounts = 1;
+	dataset.orders = 0;
+	dataset.groups = 1;
+	ExtEmulatorStore.Generate(dataset);
+	//--- groups of other currencies, rates go through the cross of the quote currency
+	const char *currencies[] = { "EUR", "GBP", "JPY" };
+	for(size_t i = 0; i < sizeof(currencies) / sizeof(currencies[0]); i++)
+	{
+		ConGroup group = {0};
+		ExtEmulatorStore.GroupsGet("demo-1", &group);
+		_snprintf_s(group.group, sizeof(group.group), _TRUNCATE, "demo-%s", currencies[i]);
+		COPY_STR(group.currency, currencies[i]);
+		ExtEmulatorStore.GroupsAdd(&group);
+	}
+
+	BenchmarkServer server;
+	std::vector<ConSymbol> symbols;
+	ConSymbol symbol;
+	for(int pos = 0; ExtEmulatorStore.SymbolsNext(pos, &symbol); pos++)
+		symbols.push_back(symbol);
+	std::vector<UserInfo> users;
+	ConGroup group;
+	for(int pos = 0; ExtEmulatorStore.GroupsNext(pos, &group); pos++)
+		users.push_back(GroupUser(server, group));
+
+	CCommissionTable table;
+	int refresh = (std::max)(0, args.GetInt("refresh", 1000));
+	table.SetRefresh(refresh);
+	int rateStale = 0, configStale = 0, unused = 0;
+	std::vector<double> previous = FormulaCommissions(server, symbols, users);
+	int mismatches = CompareTable(server, table, symbols, users, previous, NULL, unused);
+
+	//--- rates move, the table is not told: its commissions lag the rates by the refresh interval at most
+	ExtEmulatorStore.Tick();
+	std::vector<double> expected = FormulaCommissions(server, symbols, users);
+	mismatches += CompareTable(server, table, symbols, users, expected, &previous, rateStale);
+	PlatformSleep(refresh + 10);
+	mismatches += CompareTable(server, table, symbols, users, expected, NULL, unused);
+
+	//--- symbol configuration changes, the table is stale until the refresh interval passes
+	previous = expected;
+	for(size_t s = 0; s < symbols.size(); s++)
+	{
+		symbols[s].contract_size *= 2;
+		ExtEmulatorStore.SymbolsAdd(&symbols[s]);
+	}
+	expected = FormulaCommissions(server, symbols, users);
+	mismatches += CompareTable(server, table, symbols, users, expected, &previous, configStale);
+	//--- the plugin clears the table from the config hook, what it computes next is current
+	table.Clear();
+	mismatches += CompareTable(server, table, symbols, users, expected, NULL, unused);
+
+	double commission = 0.0;
+	Stopwatch watch;
+	for(int i = 0; i < iterations; i++)
+		commission += 2.0 * CCommissionTable::CalculatePointValue(&server, symbols[i % symbols.size()], users[i % users.size()]) * 0.1;
+	double formulaNs = watch.ElapsedUs() * 1000.0 / iterations;
+	watch.Restart();
+	for(int i = 0; i < iterations; i++)
+		commission += table.Commission(&server, symbols[i % symbols.size()], users[i % users.size()], 2.0, 10);
+	double tableNs = watch.ElapsedUs() * 1000.0 / iterations;
+
+	std::cout << "commission symbols=" << symbols.size()
+		<< " groups=" << users.size()
+		<< " entries=" << table.Size()
+		<< " mismatches=" << mismatches
+		<< " rate_stale=" << rateStale
+		<< " config_stale=" << configStale
+		<< " formula_ns=" << formulaNs
+		<< " table_ns=" << tableNs
+		<< " checksum=" << commission << std::endl;
+	return mismatches == 0 ? 0 : 1;
+}
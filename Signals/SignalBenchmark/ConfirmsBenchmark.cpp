@@ -0,0 +1,79 @@
+#include "StdAfx.h"
+#include "Benchmark.h"
+#include "BenchmarkServer.h"
+#include "mt4part/HookScheduler.h"
+#include <algorithm>
+#include <atomic>
+#include <vector>
+#include <iostream>
+
+/// Emulated confirm, records how long after scheduling it actually ran
+struct ProbeHook : Hook
+{
+	ProbeHook(int delay, std::vector<double> *delays, std::atomic<int> *done) : delays(delays), done(done)
+	{
+		this->delay = delay;
+	}
+
+	void Run()
+	{
+		int index = done->fetch_add(1);
+		if(index < (int)delays->size())
+			(*delays)[index] = watch.ElapsedUs() / 1000.0;
+	}
+
+	Stopwatch watch;
+	std::vector<double> *delays;
+	std::atomic<int> *done;
+};
+
+static int ParseLatencyType(const std::string &name)
+{
+	if(name == "uniform")
+		return HookLatencyUniform;
+	if(name == "lognormal")
+		return HookLatencyLognormal;
+	return HookLatencyFixed;
+}
+
+/// Emulated dealer confirms at a steady request rate, reports the delays they really got
+int RunConfirmsBenchmark(const BenchmarkArgs &args)
+{
+	int workers = args.GetInt("workers", 4);
+	int rate = (std::max)(1, args.GetInt("rate", 5000));
+	int requests = args.GetInt("requests", 20000);
+	HookLatency latency;
+	latency.type = ParseLatencyType(args.GetString("latency", "lognormal"));
+	latency.mean = args.GetInt("mean", 50);
+	latency.spread = args.GetInt("spread", 500);
+
+	ExtHookScheduler.SetWorkers(workers);
+	ExtHookScheduler.SetLatency(latency);
+	ExtHookScheduler.ResetStats();
+	BenchmarkServer server;
+
+	std::vector<double> delays(requests);
+	std::atomic<int> done(0);
+	Stopwatch watch;
+	for(int i = 0; i < requests; i++)
+	{
+		//--- pace the requests, the emulator is fed like a busy server
+		while(watch.ElapsedUs() < i * 1000000.0 / rate)
+			PlatformYield();
+		server.InitiateHook(new ProbeHook(ExtHookScheduler.SampleDelay(), &delays, &done));
+	}
+	while(done.load() < requests)
+		PlatformSleep(1);
+	double totalUs = watch.ElapsedUs();
+
+	std::sort(delays.begin(), delays.end());
+	std::cout << "confirms workers=" << workers
+		<< " requests=" << requests
+		<< " confirms_per_sec=" << requests * 1000000.0 / totalUs
+		<< " delay_p50_ms=" << delays[delays.size() / 2]
+		<< " delay_p99_ms=" << delays[delays.size() * 99 / 100]
+		<< " delay_max_ms=" << delays.back()
+		<< " late_avg_us=" << ExtHookScheduler.AverageLateness()
+		<< " late_max_us=" << ExtHookScheduler.MaxLateness() << std::endl;
+	return 0;
+}
@@ -0,0 +1,187 @@
+#include "Platform.h"
+#include "Benchmark.h"
+#include "SignalModule.h"
+#include "proto/Request.pb.h"
+#include "proto/Signal.pb.h"
+#include "proto/SignalMT4Trade.pb.h"
+#include "include/zmq.hpp"
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+#include <iostream>
+
+/// Router side of ZeroMqServer which answers connect signals and drops copies by sequence id
+class FailoverRouter
+{
+public:
+	FailoverRouter(zmq::context_t &context, const std::string &port) :
+		duplicates(0), socket(new zmq::socket_t(context, ZMQ_ROUTER)), lastSequence(0)
+	{
+		int linger = 0;
+		socket->setsockopt(ZMQ_LINGER, &linger, sizeof(linger));
+		socket->bind(("tcp://*:" + port).c_str());
+	}
+
+	~FailoverRouter()
+	{
+		Kill();
+	}
+
+	/// Router process is gone
+	void Kill()
+	{
+		delete socket;
+		socket = NULL;
+	}
+
+	bool Alive() const { return socket != NULL; }
+
+	/// Receive one message, returns the order of a new trade signal, -1 for anything else
+	int Poll(int wait)
+	{
+		if(socket == NULL)
+			return -1;
+		zmq::pollitem_t item = { (void*)*socket, 0, ZMQ_POLLIN, 0 };
+		if(zmq::poll(&item, 1, wait) <= 0)
+			return -1;
+
+		zmq::message_t peer, body;
+		socket->recv(&peer);
+		int more = 0;
+		size_t size = sizeof(more);
+		socket->getsockopt(ZMQ_RCVMORE, &more, &size);
+		if(!more)
+			return -1;
+		socket->recv(&body);
+		ProtoTypes::Signal signal;
+		if(!signal.ParseFromArray(body.data(), (int)body.size()))
+			return -1;
+		if(signal.type() == ProtoTypes::ConnectSignal)
+		{
+			ProtoTypes::Request connected;
+			connected.set_requesttype(ProtoTypes::Connected);
+			connected.set_destination(std::string((char*)peer.data(), peer.size()));
+			std::string message = connected.SerializeAsString();
+			socket->send(peer.data(), peer.size(), ZMQ_SNDMORE);
+			socket->send(message.data(), message.size());
+			return -1;
+		}
+		if(signal.type() != ProtoTypes::TradeSignal)
+			return -1;
+		if(signal.sequenceid() <= lastSequence)
+		{
+			duplicates++;
+			return -1;
+		}
+		lastSequence = signal.sequenceid();
+		ProtoTypes::MT4TradeSignal trade;
+		if(!trade.ParseFromString(signal.content()))
+			return -1;
+		return trade.orderid();
+	}
+
+	unsigned long long duplicates;
+
+private:
+	zmq::socket_t     *socket;
+	unsigned long long lastSequence;
+};
+
+/// Router failover: trade signals at a fixed rate to two routers, the first one dies in the middle.
+/// Outage is the time from the death until a signal sent after it reaches the other router
+int RunFailoverBenchmark(const BenchmarkArgs &args)
+{
+	int port = args.GetInt("port", 2222);
+	int mode = args.GetInt("router_mode", RouterActiveStandby);
+	int heartbeat = args.GetInt("heartbeat", 50);
+	int failover = args.GetInt("failover", 200);
+	int signals = (std::max)(2, args.GetInt("signals", 2000));
+	int rate = (std::max)(1, args.GetInt("rate", 1000));
+	int kill = (std::min)((std::max)(1, args.GetInt("kill", signals / 2)), signals - 1);
+	int drain = args.GetInt("drain", 1000);
+
+	zmq::context_t context(1);
+	FailoverRouter primary(context, std::to_string(port));
+	FailoverRouter backup(context, std::to_string(port + 1));
+
+	SignalModule module;
+	module.Init("127.0.0.1:" + std::to_string(port) + ",127.0.0.1:" + std::to_string(port + 1), std::to_string(port), "Benchmark");
+	module.SetJournal("", 0, 0, 0);
+	module.SetRouters(mode, heartbeat, failover);
+	module.Start();
+
+	MT4TradeSignal signal;
+	signal.Side = TradeSide::Buy;
+	signal.ActionType = ActionType::Open;
+	signal.Symbol = "EURUSD";
+	signal.Server = "Benchmark";
+	signal.Comment = "Failover";
+	signal.Volume = 0.1;
+	std::vector<double> sent(signals, -1), received(signals, -1);
+
+	//--- both routers have to be live before the load starts
+	Stopwatch watch;
+	while(watch.ElapsedUs() < 5000000.0 && module.GetRouterStats().alive < 2)
+	{
+		primary.Poll(1);
+		backup.Poll(1);
+	}
+	watch.Restart();
+	double killedAt = 0, lastReceive = 0;
+	int next = 0;
+	while(next < signals || watch.ElapsedUs() - lastReceive < drain * 1000.0)
+	{
+		double now = watch.ElapsedUs();
+		if(next < signals && now >= next * 1000000.0 / rate)
+		{
+			if(next == kill)
+			{
+				primary.Kill();
+				killedAt = now;
+			}
+			signal.OrderID = next;
+			sent[next] = now;
+			module.SendTradeSignal(signal);
+			next++;
+			continue;
+		}
+		int order = primary.Poll(0);
+		if(order < 0)
+			order = backup.Poll(1);
+		if(order >= 0 && order < signals && received[order] < 0)
+		{
+			lastReceive = watch.ElapsedUs();
+			received[order] = lastReceive;
+		}
+	}
+	RouterStats stats = module.GetRouterStats();
+	module.Stop();
+
+	int lost = 0;
+	double outage = -1, maxLatency = 0;
+	for(int i = 0; i < signals; i++)
+	{
+		if(received[i] < 0)
+		{
+			lost++;
+			continue;
+		}
+		double latency = received[i] - sent[i];
+		maxLatency = (std::max)(maxLatency, latency);
+		if(i >= kill && outage < 0)
+			outage = received[i] - killedAt;
+	}
+
+	std::cout << "failover mode=" << (mode == RouterActiveActive ? "active_active" : "active_standby")
+		<< " signals=" << signals
+		<< " rate=" << rate
+		<< " heartbeat_ms=" << heartbeat
+		<< " failover_ms=" << failover
+		<< " outage_ms=" << outage / 1000.0
+		<< " max_latency_ms=" << maxLatency / 1000.0
+		<< " lost=" << lost
+		<< " router_duplicates=" << primary.duplicates + backup.duplicates
+		<< " failovers=" << stats.failovers
+		<< " resent=" << stats.resent << std::endl;
+	return lost == 0 && outage >= 0 ? 0 : 1;
+}
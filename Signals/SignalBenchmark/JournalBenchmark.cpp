@@ -0,0 +1,122 @@
+#include "Platform.h"
+#include "Benchmark.h"
+#include "SignalCodec.h"
+#include "SignalJournal.h"
+#include "ConcurrentQueue.h"
+#include <deque>
+#include <iostream>
+
+static MT4TradeSignal MakeJournalSignal(int index)
+{
+	MT4TradeSignal signal;
+	signal.Side = index & 1 ? TradeSide::Sell : TradeSide::Buy;
+	signal.ActionType = ActionType::Open;
+	signal.DateTime = 1500000000 + index;
+	signal.Equity = 10000.0 + index;
+	signal.Balance = 10000.0;
+	signal.Volume = 0.1;
+	signal.Symbol = "EURUSD";
+	signal.StopLoss = 1.0950;
+	signal.TakeProfit = 1.1050;
+	signal.Login = 100000 + index % 1000;
+	signal.Server = "Benchmark";
+	signal.OrderID = 1000000 + index;
+	signal.Comment = "Signal_100001_2000001";
+	signal.Profit = 12.5;
+	signal.ProviderCommission = 0.7;
+	return signal;
+}
+
+/// Outbound path of one trade signal: encode, queue, pop for the socket. With a journal every message
+/// is appended before queueing and acknowledged lag messages later, like a socket which is behind
+static double MeasureOutbound(int messages, int lag, SignalJournal *journal)
+{
+	ConcurrentQueue queue;
+	std::deque<unsigned long long> sequences;
+	MT4TradeSignal signal = MakeJournalSignal(1);
+	std::string message;
+	Stopwatch watch;
+	for(int i = 0; i < messages; i++)
+	{
+		signal.OrderID = 1000000 + i;
+		ProtoTypes::MT4TradeSignal proto;
+		SignalCodec::MT4TradeSignalToProto(signal, proto);
+		SignalCodec::BuildSignal(ProtoTypes::TradeSignal, "Benchmark", proto.SerializeAsString(), message);
+		if(journal != NULL)
+			sequences.push_back(journal->Append(JournalOutbound, message));
+		queue.Push(message);
+		if(i < lag)
+			continue;
+		message = queue.Pop();
+		if(journal != NULL)
+		{
+			journal->Acknowledge(JournalOutbound, sequences.front());
+			sequences.pop_front();
+		}
+	}
+	return watch.ElapsedUs() * 1000.0 / messages;
+}
+
+/// Journal overhead on the outbound path against a budget, then crash replay of pending messages
+int RunJournalBenchmark(const BenchmarkArgs &args)
+{
+	int messages = (std::max)(1, args.GetInt("messages", 200000));
+	int lag = (std::max)(0, args.GetInt("lag", 1000));
+	int budget = args.GetInt("budget", 100);
+	JournalSettings settings;
+	settings.path = args.GetString("path", "benchmark.journal");
+	settings.size = args.GetInt("size", 64);
+	settings.commitInterval = args.GetInt("interval", 10);
+	remove(settings.path.c_str());
+
+	int rounds = (std::max)(1, args.GetInt("rounds", 5));
+
+	SignalJournal journal;
+	if(!journal.Open(settings))
+	{
+		std::cout << "journal can not open " << settings.path << std::endl;
+		return 1;
+	}
+	//--- warm up, then alternate both paths and keep the best round of each, single runs are noisy
+	MeasureOutbound((std::min)(messages, 10000), lag, NULL);
+	double baseline = 0, journaled = 0;
+	for(int i = 0; i < rounds; i++)
+	{
+		double value = MeasureOutbound(messages, lag, NULL);
+		baseline = i == 0 ? value : (std::min)(baseline, value);
+		value = MeasureOutbound(messages, lag, &journal);
+		journaled = i == 0 ? value : (std::min)(journaled, value);
+	}
+	unsigned long long commits = journal.Commits();
+	unsigned long long dropped = journal.Dropped();
+
+	//--- lag messages of every round stay pending, reopening stands in for a restart
+	size_t pending = journal.Pending();
+	journal.Close();
+	Stopwatch watch;
+	size_t replayed = 0;
+	if(journal.Open(settings))
+		journal.Replay([&](int, unsigned long long, time_t, std::string&) { replayed++; });
+	double replayUs = watch.ElapsedUs();
+	journal.Close();
+	remove(settings.path.c_str());
+
+	double overhead = (journaled - baseline) * 100.0 / baseline;
+	bool within = overhead <= budget;
+	std::cout << "journal messages=" << messages
+		<< " lag=" << lag
+		<< " rounds=" << rounds
+		<< " interval_ms=" << settings.commitInterval
+		<< " baseline_ns_per_msg=" << baseline
+		<< " journal_ns_per_msg=" << journaled
+		<< " overhead_pct=" << overhead
+		<< " budget_pct=" << budget
+		<< " within_budget=" << (within ? 1 : 0)
+		<< " commits=" << commits
+		<< " msgs_per_commit=" << (commits > 0 ? (double)messages * rounds / commits : 0)
+		<< " dropped=" << dropped
+		<< " pending=" << pending
+		<< " replayed=" << replayed
+		<< " replay_us=" << replayUs << std::endl;
+	return within && replayed == pending ? 0 : 1;
+}
@@ -0,0 +1,135 @@
+#include "StdAfx.h"
+#include "Benchmark.h"
+#include "mt4part/Processor.h"
+#include "BenchmarkServer.h"
+#include "mt4part/EmulatorStore.h"
+#include <atomic>
+#include <vector>
+#include <iostream>
+
+/// Emulated server counting margin calculations
+class MassCloseServer : public BenchmarkServer
+{
+public:
+	MassCloseServer() :
+		marginCalls(0)
+	{
+	}
+
+	int __stdcall TradesMarginInfo(UserInfo *user, double *margin, double *freemargin, double *equity)
+	{
+		marginCalls.fetch_add(1);
+		return BenchmarkServer::TradesMarginInfo(user, margin, freemargin, equity);
+	}
+
+	int MarginCalls() { return marginCalls.exchange(0); }
+
+private:
+	std::atomic<int> marginCalls;
+};
+
+struct MassCloseResult
+{
+	double callbackUs;
+	double drainUs;
+	int    marginCalls;
+};
+
+static void OpenPositions(int accounts, int positions)
+{
+	for(int a = 0; a < accounts; a++)
+	{
+		for(int p = 0; p < positions; p++)
+		{
+			TradeRecord trade = {0};
+			trade.login = 100000 + a;
+			trade.cmd = p % 2 == 0 ? OP_BUY : OP_SELL;
+			trade.volume = 10;
+			trade.open_price = 1.10000;
+			COPY_STR(trade.symbol, "EURUSD");
+			ExtEmulatorStore.OrdersAdd(&trade, NULL);
+		}
+	}
+}
+
+static MassCloseResult RunMassClose(MassCloseServer &server, int accounts, int positions)
+{
+	//--- positions are opened quietly, only the stop-out reaches the plugin
+	UnsubscribeProcessorFromEmulator();
+	OpenPositions(accounts, positions);
+	SubscribeProcessorOnEmulator();
+
+	std::vector<TradeRecord> trades;
+	for(int a = 0; a < accounts; a++)
+	{
+		int total = 0;
+		TradeRecord *open = ExtEmulatorStore.OrdersGetOpen(100000 + a, &total);
+		trades.insert(trades.end(), open, open + total);
+		HEAP_FREE(open);
+	}
+
+	MassCloseResult result;
+	unsigned long long target = processor.TradesProcessed() + processor.TradesDropped() + trades.size();
+	Stopwatch watch;
+	//--- stop-out of every account: positions are closed one account after another
+	for(size_t i = 0; i < trades.size(); i++)
+	{
+		TradeTransInfo trans = {0};
+		trans.order = trades[i].order;
+		trans.volume = trades[i].volume;
+		server.OrdersClose(&trans, NULL);
+	}
+	result.callbackUs = watch.ElapsedUs();
+
+	while(processor.TradesProcessed() + processor.TradesDropped() < target)
+		PlatformSleep(0);
+	result.drainUs = watch.ElapsedUs();
+	result.marginCalls = server.MarginCalls();
+	return result;
+}
+
+int RunMassCloseBenchmark(const BenchmarkArgs &args)
+{
+	int positions = args.GetInt("positions", 200);
+	int accounts = args.GetInt("accounts", 1);
+	int iterations = args.GetInt("iterations", 10);
+	int window = args.GetInt("window", 100);
+
+	EmulatorDataset dataset;
+	dataset.accounts = accounts;
+	dataset.orders = 0;
+	ExtEmulatorStore.Generate(dataset);
+
+	MassCloseServer server;
+	processor.SetServerInterface(&server);
+
+	int windows[] = { 0, window };
+	for(int w = 0; w < 2; w++)
+	{
+		ApplyBenchmarkSettings(args, windows[w]);
+		//--- warm up
+		RunMassClose(server, accounts, positions);
+
+		double callbackUs = 0.0, drainUs = 0.0;
+		int marginCalls = 0;
+		for(int i = 0; i < iterations; i++)
+		{
+			MassCloseResult result = RunMassClose(server, accounts, positions);
+			callbackUs += result.callbackUs;
+			drainUs += result.drainUs;
+			marginCalls += result.marginCalls;
+		}
+
+		int signals = accounts * positions;
+		std::cout << "massclose window=" << windows[w]
+			<< " signals=" << signals
+			<< " callback_us=" << callbackUs / iterations
+			<< " drain_us=" << drainUs / iterations
+			<< " signals_per_sec=" << signals * 1000000.0 / (drainUs / iterations)
+			<< " margin_calls=" << (double)marginCalls / iterations << std::endl;
+	}
+
+	UnsubscribeProcessorFromEmulator();
+	processor.Clear();
+	return 0;
+}
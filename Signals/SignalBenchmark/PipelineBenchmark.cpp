@@ -0,0 +1,86 @@
+#include "StdAfx.h"
+#include "Benchmark.h"
+#include "mt4part/Processor.h"
+#include "BenchmarkServer.h"
+#include "mt4part/EmulatorStore.h"
+#include <vector>
+#include <iostream>
+
+/// Whole plugin against a synthetic server: random opens and closes go through the emulator trade hooks
+int RunPipelineBenchmark(const BenchmarkArgs &args)
+{
+	EmulatorDataset dataset;
+	dataset.accounts = args.GetInt("accounts", 100000);
+	dataset.orders = args.GetInt("orders", 1000000);
+	dataset.groups = args.GetInt("groups", 10);
+	dataset.seed = args.GetInt("seed", 1);
+	int operations = args.GetInt("operations", 100000);
+
+	Stopwatch watch;
+	ExtEmulatorStore.Generate(dataset);
+	std::cout << "pipeline generate accounts=" << dataset.accounts << " orders=" << ExtEmulatorStore.OrdersTotal()
+		<< " us=" << watch.ElapsedUs() << std::endl;
+
+	BenchmarkServer server;
+	processor.SetServerInterface(&server);
+	ApplyBenchmarkSettings(args, args.GetInt("window", 100));
+	SubscribeProcessorOnEmulator();
+
+	const char *symbols[] = { "EURUSD", "GBPUSD", "USDJPY", "EURGBP" };
+	unsigned int seed = dataset.seed * 7919 + 1;
+	unsigned long long target = processor.TradesProcessed() + processor.TradesDropped();
+	int opened = 0, closed = 0;
+
+	watch.Restart();
+	for(int i = 0; i < operations; i++)
+	{
+		seed = seed * 1103515245 + 12345;
+		int login = 100000 + (seed >> 8) % dataset.accounts;
+		UserRecord record;
+		if(server.ClientsUserInfo(login, &record) == FALSE)
+			continue;
+		UserInfo ui = BaseExecutionSignal::UserInfoLoad(login, &server);
+
+		int total = 0;
+		TradeRecord *open = (seed & 1) ? server.OrdersGetOpen(&ui, &total) : NULL;
+		if(total > 0)
+		{
+			TradeTransInfo trans = {0};
+			trans.order = open[(seed >> 4) % total].order;
+			if(server.OrdersClose(&trans, &ui))
+				closed++;
+		}
+		else
+		{
+			TradeTransInfo trans = {0};
+			trans.cmd = (seed >> 3) & 1 ? OP_BUY : OP_SELL;
+			trans.volume = 1 + (seed >> 12) % 100;
+			COPY_STR(trans.symbol, symbols[(seed >> 16) % 4]);
+			if(server.OrdersOpen(&trans, &ui) != 0)
+				opened++;
+		}
+		if(open != NULL)
+			HEAP_FREE(open);
+		if(i % 1000 == 0)
+			ExtEmulatorStore.Tick();
+	}
+	double callbackUs = watch.ElapsedUs();
+
+	target += opened + closed;
+	while(processor.TradesProcessed() + processor.TradesDropped() < target)
+		PlatformSleep(0);
+	double drainUs = watch.ElapsedUs();
+
+	std::cout << "pipeline operations=" << operations
+		<< " opened=" << opened
+		<< " closed=" << closed
+		<< " spilled=" << processor.TradesSpilled()
+		<< " dropped=" << processor.TradesDropped()
+		<< " callback_us=" << callbackUs
+		<< " drain_us=" << drainUs
+		<< " signals_per_sec=" << (opened + closed) * 1000000.0 / drainUs << std::endl;
+
+	UnsubscribeProcessorFromEmulator();
+	processor.Clear();
+	return 0;
+}
@@ -0,0 +1,189 @@
+#include "StdAfx.h"
+#include "Benchmark.h"
+#include "OpenBatch.h"
+#include "mt4part/EquityCache.h"
+#include "BenchmarkServer.h"
+#include "mt4part/EmulatorStore.h"
+#include <algorithm>
+#include <atomic>
+#include <vector>
+#include <iostream>
+
+/// Largest order of the groups, hundredths of a lot
+#define PREVALIDATE_LOT_MAX 5000
+
+/// Emulated server with lot limits of the groups and a margin check which costs time
+class PrevalidateServer : public BenchmarkServer
+{
+public:
+	PrevalidateServer(int checkUs) :
+		checkUs(checkUs), checks(0)
+	{
+	}
+
+	int __stdcall GroupsGet(LPCSTR name, ConGroup *group)
+	{
+		int res = BenchmarkServer::GroupsGet(name, group);
+		//--- from 0.01 to 50 lots by 0.01
+		for(int i = 0; i < MAX_SEC_GROUPS; i++)
+		{
+			group->secgroups[i].lot_min = 1;
+			group->secgroups[i].lot_step = 1;
+			group->secgroups[i].lot_max = PREVALIDATE_LOT_MAX;
+		}
+		return res;
+	}
+
+	double __stdcall TradesMarginCheck(const UserInfo *user, const TradeTransInfo *trade, double *profit, double *freemargin, double *new_margin)
+	{
+		checks.fetch_add(1);
+		Stopwatch watch;
+		while(checkUs > 0 && watch.ElapsedUs() < checkUs)
+			;
+		double margin = 0, free = 0, equity = 0;
+		ExtEmulatorStore.MarginInfo(user->login, &margin, &free, &equity);
+		//--- margin of the order in the base currency converted to the deposit currency
+		ConSymbol symbol = {0};
+		ExtEmulatorStore.SymbolsGet(trade->symbol, &symbol);
+		double added = 0.01 * trade->volume * symbol.contract_size / (user->leverage > 0 ? user->leverage : 1) *
+			ExtEmulatorStore.CalcRates(symbol.margin_currency, user->grp.currency);
+		*profit = 0;
+		*freemargin = free - added;
+		*new_margin = margin + added;
+		return margin;
+	}
+
+	int Checks() { return checks.exchange(0); }
+
+private:
+	int checkUs;
+	std::atomic<int> checks;
+};
+
+/// Open orders of signal fan-out validated order by order and in one pass over the whole signal:
+/// volumes of both must agree, and every order rejected by the pass must be rejected by the margin check
+int RunPrevalidateBenchmark(const BenchmarkArgs &args)
+{
+	int subscribers = (std::max)(1, args.GetInt("subscribers", 1000));
+	int signals = (std::max)(1, args.GetInt("signals", 100));
+	int checkUs = (std::max)(0, args.GetInt("check_us", 2));
+
+	EmulatorDataset dataset;
+	dataset.accounts = subscribers;
+	dataset.orders = 0;
+	ExtEmulatorStore.Generate(dataset);
+
+	PrevalidateServer server(checkUs);
+	std::vector<ConSymbol> symbols;
+	ConSymbol symbol;
+	for(int pos = 0; ExtEmulatorStore.SymbolsNext(pos, &symbol); pos++)
+		symbols.push_back(symbol);
+
+	//--- the accounts were seen within the burst window, none of them has positions
+	CEquityCache equities;
+	equities.SetWindow(3600 * 1000);
+	for(int i = 0; i < subscribers; i++)
+	{
+		UserInfo ui = BaseExecutionSignal::UserInfoLoad(100000 + i, &server);
+		EquitySnapshot snapshot;
+		server.TradesMarginInfo(&ui, &snapshot.margin, &snapshot.free_margin, &snapshot.equity);
+		equities.Put(ui.login, snapshot);
+	}
+
+	unsigned int seed = 7919;
+	double objectUs = 0, batchUs = 0, computeUs = 0;
+	long long objectChecks = 0, batchChecks = 0, orders = 0, rejected = 0;
+	int mismatches = 0, wrongRejects = 0;
+	std::vector<double> volumes(subscribers);
+	std::vector<int> objectVolumes(subscribers);
+	for(int s = 0; s < signals; s++)
+	{
+		//--- subscribers copy with lots per unit of balance, small ones fall under the lot and large ones have no money
+		const ConSymbol &traded = symbols[s % symbols.size()];
+		int cmd = (s & 1) ? OP_SELL : OP_BUY;
+		for(int i = 0; i < subscribers; i++)
+		{
+			seed = seed * 1103515245 + 12345;
+			volumes[i] = -0.000001 * (1 + (seed >> 8) % 2000);
+		}
+
+		Stopwatch watch;
+		for(int i = 0; i < subscribers; i++)
+		{
+			OpenOrderSignal request(100000 + i, traded.symbol, volumes[i], cmd, "bench", &server, 0.0, NULL, NULL);
+			objectVolumes[i] = request.Volume();
+			//--- the volume check of the server rejects the rest before the margin check
+			if(request.Volume() > 0 && request.Volume() <= PREVALIDATE_LOT_MAX)
+			{
+				TradeTransInfo trans = {0};
+				trans.cmd = cmd;
+				trans.volume = request.Volume();
+				COPY_STR(trans.symbol, traded.symbol);
+				UserInfo ui = BaseExecutionSignal::UserInfoLoad(100000 + i, &server);
+				double profit, freemargin, prevmargin;
+				server.TradesMarginCheck(&ui, &trans, &profit, &freemargin, &prevmargin);
+			}
+		}
+		objectUs += watch.ElapsedUs();
+		objectChecks += server.Checks();
+
+		watch.Restart();
+		OpenBatch batch(&server, NULL, NULL, &equities);
+		for(int i = 0; i < subscribers; i++)
+			batch.Add(100000 + i, traded.symbol, volumes[i], cmd, 0.0);
+		batch.Prepare();
+		const OpenBatchArrays &arrays = batch.Arrays();
+		for(int i = 0; i < subscribers; i++)
+		{
+			if(arrays.verdict[i] != OpenPrecheckPassed)
+				continue;
+			TradeTransInfo trans = {0};
+			trans.cmd = cmd;
+			trans.volume = arrays.volume[i];
+			COPY_STR(trans.symbol, traded.symbol);
+			UserInfo ui = BaseExecutionSignal::UserInfoLoad(100000 + i, &server);
+			double profit, freemargin, prevmargin;
+			server.TradesMarginCheck(&ui, &trans, &profit, &freemargin, &prevmargin);
+		}
+		batchUs += watch.ElapsedUs();
+		batchChecks += server.Checks();
+
+		//--- the pass alone over a copy of the gathered arrays
+		OpenBatchArrays copy = arrays;
+		Stopwatch compute;
+		copy.Compute();
+		computeUs += compute.ElapsedUs();
+
+		for(int i = 0; i < subscribers; i++)
+		{
+			if(arrays.volume[i] != objectVolumes[i])
+				mismatches++;
+			if(arrays.verdict[i] != OpenPrecheckNoMoney)
+				continue;
+			rejected++;
+			//--- the server must agree that the order has no money
+			TradeTransInfo trans = {0};
+			trans.cmd = cmd;
+			trans.volume = arrays.volume[i];
+			COPY_STR(trans.symbol, traded.symbol);
+			UserInfo ui = BaseExecutionSignal::UserInfoLoad(100000 + i, &server);
+			double profit, freemargin, prevmargin;
+			server.TradesMarginCheck(&ui, &trans, &profit, &freemargin, &prevmargin);
+			if(freemargin + ui.grp.credit >= 0)
+				wrongRejects++;
+		}
+		server.Checks();
+		orders += subscribers;
+	}
+
+	std::cout << "prevalidate orders=" << orders
+		<< " no_money=" << rejected
+		<< " object_ns=" << objectUs * 1000.0 / orders
+		<< " batch_ns=" << batchUs * 1000.0 / orders
+		<< " compute_ns=" << computeUs * 1000.0 / orders
+		<< " object_margin_checks=" << objectChecks
+		<< " batch_margin_checks=" << batchChecks
+		<< " volume_mismatches=" << mismatches
+		<< " wrong_rejects=" << wrongRejects << std::endl;
+	return 0;
+}
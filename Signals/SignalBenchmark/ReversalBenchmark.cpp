@@ -0,0 +1,110 @@
+#include "StdAfx.h"
+#include "Benchmark.h"
+#include "mt4part/Processor.h"
+#include "BenchmarkServer.h"
+#include "mt4part/EmulatorStore.h"
+#include <algorithm>
+#include <vector>
+#include <iostream>
+
+/// Ticket of the only open position of the account, 0 when it is flat or holds more
+static int SinglePosition(BenchmarkServer &server, int login, int *cmd)
+{
+	UserInfo ui = BaseExecutionSignal::UserInfoLoad(login, &server);
+	int total = 0;
+	TradeRecord *trades = server.OrdersGetOpen(&ui, &total);
+	int ticket = total == 1 ? trades[0].order : 0;
+	if(ticket != 0)
+		*cmd = trades[0].cmd;
+	if(trades != NULL)
+		HEAP_FREE(trades);
+	return ticket;
+}
+
+/// Provider reversing its position: every signal closes the position of each subscriber and opens the other side.
+/// The position holds most of the margin, the open passes the margin check only after the close of the same signal
+int RunReversalBenchmark(const BenchmarkArgs &args)
+{
+	int subscribers = (std::max)(1, args.GetInt("subscribers", 100));
+	int signals = (std::max)(1, args.GetInt("signals", 10));
+	int marginPercent = (std::min)(99, (std::max)(51, args.GetInt("margin", 70)));
+	bool openFirst = args.GetInt("open_first", 0) > 0;
+
+	EmulatorDataset dataset;
+	dataset.accounts = subscribers;
+	dataset.orders = 0;
+	ExtEmulatorStore.Generate(dataset);
+
+	BenchmarkServer server;
+	processor.SetServerInterface(&server);
+	ApplyBenchmarkSettings(args, 0, true);
+
+	//--- one lot of EURUSD per account, the balance leaves room for one position only
+	std::vector<int> tickets(subscribers);
+	std::vector<int> sides(subscribers, OP_BUY);
+	for(int i = 0; i < subscribers; i++)
+	{
+		UserInfo ui = BaseExecutionSignal::UserInfoLoad(100000 + i, &server);
+		TradeTransInfo trans = {0};
+		trans.cmd = OP_BUY;
+		trans.volume = 100;
+		COPY_STR(trans.symbol, "EURUSD");
+		tickets[i] = server.OrdersOpen(&trans, &ui);
+		double margin = 0, free = 0, equity = 0;
+		server.TradesMarginInfo(&ui, &margin, &free, &equity);
+		UserRecord user;
+		ExtEmulatorStore.UsersGet(ui.login, &user);
+		user.balance += margin * 100.0 / marginPercent - equity;
+		ExtEmulatorStore.UsersAdd(&user);
+	}
+
+	double signalUs = 0;
+	long long reversed = 0, rejected = 0, broken = 0;
+	for(int s = 0; s < signals; s++)
+	{
+		ExecutionSignal signal;
+		char comment[32];
+		sprintf_s(comment, 32, "Reversal_%d", s);
+		signal.comment = comment;
+		for(int i = 0; i < subscribers; i++)
+		{
+			ExecutionOrder close = { 100000 + i, ActionType::Close, TradeSide::Buy, 0.0, "EURUSD", tickets[i], 0.0 };
+			ExecutionOrder open = { 100000 + i, ActionType::Open, sides[i] == OP_BUY ? TradeSide::Sell : TradeSide::Buy,
+				1.0, "EURUSD", s * subscribers + i + 1, 0.0 };
+			signal.Orders.push_back(openFirst ? open : close);
+			signal.Orders.push_back(openFirst ? close : open);
+		}
+
+		Stopwatch watch;
+		processor.OnExecuteSignalRequest(signal);
+		signalUs += watch.ElapsedUs();
+
+		for(int i = 0; i < subscribers; i++)
+		{
+			int cmd = OP_BUY;
+			int ticket = SinglePosition(server, 100000 + i, &cmd);
+			if(ticket != 0 && ticket != tickets[i] && cmd != sides[i])
+			{
+				reversed++;
+				tickets[i] = ticket;
+				sides[i] = cmd;
+				continue;
+			}
+			//--- the close went through and the open was refused, the next signal can not reverse this account
+			if(ticket == 0)
+				rejected++;
+			else
+				broken++;
+		}
+	}
+
+	std::cout << "reversal orders=" << 2LL * subscribers * signals
+		<< " open_first=" << openFirst
+		<< " reversed=" << reversed
+		<< " rejected=" << rejected
+		<< " broken=" << broken
+		<< " signal_us=" << signalUs / signals << std::endl;
+
+	processor.Clear();
+	return 0;
+}
@@ -0,0 +1,356 @@
+#include "StdAfx.h"
+#include "Benchmark.h"
+#include "mt4part/Processor.h"
+#include "BenchmarkServer.h"
+#include "mt4part/EmulatorStore.h"
+#include "proto/Request.pb.h"
+#include "proto/RequestExecution.pb.h"
+#include "proto/RequestOrdersStatus.pb.h"
+#include "proto/Signal.pb.h"
+#include "proto/SignalMT4Trade.pb.h"
+#include "proto/SignalExecutionReport.pb.h"
+#include "include/zmq.hpp"
+#include <algorithm>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+#include <iostream>
+
+#define ROUTER_LOAD_COMMENT "LG"
+
+static const char *ExtLoadSymbols[] = { "EURUSD", "GBPUSD", "USDJPY", "USDCHF", "AUDUSD", "USDCAD", "NZDUSD", "EURGBP", "EURJPY", "GBPJPY" };
+
+/// Router side of ZeroMqServer: one ROUTER socket, the plugin's dealer is the only peer
+class RouterLoad
+{
+public:
+	RouterLoad(const BenchmarkArgs &args) :
+		executionOrders(0), reportedOrders(0), failedOrders(0), checkTime(0), executeTime(0), context(1), socket(context, ZMQ_ROUTER), seed(args.GetInt("seed", 1) * 7919 + 1)
+	{
+		accounts = (std::max)(1, args.GetInt("accounts", 1000));
+		symbols = (std::min)((std::max)(1, args.GetInt("symbols", 4)), (int)(sizeof(ExtLoadSymbols) / sizeof(ExtLoadSymbols[0])));
+		ordersPerSignal = (std::max)(1, args.GetInt("orders_per_signal", 10));
+		closePercent = (std::min)((std::max)(0, args.GetInt("close", 30)), 100);
+		statusEvery = (std::max)(0, args.GetInt("status_every", 10));
+		statusLogins = (std::max)(1, args.GetInt("status_logins", 50));
+		volume = args.GetInt("volume", 10) / 100.0;
+
+		int linger = 0;
+		socket.setsockopt(ZMQ_LINGER, &linger, sizeof(linger));
+		socket.bind(("tcp://*:" + args.GetString("port", "2222")).c_str());
+	}
+
+	/// Wait for the dealer connect signal, remember its identity
+	bool WaitConnect(int timeout)
+	{
+		Stopwatch watch;
+		while(watch.ElapsedUs() < timeout * 1000.0)
+		{
+			ProtoTypes::Signal signal;
+			if(Receive(signal, 10) && signal.type() == ProtoTypes::ConnectSignal)
+				return true;
+		}
+		return false;
+	}
+
+	/// Execution signal of random logins, opens new positions or closes the known ones
+	void SendExecution(int id, double now)
+	{
+		ProtoTypes::ExecutionSignal signal;
+		char comment[32];
+		_snprintf_s(comment, sizeof(comment), _TRUNCATE, ROUTER_LOAD_COMMENT "%d", id);
+		signal.set_comment(comment);
+		signal.set_destination(identity);
+
+		bool closing = closePercent > 0 && Next() % 100 < (unsigned int)closePercent && open.size() >= (size_t)ordersPerSignal;
+		const char *symbol = ExtLoadSymbols[Next() % symbols];
+		ProtoTypes::TradeSide side = (Next() & 1) ? ProtoTypes::Buy : ProtoTypes::Sell;
+		//--- one order per subscriber login, like the router sends
+		unsigned int first = Next();
+		for(int i = 0; i < ordersPerSignal; i++)
+		{
+			ProtoTypes::ExecutionOrder *order = signal.add_orders();
+			if(closing)
+			{
+				//--- close a random known position
+				size_t index = Next() % open.size();
+				std::pair<int, int> position = open[index];
+				open[index] = open.back();
+				open.pop_back();
+				order->set_login(position.second);
+				order->set_orderid(position.first);
+				order->set_actiontype(ProtoTypes::Close);
+				order->set_side(side);
+				order->set_symbol(symbol);
+				order->set_volume(volume);
+				order->set_commission(0);
+				closeSent[position.first] = now;
+			}
+			else
+			{
+				order->set_login(100000 + (first + i) % accounts);
+				order->set_actiontype(ProtoTypes::Open);
+				order->set_side(side);
+				order->set_symbol(symbol);
+				order->set_volume(volume);
+				order->set_commission(0);
+			}
+		}
+		if(!closing)
+			openSent[id] = now;
+		reportSent[id] = now;
+		executionOrders += ordersPerSignal;
+		Send(ProtoTypes::ExecutionRequestType, signal.SerializeAsString());
+	}
+
+	/// Orders status request of random logins
+	void SendStatus(double now)
+	{
+		ProtoTypes::OrdersStatusRequest request;
+		for(int i = 0; i < statusLogins; i++)
+			request.add_logins(100000 + Next() % accounts);
+		statusSent.push_back(now);
+		Send(ProtoTypes::OrderStatusRequestType, request.SerializeAsString());
+	}
+
+	/// Receive one signal and match it with its request, false when nothing arrived in wait ms
+	bool Poll(int wait, double now)
+	{
+		ProtoTypes::Signal signal;
+		if(!Receive(signal, wait))
+			return false;
+
+		switch(signal.type())
+		{
+			case ProtoTypes::TradeSignal:
+			{
+				ProtoTypes::MT4TradeSignal trade;
+				if(!trade.ParseFromString(signal.content()))
+					break;
+				if(trade.actiontype() == ProtoTypes::Open)
+				{
+					const std::string &comment = trade.comment();
+					if(comment.compare(0, sizeof(ROUTER_LOAD_COMMENT) - 1, ROUTER_LOAD_COMMENT) != 0)
+						break;
+					auto it = openSent.find(atoi(comment.c_str() + sizeof(ROUTER_LOAD_COMMENT) - 1));
+					if(it == openSent.end())
+						break;
+					openLatency.push_back(now - it->second);
+					open.push_back(std::make_pair(trade.orderid(), trade.login()));
+				}
+				else
+				{
+					auto it = closeSent.find(trade.orderid());
+					if(it == closeSent.end())
+						break;
+					closeLatency.push_back(now - it->second);
+					closeSent.erase(it);
+				}
+				break;
+			}
+			case ProtoTypes::ExecutionReport:
+			{
+				ProtoTypes::ExecutionSignalReport report;
+				if(!report.ParseFromString(signal.content()))
+					break;
+				const std::string &comment = report.comment();
+				if(comment.compare(0, sizeof(ROUTER_LOAD_COMMENT) - 1, ROUTER_LOAD_COMMENT) != 0)
+					break;
+				//--- the first report of a signal has all its orders, dealer answers follow one by one
+				auto it = reportSent.find(atoi(comment.c_str() + sizeof(ROUTER_LOAD_COMMENT) - 1));
+				if(it == reportSent.end())
+					break;
+				reportLatency.push_back(now - it->second);
+				reportSent.erase(it);
+				for(int i = 0; i < report.orders_size(); i++)
+				{
+					const ProtoTypes::ExecutionOrderReport &order = report.orders(i);
+					reportedOrders++;
+					if(order.result() != ProtoTypes::ResultExecuted && order.result() != ProtoTypes::ResultRequestAdded)
+						failedOrders++;
+					checkTime += order.checktime();
+					executeTime += order.executetime();
+				}
+				break;
+			}
+			case ProtoTypes::SignalOrdersStatus:
+				//--- the plugin answers status requests in order
+				if(!statusSent.empty())
+				{
+					statusLatency.push_back(now - statusSent.front());
+					statusSent.pop_front();
+				}
+				break;
+			default:
+				break;
+		}
+		return true;
+	}
+
+	std::vector<double> openLatency;
+	std::vector<double> closeLatency;
+	std::vector<double> statusLatency;
+	std::vector<double> reportLatency;
+	unsigned long long  executionOrders;
+	/// Orders of the execution reports, the failed ones and microseconds the plugin spent in their checks and execution
+	unsigned long long  reportedOrders;
+	unsigned long long  failedOrders;
+	long long           checkTime;
+	long long           executeTime;
+	int statusEvery;
+
+private:
+	unsigned int Next()
+	{
+		seed = seed * 1103515245 + 12345;
+		return seed >> 8;
+	}
+
+	void Send(ProtoTypes::RequestType type, const std::string &content)
+	{
+		ProtoTypes::Request request;
+		request.set_requesttype(type);
+		request.set_destination(identity);
+		request.set_content(content);
+		std::string message = request.SerializeAsString();
+		socket.send(identity.data(), identity.size(), ZMQ_SNDMORE);
+		socket.send(message.data(), message.size());
+	}
+
+	bool Receive(ProtoTypes::Signal &signal, int wait)
+	{
+		zmq::pollitem_t item = { (void*)socket, 0, ZMQ_POLLIN, 0 };
+		if(zmq::poll(&item, 1, wait) <= 0)
+			return false;
+
+		zmq::message_t peer, body;
+		socket.recv(&peer);
+		int more = 0;
+		size_t size = sizeof(more);
+		socket.getsockopt(ZMQ_RCVMORE, &more, &size);
+		if(!more)
+			return false;
+		socket.recv(&body);
+		identity.assign((char*)peer.data(), peer.size());
+		return signal.ParseFromArray(body.data(), (int)body.size());
+	}
+
+	zmq::context_t context;
+	zmq::socket_t  socket;
+	std::string    identity;
+	unsigned int   seed;
+
+	int    accounts;
+	int    symbols;
+	int    ordersPerSignal;
+	int    closePercent;
+	int    statusLogins;
+	double volume;
+
+	std::unordered_map<int, double> openSent;
+	std::unordered_map<int, double> closeSent;
+	std::deque<double> statusSent;
+	std::unordered_map<int, double> reportSent;
+	/// Positions opened by the load, order and login
+	std::vector<std::pair<int, int> > open;
+};
+
+static void PrintPercentiles(const char *name, std::vector<double> &values)
+{
+	if(values.empty())
+	{
+		std::cout << " " << name << "_count=0";
+		return;
+	}
+	std::sort(values.begin(), values.end());
+	std::cout << " " << name << "_count=" << values.size()
+		<< " " << name << "_p50_us=" << values[values.size() / 2]
+		<< " " << name << "_p90_us=" << values[values.size() * 90 / 100]
+		<< " " << name << "_p99_us=" << values[values.size() * 99 / 100]
+		<< " " << name << "_max_us=" << values.back();
+}
+
+/// Router load: execution signals and status requests over the real dealer connection, latency to the answering signal
+int RunRouterLoadBenchmark(const BenchmarkArgs &args)
+{
+	EmulatorDataset dataset;
+	dataset.accounts = args.GetInt("accounts", 1000);
+	dataset.orders = args.GetInt("orders", 10000);
+	dataset.groups = args.GetInt("groups", 4);
+	dataset.seed = args.GetInt("seed", 1);
+	int signals = args.GetInt("signals", 10000);
+	int rate = (std::max)(1, args.GetInt("rate", 1000));
+	int burst = (std::max)(1, args.GetInt("burst", 1));
+	int drain = args.GetInt("drain", 5000);
+	ExtEmulatorStore.Generate(dataset);
+
+	RouterLoad load(args);
+	BenchmarkServer server;
+	processor.SetServerInterface(&server);
+	ApplyBenchmarkSettings(args, args.GetInt("window", 100), args.GetInt("auto", 1) != 0);
+	SubscribeProcessorOnEmulator();
+
+	if(!load.WaitConnect(args.GetInt("connect_timeout", 5000)))
+	{
+		std::cout << "router plugin did not connect" << std::endl;
+		UnsubscribeProcessorFromEmulator();
+		processor.Clear();
+		return 1;
+	}
+
+	//--- bursts of signals, spaced so that the average stays at rate signals per second
+	Stopwatch watch;
+	double nextBurst = 0, lastReceive = 0;
+	int sent = 0;
+	while(sent < signals || watch.ElapsedUs() - lastReceive < drain * 1000.0)
+	{
+		double now = watch.ElapsedUs();
+		if(sent < signals && now >= nextBurst)
+		{
+			for(int i = 0; i < burst && sent < signals; i++, sent++)
+			{
+				load.SendExecution(sent, now);
+				if(load.statusEvery > 0 && sent % load.statusEvery == 0)
+					load.SendStatus(now);
+			}
+			nextBurst += burst * 1000000.0 / rate;
+			lastReceive = now;
+			continue;
+		}
+		int wait = sent < signals ? (std::max)(0, (std::min)(10, (int)((nextBurst - now) / 1000))) : 10;
+		while(load.Poll(wait, watch.ElapsedUs()))
+		{
+			lastReceive = watch.ElapsedUs();
+			wait = 0;
+		}
+	}
+	double totalUs = lastReceive;
+
+	std::cout << "router signals=" << signals
+		<< " orders=" << load.executionOrders
+		<< " rate=" << rate
+		<< " burst=" << burst
+		<< " trade_signals_per_sec=" << (load.openLatency.size() + load.closeLatency.size()) * 1000000.0 / totalUs;
+	PrintPercentiles("open", load.openLatency);
+	PrintPercentiles("close", load.closeLatency);
+	PrintPercentiles("status", load.statusLatency);
+	PrintPercentiles("report", load.reportLatency);
+	std::cout << " reported_orders=" << load.reportedOrders
+		<< " failed_orders=" << load.failedOrders
+		<< " avg_check_us=" << (load.reportedOrders > 0 ? (double)load.checkTime / load.reportedOrders : 0)
+		<< " avg_execute_us=" << (load.reportedOrders > 0 ? (double)load.executeTime / load.reportedOrders : 0);
+	static const char *lanes[LaneCount] = { "close", "open", "status" };
+	for(int lane = 0; lane < LaneCount; lane++)
+	{
+		LaneStats stats = processor.GetLaneStats(lane);
+		std::cout << " lane_" << lanes[lane] << "_handled=" << stats.handled
+			<< " lane_" << lanes[lane] << "_max_depth=" << stats.maxDepth
+			<< " lane_" << lanes[lane] << "_avg_wait_us=" << (stats.handled > 0 ? (double)stats.waitTotal / stats.handled : 0)
+			<< " lane_" << lanes[lane] << "_max_wait_us=" << stats.waitMax;
+	}
+	std::cout << std::endl;
+
+	UnsubscribeProcessorFromEmulator();
+	processor.Clear();
+	return 0;
+}
@@ -0,0 +1,85 @@
+#include "StdAfx.h"
+#include "Benchmark.h"
+#include "mt4part/Processor.h"
+#include "mt4part/PluginSettings.h"
+#include "BenchmarkServer.h"
+#include "mt4part/EmulatorStore.h"
+#include <algorithm>
+#include <sstream>
+#include <vector>
+#include <iostream>
+
+/// One status request of the logins answered by the processor, microseconds
+static double AnswerStatus(std::vector<int> logins)
+{
+	unsigned long long target = processor.StatusProcessed() + 1;
+	Stopwatch watch;
+	processor.OnTradesRequest(logins);
+	while(processor.StatusProcessed() < target)
+		PlatformSleep(0);
+	return watch.ElapsedUs();
+}
+
+/// Orders status of many logins: account by account (UserInfoLoad and OrdersGetOpen per login)
+/// against batches of logins fetched with one OrdersGet each. Every request is scanned: no window, no cache
+int RunStatusBenchmark(const BenchmarkArgs &args)
+{
+	std::string counts = args.GetString("logins", "1000,10000,50000");
+	int ordersPerLogin = (std::max)(0, args.GetInt("orders_per_login", 5));
+	int batch = (std::max)(1, args.GetInt("batch", 1000));
+	int iterations = (std::max)(1, args.GetInt("iterations", 5));
+
+	std::vector<int> sizes;
+	std::stringstream list(counts);
+	std::string item;
+	while(std::getline(list, item, ','))
+		sizes.push_back((std::max)(1, atoi(item.c_str())));
+
+	EmulatorDataset dataset;
+	dataset.accounts = *std::max_element(sizes.begin(), sizes.end());
+	dataset.orders = dataset.accounts * ordersPerLogin;
+	dataset.groups = 10;
+	ExtEmulatorStore.Generate(dataset);
+
+	BenchmarkServer server;
+	processor.SetServerInterface(&server);
+	ApplyBenchmarkSettings(args, 0);
+
+	for(size_t s = 0; s < sizes.size(); s++)
+	{
+		//--- logins of the request in random order, like the router sends them
+		std::vector<int> logins(sizes[s]);
+		for(int i = 0; i < sizes[s]; i++)
+			logins[i] = 100000 + i;
+		std::random_shuffle(logins.begin(), logins.end());
+
+		int batches[] = { 0, batch };
+		for(int b = 0; b < 2; b++)
+		{
+			PluginSettings settings = *ExtSettings.Current();
+			settings.statusBatchSize = batches[b];
+			settings.statusCoalesceWindow = 0;
+			settings.statusCacheSize = 0;
+			processor.Reconfigure(ExtSettings.Publish(settings));
+
+			AnswerStatus(logins);
+			double elapsed = 0, best = 0;
+			for(int i = 0; i < iterations; i++)
+			{
+				double us = AnswerStatus(logins);
+				elapsed += us;
+				best = i == 0 ? us : (std::min)(best, us);
+			}
+			std::cout << "status logins=" << sizes[s]
+				<< " mode=" << (batches[b] == 0 ? "per_login" : "bulk")
+				<< " batch=" << batches[b]
+				<< " orders=" << sizes[s] * ordersPerLogin
+				<< " avg_us=" << elapsed / iterations
+				<< " best_us=" << best
+				<< " ns_per_login=" << elapsed * 1000.0 / iterations / sizes[s] << std::endl;
+		}
+	}
+
+	processor.Clear();
+	return 0;
+}
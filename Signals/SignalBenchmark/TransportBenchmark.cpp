@@ -0,0 +1,149 @@
+#include "Platform.h"
+#include "Benchmark.h"
+#include "RouterTransport.h"
+#include "SharedMemoryChannel.h"
+#include "include/zmq.hpp"
+#include <algorithm>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include <iostream>
+
+/// Router side of a ZeroMQ transport: ROUTER socket which sends every message back to its peer
+static void EchoZeroMq(zmq::socket_t *socket, volatile bool *running)
+{
+	zmq::pollitem_t item = { (void*)*socket, 0, ZMQ_POLLIN, 0 };
+	while(*running)
+	{
+		if(zmq::poll(&item, 1, 10) <= 0)
+			continue;
+		zmq::message_t peer, body;
+		socket->recv(&peer);
+		socket->recv(&body);
+		socket->send(peer, ZMQ_SNDMORE);
+		socket->send(body);
+	}
+}
+
+/// Router side of a shared memory channel
+static void EchoSharedMemory(SharedMemoryChannel *channel, volatile bool *running)
+{
+	std::string message;
+	while(*running)
+	{
+		if(!channel->Receive(message))
+		{
+			channel->Wait(10);
+			continue;
+		}
+		while(!channel->Send(message.data(), message.size()) && *running)
+			PlatformYield();
+	}
+}
+
+/// Round trips of one transport: latency percentiles and CPU time of both ends per round trip
+static void MeasureTransport(const std::string &name, RouterTransport *client, int messages, int size)
+{
+	std::string payload(size, 'x'), reply;
+	std::vector<double> latency;
+	latency.reserve(messages);
+	int warmup = (std::min)(messages, 1000);
+	unsigned long long cpu = 0;
+	Stopwatch total;
+	for(int i = 0; i < warmup + messages; i++)
+	{
+		if(i == warmup)
+		{
+			cpu = PlatformCpuMicroseconds();
+			total.Restart();
+		}
+		Stopwatch watch;
+		while(!client->Send(payload.data(), payload.size()))
+			PlatformYield();
+		while(!client->Receive(reply))
+			client->Wait(100);
+		if(i >= warmup)
+			latency.push_back(watch.ElapsedUs());
+	}
+	double elapsed = total.ElapsedUs();
+	cpu = PlatformCpuMicroseconds() - cpu;
+
+	std::sort(latency.begin(), latency.end());
+	std::cout << "transport name=" << name
+		<< " messages=" << messages
+		<< " size=" << size
+		<< " round_trips_per_sec=" << messages * 1000000.0 / elapsed
+		<< " p50_us=" << latency[latency.size() / 2]
+		<< " p90_us=" << latency[latency.size() * 90 / 100]
+		<< " p99_us=" << latency[latency.size() * 99 / 100]
+		<< " max_us=" << latency.back()
+		<< " cpu_us_per_round_trip=" << (double)cpu / messages << std::endl;
+}
+
+/// Router transports side by side: ping-pong of messages of the size between the dealer side and an echo router
+int RunTransportBenchmark(const BenchmarkArgs &args)
+{
+	int messages = (std::max)(1, args.GetInt("messages", 20000));
+	int size = (std::max)(1, args.GetInt("size", 256));
+	int port = args.GetInt("port", 2230);
+	std::string transports = args.GetString("transports", "tcp,ipc,shm");
+
+	zmq::context_t context(1);
+	std::stringstream list(transports);
+	std::string name;
+	while(std::getline(list, name, ','))
+	{
+		volatile bool running = true;
+		if(name == "shm")
+		{
+			//--- the dealer side opens the channel of its identity
+			std::string channelName = "SignalBenchmark_Benchmark";
+			SharedMemoryChannel::Remove(channelName);
+			SharedMemoryChannel router;
+			if(!router.Open(channelName, SharedMemoryRouter))
+			{
+				std::cout << "transport name=shm can not open shared memory" << std::endl;
+				continue;
+			}
+			std::thread echo(EchoSharedMemory, &router, &running);
+			RouterTransport *client = RouterTransport::Create(context, "shm://SignalBenchmark", "Benchmark");
+			MeasureTransport(name, client, messages, size);
+			delete client;
+			running = false;
+			echo.join();
+			router.Close();
+			SharedMemoryChannel::Remove(channelName);
+			continue;
+		}
+
+		std::string address;
+		if(name == "tcp")
+			address = "tcp://127.0.0.1:" + std::to_string(port);
+		else if(name == "ipc")
+			address = "ipc://signal-benchmark.ipc";
+		else
+		{
+			std::cout << "transport name=" << name << " is unknown" << std::endl;
+			continue;
+		}
+		try
+		{
+			zmq::socket_t router(context, ZMQ_ROUTER);
+			int linger = 0;
+			router.setsockopt(ZMQ_LINGER, &linger, sizeof(linger));
+			router.bind(address.c_str());
+			RouterTransport *client = RouterTransport::Create(context, address, "Benchmark");
+			std::thread echo(EchoZeroMq, &router, &running);
+			MeasureTransport(name, client, messages, size);
+			delete client;
+			running = false;
+			echo.join();
+		}
+		catch(zmq::error_t &ex)
+		{
+			//--- ipc is missing from ZeroMQ builds for Windows before 4.3
+			std::cout << "transport name=" << name << " failed: " << ex.what() << std::endl;
+		}
+	}
+	return 0;
+}
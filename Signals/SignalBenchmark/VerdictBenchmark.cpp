@@ -0,0 +1,176 @@
+#include "StdAfx.h"
+#include "Benchmark.h"
+#include "mt4part/VerdictCache.h"
+#include "BenchmarkServer.h"
+#include "mt4part/EmulatorStore.h"
+#include "BaseExecutionSignal.h"
+#include <algorithm>
+#include <atomic>
+#include <vector>
+#include <iostream>
+
+/// Emulated server with checks which cost time and reject some orders
+class VerdictServer : public BenchmarkServer
+{
+public:
+	VerdictServer(int checkUs) :
+		checkUs(checkUs), checks(0)
+	{
+	}
+
+	int __stdcall TradesCheckSecurity(const ConSymbol *symbol, const ConGroup *group)
+	{
+		Check();
+		//--- the last group does not trade the dollar based symbols
+		return strcmp(group->group, "demo-4") == 0 && strncmp(symbol->symbol, "USD", 3) == 0 ? RET_TRADE_DISABLE : RET_OK;
+	}
+
+	int __stdcall TradesCheckVolume(const TradeTransInfo *trans, const ConSymbol*, const ConGroup*, const int)
+	{
+		Check();
+		//--- up to 10 lots
+		return trans->volume > 1000 ? RET_TRADE_BAD_VOLUME : RET_OK;
+	}
+
+	int __stdcall TradesCheckTickSize(const double price, const ConSymbol *symbol)
+	{
+		Check();
+		double ticks = price * pow(10.0, symbol->digits);
+		return fabs(ticks - floor(ticks + 0.5)) < 1e-6 ? TRUE : FALSE;
+	}
+
+	int Checks() { return checks.exchange(0); }
+
+private:
+	/// The real server takes its lock and looks the group up, a busy wait stands for it
+	void Check()
+	{
+		checks.fetch_add(1);
+		if(checkUs == 0)
+			return;
+		Stopwatch watch;
+		while(watch.ElapsedUs() < checkUs)
+			;
+	}
+
+	int checkUs;
+	std::atomic<int> checks;
+};
+
+/// Subscriber order of a signal
+struct VerdictOrder
+{
+	int            user;
+	TradeTransInfo trans;
+};
+
+/// Verdicts of every order through the cache or straight from the server, returns the count of passed orders
+static int CheckOrders(VerdictServer &server, CVerdictCache *cache, const std::vector<UserInfo> &users, const ConSymbol &symbol,
+	const std::vector<VerdictOrder> &orders, std::vector<int> &verdicts)
+{
+	int passed = 0;
+	verdicts.resize(orders.size() * 3);
+	for(size_t i = 0; i < orders.size(); i++)
+	{
+		const ConGroup &group = users[orders[i].user].grp;
+		const TradeTransInfo &trans = orders[i].trans;
+		int *verdict = &verdicts[i * 3];
+		if(cache != NULL)
+		{
+			verdict[0] = cache->CheckSecurity(&server, symbol, group);
+			verdict[1] = cache->CheckTickSize(&server, trans.price, symbol);
+			verdict[2] = cache->CheckVolume(&server, trans, symbol, group);
+		}
+		else
+		{
+			verdict[0] = server.TradesCheckSecurity(&symbol, &group);
+			verdict[1] = server.TradesCheckTickSize(trans.price, &symbol);
+			verdict[2] = server.TradesCheckVolume(&trans, &symbol, &group, TRUE);
+		}
+		if(verdict[0] == RET_OK && verdict[1] != FALSE && verdict[2] == RET_OK)
+			passed++;
+	}
+	return passed;
+}
+
+/// Validation of signal fan-out: every subscriber order of a signal asks the security, tick size and
+/// volume checks; the verdict cache asks the server once per group, symbol, volume and price
+int RunVerdictBenchmark(const BenchmarkArgs &args)
+{
+	int subscribers = (std::max)(1, args.GetInt("subscribers", 1000));
+	int signals = (std::max)(1, args.GetInt("signals", 100));
+	int buckets = (std::max)(1, args.GetInt("volumes", 8));
+	int checkUs = (std::max)(0, args.GetInt("check_us", 2));
+
+	EmulatorDataset dataset;
+	dataset.accounts = subscribers;
+	dataset.orders = 0;
+	dataset.groups = 4;
+	ExtEmulatorStore.Generate(dataset);
+
+	VerdictServer server(checkUs);
+	std::vector<ConSymbol> symbols;
+	ConSymbol symbol;
+	for(int pos = 0; ExtEmulatorStore.SymbolsNext(pos, &symbol); pos++)
+		symbols.push_back(symbol);
+	std::vector<UserInfo> users;
+	for(int i = 0; i < subscribers; i++)
+		users.push_back(BaseExecutionSignal::UserInfoLoad(100000 + i, &server));
+
+	CVerdictCache cache;
+	cache.SetLimit(args.GetInt("limit", 65536));
+	unsigned int seed = 7919;
+	double directUs = 0, cachedUs = 0;
+	long long directChecks = 0, cachedChecks = 0, orders = 0;
+	int mismatches = 0, passed = 0;
+	std::vector<VerdictOrder> signalOrders(subscribers);
+	std::vector<int> direct, cached;
+	for(int s = 0; s < signals; s++)
+	{
+		//--- subscribers copy the provider with a few volumes at the price of the signal
+		const ConSymbol &traded = symbols[s % symbols.size()];
+		double prices[2];
+		ExtEmulatorStore.PricesGet(traded.symbol, prices);
+		for(int i = 0; i < subscribers; i++)
+		{
+			seed = seed * 1103515245 + 12345;
+			VerdictOrder &order = signalOrders[i];
+			memset(&order, 0, sizeof(order));
+			order.user = i;
+			order.trans.cmd = (s & 1) ? OP_SELL : OP_BUY;
+			order.trans.volume = 100 * (1 + (seed >> 8) % buckets) * (1 + s % 3);
+			order.trans.price = order.trans.cmd == OP_SELL ? prices[0] : prices[1];
+			COPY_STR(order.trans.symbol, traded.symbol);
+		}
+
+		Stopwatch watch;
+		passed += CheckOrders(server, NULL, users, traded, signalOrders, direct);
+		directUs += watch.ElapsedUs();
+		directChecks += server.Checks();
+
+		watch.Restart();
+		CheckOrders(server, &cache, users, traded, signalOrders, cached);
+		cachedUs += watch.ElapsedUs();
+		cachedChecks += server.Checks();
+
+		if(direct != cached)
+			mismatches++;
+		orders += subscribers;
+		if(s % 10 == 9)
+		{
+			//--- a configuration change drops the verdicts
+			ExtEmulatorStore.Tick();
+			cache.Clear();
+		}
+	}
+
+	std::cout << "verdicts orders=" << orders
+		<< " passed=" << passed
+		<< " direct_ns=" << directUs * 1000.0 / orders
+		<< " cached_ns=" << cachedUs * 1000.0 / orders
+		<< " direct_checks=" << directChecks
+		<< " cached_checks=" << cachedChecks
+		<< " cache_size=" << cache.Size()
+		<< " mismatches=" << mismatches << std::endl;
+	return 0;
+}
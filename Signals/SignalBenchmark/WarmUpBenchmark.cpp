@@ -0,0 +1,89 @@
+#include "StdAfx.h"
+#include "Benchmark.h"
+#include "mt4part/Processor.h"
+#include "mt4part/PluginSettings.h"
+#include "BenchmarkServer.h"
+#include "mt4part/EmulatorStore.h"
+#include "SignalCodec.h"
+#include <algorithm>
+#include <iostream>
+
+static const char *ExtWarmUpSymbols[] = { "EURUSD", "GBPUSD", "USDJPY", "EURGBP" };
+
+/// Serialized execution request of the subscribers opening one symbol
+static std::string MakeExecutionContent(int subscribers, int index)
+{
+	ProtoTypes::ExecutionSignal proto;
+	char comment[32];
+	sprintf_s(comment, 32, "Signal_%d", index);
+	proto.set_comment(comment);
+	proto.set_destination("Benchmark");
+	for(int i = 0; i < subscribers; i++)
+	{
+		ProtoTypes::ExecutionOrder *order = proto.add_orders();
+		order->set_login(100000 + i);
+		order->set_actiontype(ProtoTypes::ActionType::Open);
+		order->set_side(index & 1 ? ProtoTypes::TradeSide::Sell : ProtoTypes::TradeSide::Buy);
+		order->set_volume(0.1);
+		order->set_symbol(ExtWarmUpSymbols[(index + i) % 4]);
+		order->set_orderid(index * subscribers + i + 1);
+		order->set_commission(1.0);
+	}
+	return proto.SerializeAsString();
+}
+
+/// Decode and execute one request, microseconds
+static double ExecuteRequest(const std::string &content)
+{
+	Stopwatch watch;
+	ProtoTypes::ExecutionSignal proto;
+	proto.ParseFromString(content);
+	ExecutionSignal signal;
+	SignalCodec::ProtoToExecutionSignal(proto, signal);
+	processor.OnExecuteSignalRequest(signal);
+	return watch.ElapsedUs();
+}
+
+/// Start of the plugin and its first execution requests, with or without the warm-up stage.
+/// Descriptors and caches are process wide, so one run measures one mode: run it with warm_up=0 and warm_up=1
+int RunWarmUpBenchmark(const BenchmarkArgs &args)
+{
+	EmulatorDataset dataset;
+	dataset.accounts = (std::max)(1, args.GetInt("accounts", 10000));
+	dataset.orders = 0;
+	dataset.groups = (std::max)(1, args.GetInt("groups", 10));
+	int subscribers = (std::min)(dataset.accounts, (std::max)(1, args.GetInt("subscribers", 100)));
+	int requests = (std::max)(2, args.GetInt("requests", 5));
+	ExtEmulatorStore.Generate(dataset);
+
+	BenchmarkServer server;
+	processor.SetServerInterface(&server);
+	std::vector<std::string> contents;
+	for(int i = 0; i < requests; i++)
+		contents.push_back(MakeExecutionContent(subscribers, i));
+
+	Stopwatch watch;
+	ApplyBenchmarkSettings(args, 0, false);
+	double startUs = watch.ElapsedUs();
+	WarmUpStats stats = processor.LastWarmUp();
+	std::cout << "warmup start warm_up=" << ExtSettings.Current()->warmUp
+		<< " start_us=" << startUs
+		<< " warm_up_ms=" << stats.ms
+		<< " groups=" << stats.groups
+		<< " symbols=" << stats.symbols
+		<< " point_values=" << stats.pointValues
+		<< " verdicts=" << stats.verdicts
+		<< " messages=" << stats.messages
+		<< " hooks=" << stats.hooks << std::endl;
+
+	double firstUs = ExecuteRequest(contents[0]);
+	double laterUs = 0;
+	for(int i = 1; i < requests; i++)
+		laterUs += ExecuteRequest(contents[i]);
+	std::cout << "warmup requests orders=" << subscribers
+		<< " first_us=" << firstUs
+		<< " later_us=" << laterUs / (requests - 1) << std::endl;
+
+	processor.Clear();
+	return 0;
+}
@@ -0,0 +1,166 @@
+//--- SIGNAL_MODULE_ONLY builds the scenarios of the signal module alone, without the MT4 server API
+#ifndef SIGNAL_MODULE_ONLY
+#include "StdAfx.h"
+#include "mt4part/Processor.h"
+#include "mt4part/PluginSettings.h"
+#include "mt4part/EmulatorStore.h"
+#else
+#include "Platform.h"
+#endif
+#include "Benchmark.h"
+#include <iostream>
+#include <cstdlib>
+
+BenchmarkArgs::BenchmarkArgs(int argc, char *argv[])
+{
+	for(int i = 0; i < argc; i++)
+	{
+		std::string arg = argv[i];
+		size_t pos = arg.find('=');
+		if(pos != std::string::npos)
+			values[arg.substr(0, pos)] = arg.substr(pos + 1);
+	}
+}
+
+int BenchmarkArgs::GetInt(const std::string &name, int def) const
+{
+	auto it = values.find(name);
+	return it == values.end() ? def : atoi(it->second.c_str());
+}
+
+std::string BenchmarkArgs::GetString(const std::string &name, const std::string &def) const
+{
+	auto it = values.find(name);
+	return it == values.end() ? def : it->second;
+}
+
+#ifndef SIGNAL_MODULE_ONLY
+void ApplyBenchmarkSettings(const BenchmarkArgs &args, int equityBurstWindow, bool autoExecution)
+{
+	PluginSettings settings;
+	settings.host = args.GetString("host", "127.0.0.1");
+	settings.port = args.GetString("port", "2222");
+	settings.name = "Benchmark";
+	settings.debugMode = false;
+	settings.autoExecution = autoExecution;
+	settings.equityBurstWindow = equityBurstWindow;
+	settings.dedupeWindow = args.GetInt("dedupe", 600);
+	settings.executionReports = args.GetInt("execution_reports", 1) > 0;
+	settings.commissionRefresh = args.GetInt("commission_refresh", 1000);
+	settings.verdictCacheSize = args.GetInt("verdict_cache", 65536);
+	settings.statusBatchSize = args.GetInt("status_batch", 1000);
+	settings.statusCoalesceWindow = args.GetInt("status_window", 5);
+	settings.statusCacheSize = args.GetInt("status_cache", 100000);
+	settings.warmUp = args.GetInt("warm_up", 1) > 0;
+	settings.positionsBoard = args.GetString("board", "");
+	settings.positionsBoardLogins = args.GetInt("board_logins", 10000);
+	settings.positionsBoardPositions = args.GetInt("board_positions", 64);
+	settings.closeLaneWeight = args.GetInt("close_weight", 8);
+	settings.openLaneWeight = args.GetInt("open_weight", 4);
+	settings.statusLaneWeight = args.GetInt("status_weight", 1);
+	settings.routerMode = args.GetInt("router_mode", RouterActiveStandby);
+	settings.heartbeatInterval = args.GetInt("heartbeat", 50);
+	settings.failoverTimeout = args.GetInt("failover", 200);
+	settings.journalPath = args.GetString("journal", "");
+	settings.journalSize = args.GetInt("journal_size", 64);
+	settings.journalCommitInterval = args.GetInt("journal_interval", 10);
+	settings.journalReplayAge = args.GetInt("journal_replay_age", 60);
+	settings.experimentalSharedMemory = args.GetInt("experimental_shm", 0) > 0;
+	//--- published only when the processor takes them, like the plugin does. No scenario runs without settings
+	if(!processor.Validate(&settings))
+	{
+		std::cout << "benchmark settings rejected" << std::endl;
+		exit(1);
+	}
+	processor.Reconfigure(ExtSettings.Publish(settings));
+}
+
+void SubscribeProcessorOnEmulator()
+{
+	ExtEmulatorStore.SubscribeTrades(
+		[](const UserInfo *ui, const TradeRecord *trade, int mode) { processor.OnNewTrade(ui, trade, mode); },
+		[](const UserInfo *ui, const TradeRecord *trade, int mode) { processor.OnTradeUpdate(ui, trade, mode); });
+}
+
+void UnsubscribeProcessorFromEmulator()
+{
+	ExtEmulatorStore.SubscribeTrades(nullptr, nullptr);
+}
+#endif
+
+static void Usage()
+{
+	std::cout << "usage: SignalBenchmark <scenario> [key=value ...]" << std::endl;
+	std::cout << "  codec     iterations=100000 orders=10 logins=50 positions=20 out=codec.jsonl" << std::endl;
+	std::cout << "  journal   messages=200000 lag=1000 rounds=5 budget=100 path=benchmark.journal size=64 interval=10" << std::endl;
+	std::cout << "  failover  port=2222 router_mode=0 heartbeat=50 failover=200 signals=2000 rate=1000 kill=1000 drain=1000" << std::endl;
+	std::cout << "  transport messages=20000 size=256 port=2230 transports=tcp,ipc,shm" << std::endl;
+#ifndef SIGNAL_MODULE_ONLY
+	std::cout << "  massclose positions=200 accounts=1 iterations=10 window=100" << std::endl;
+	std::cout << "  pipeline  accounts=100000 orders=1000000 groups=10 operations=100000 window=100 seed=1" << std::endl;
+	std::cout << "  confirms  workers=4 rate=5000 requests=20000 latency=fixed|uniform|lognormal mean=50 spread=500" << std::endl;
+	std::cout << "  router    port=2222 accounts=1000 orders=10000 signals=10000 rate=1000 burst=1 orders_per_signal=10" << std::endl;
+	std::cout << "            symbols=4 volume=10 close=30 status_every=10 status_logins=50 auto=1 window=100 drain=5000" << std::endl;
+	std::cout << "  commission iterations=1000000 refresh=1000" << std::endl;
+	std::cout << "  status    logins=1000,10000,50000 orders_per_login=5 batch=1000 iterations=5" << std::endl;
+	std::cout << "  board     accounts=10000 orders=50000 operations=100000 readers=2 requests=1000 name=SignalBenchmark_Board" << std::endl;
+	std::cout << "  verdicts  subscribers=1000 signals=100 volumes=8 check_us=2 limit=65536" << std::endl;
+	std::cout << "  prevalidate subscribers=1000 signals=100 check_us=2" << std::endl;
+	std::cout << "  reversal  subscribers=100 signals=10 margin=70 open_first=0" << std::endl;
+	std::cout << "  warmup    accounts=10000 groups=10 subscribers=100 requests=5 warm_up=1" << std::endl;
+	std::cout << "  coalesce  accounts=10000 orders_per_login=5 requesters=4 logins=5000 rounds=5 touched=100 status_window=5" << std::endl;
+	std::cout << "scenarios running the plugin take journal=<path> journal_size=64 journal_interval=10 journal_replay_age=60 dedupe=600 commission_refresh=1000 status_batch=1000" << std::endl;
+	std::cout << "  board=<name> board_logins=10000 board_positions=64 verdict_cache=65536 warm_up=1 status_window=5 status_cache=100000" << std::endl;
+	std::cout << "  close_weight=8 open_weight=4 status_weight=1 router_mode=0 heartbeat=50 failover=200 execution_reports=1 experimental_shm=0" << std::endl;
+#endif
+}
+
+int main(int argc, char *argv[])
+{
+	if(argc < 2)
+	{
+		Usage();
+		return 1;
+	}
+
+	std::string scenario = argv[1];
+	BenchmarkArgs args(argc - 2, argv + 2);
+
+	if(scenario == "codec")
+		return RunCodecBenchmark(args);
+	if(scenario == "journal")
+		return RunJournalBenchmark(args);
+	if(scenario == "failover")
+		return RunFailoverBenchmark(args);
+	if(scenario == "transport")
+		return RunTransportBenchmark(args);
+#ifndef SIGNAL_MODULE_ONLY
+	if(scenario == "massclose")
+		return RunMassCloseBenchmark(args);
+	if(scenario == "pipeline")
+		return RunPipelineBenchmark(args);
+	if(scenario == "confirms")
+		return RunConfirmsBenchmark(args);
+	if(scenario == "router")
+		return RunRouterLoadBenchmark(args);
+	if(scenario == "commission")
+		return RunCommissionBenchmark(args);
+	if(scenario == "status")
+		return RunStatusBenchmark(args);
+	if(scenario == "board")
+		return RunBoardBenchmark(args);
+	if(scenario == "verdicts")
+		return RunVerdictBenchmark(args);
+	if(scenario == "prevalidate")
+		return RunPrevalidateBenchmark(args);
+	if(scenario == "reversal")
+		return RunReversalBenchmark(args);
+	if(scenario == "warmup")
+		return RunWarmUpBenchmark(args);
+	if(scenario == "coalesce")
+		return RunCoalesceBenchmark(args);
+#endif
+
+	Usage();
+	return 1;
+}
@@ -1,14 +1,31 @@
-#include "stdafx.h"
+#include "StdAfx.h"
 #include "BaseExecutionSignal.h"
 #include <iostream>
 #include "Logger.h"
 
 
-BaseExecutionSignal::BaseExecutionSignal()
+BaseExecutionSignal::BaseExecutionSignal() :
+	currentBid(0.0), currentAsk(0.0), server(NULL), verdicts(NULL),
+	result(ResultUnknown), ticket(0), price(0.0), started(0), checkTime(0), executeTime(0)
 {
 
 }
 
+int BaseExecutionSignal::CheckSecurity()
+{
+	return verdicts != NULL ? verdicts->CheckSecurity(server, symbol, ui.grp) : server->TradesCheckSecurity(&symbol, &ui.grp);
+}
+
+int BaseExecutionSignal::CheckTickSize(double price)
+{
+	return verdicts != NULL ? verdicts->CheckTickSize(server, price, symbol) : server->TradesCheckTickSize(price, &symbol);
+}
+
+int BaseExecutionSignal::CheckVolume(const TradeTransInfo &trans)
+{
+	return verdicts != NULL ? verdicts->CheckVolume(server, trans, symbol, ui.grp) : server->TradesCheckVolume(&trans, &symbol, &ui.grp, TRUE);
+}
+
 void BaseExecutionSignal::PrepeareData(int login, std::string symbol, MT4Server* server)
 {
 	this->server = server;
@@ -31,6 +48,14 @@ UserInfo BaseExecutionSignal::UserInfoLoad(int login, MT4Server* server)
 	//clean up the resulting struct
 	ZeroMemory(&ui, sizeof(UserInfo));
 	//Retrieve the full user information
+	UserInfoFill(ur, ui);
+	server->GroupsGet(ui.group, &ui.grp);
+
+	return ui;
+}
+
+void BaseExecutionSignal::UserInfoFill(const UserRecord &ur, UserInfo &ui)
+{
 	//Fill some data
 	ui.login				= ur.login;
 	ui.enable				= ur.enable;
@@ -42,9 +67,6 @@ UserInfo BaseExecutionSignal::UserInfoLoad(int login, MT4Server* server)
 	ui.prevbalance			= ur.prevbalance;
 	//Fill the group name
 	COPY_STR(ui.group, ur.group);
-	server->GroupsGet(ui.group, &ui.grp);
-
-	return ui;
 }
 
 void BaseExecutionSignal::SymbolLoad(std::string symbol)
@@ -70,7 +92,12 @@ void BaseExecutionSignal::UserInfoLoad(int login)
 int BaseExecutionSignal::Run(bool autoExecution)
 {
 	LogMessage("Starting order operation", CmdOK, server);	
-	if(!CheckParametres())
+	started = PlatformMicroseconds();
+	executeTime = 0;
+	result = ResultUnknown;
+	bool valid = CheckParametres();
+	checkTime = (long long)(PlatformMicroseconds() - started);
+	if(!valid)
 	{
 		LogMessage("CheckParametres fAiled", CmdErr, server);
 		return 0;
@@ -78,7 +105,7 @@ int BaseExecutionSignal::Run(bool autoExecution)
 	
 	if(autoExecution)
 	{
-		if(!Execute(currentBid, currentAsk))
+		if(!Complete(currentBid, currentAsk))
 		{
 			LogMessage("Execute failed", CmdOK, server);
 		}		
@@ -90,82 +117,43 @@ int BaseExecutionSignal::Run(bool autoExecution)
 		if(server->RequestsAdd(&request, FALSE, &request.id) != RET_TRADE_ACCEPTED || request.login == 0)
 		{
 			LogMessage("Execute failed", CmdErr, server);
+			result = ResultRejected;
 			return 0;
 		}
 
 		LogMessage("Operation success", CmdOK, server);
+		result = ResultRequestAdded;
 		return request.id;
 	}	
 	return 0;
 }
 
-int BaseExecutionSignal::CallTradeTransactionForAllPlugins(TradeTransInfo* trans, const UserInfo *user, int *request_id)
+bool BaseExecutionSignal::Complete(double bid, double ask)
 {
-	int result = RET_OK;
-	std::set<std::string> plugins = LoadPlugins();
-	for(std::set<std::string>::iterator p = plugins.begin(); p != plugins.end(); p++)
-	{
-		std::string fileName = path;//"C:\\MetaTraderServer4\\plugins\\";
-		fileName.append("\\plugins\\");
-		fileName.append(*p);
-		int localResult = CallTradeTransaction(fileName, trans, user, request_id);
-		if(localResult != RET_OK)
-		{
-			return localResult;
-		}
-	}
-	return result;
+	unsigned long long start = PlatformMicroseconds();
+	bool executed = Execute(bid, ask);
+	executeTime = (long long)(PlatformMicroseconds() - start);
+	result = executed ? ResultExecuted : ResultServerError;
+	return executed;
 }
 
-int BaseExecutionSignal::CallTradeTransaction(std::string plugin, TradeTransInfo* trans, const UserInfo *user, int *request_id)
+void BaseExecutionSignal::Reject(ExecutionResult result)
 {
-	HMODULE dll = LoadLibrary(plugin.c_str());
-	if(dll != NULL)
-	{
-		int ret = RET_OK;
-		MtSrvTradeTransactionCall function = (MtSrvTradeTransactionCall)GetProcAddress(dll, "MtSrvTradeTransaction");
-		if(NULL != function)
-		{
-			//SendLogMessage(CmdOK, "Calling MtSrvTradeTransaction for %s", plugin.c_str());
-			ret = function(trans, user, request_id);
-		}
-		FreeLibrary(dll);
-		return ret;
-	}
-	
+	this->result = result;
+	ticket = 0;
+	price = 0.0;
+	started = PlatformMicroseconds();
+	checkTime = 0;
+	executeTime = 0;
+}
 
-	return RET_OK;
+bool BaseExecutionSignal::Fail(ExecutionResult result)
+{
+	this->result = result;
+	return false;
 }
 
-std::set<std::string> BaseExecutionSignal::LoadPlugins()
+int BaseExecutionSignal::CallTradeTransactionForAllPlugins(TradeTransInfo* trans, const UserInfo *user, int *request_id)
 {
-	//SendLogMessage(CmdOK, "Loading plugins");
-	static std::set<std::string> plugins;
-	if(plugins.size() == 0)
-	{
-		std::string fileName = path; 
-		fileName.append("\\config\\plugins.ini");
-		//"C:\\MetaTraderServer4\\config\\plugins.ini";
-		FILE *configFile;
-		errno_t err;
-		err = fopen_s(&configFile, fileName.c_str(),"r+b");
-		if(err == 0)
-		{
-			fseek(configFile, 4, SEEK_SET);
-			int iterations = 0;
-			while(feof(configFile) == 0 && iterations++ < 100)
-			{
-				ConPlugin plugin;		
-				fread(&plugin, sizeof(ConPlugin), 1, configFile);
-				if(plugin.enabled == 1 && strstr(plugin.file, ".dll") != NULL && strstr(plugin.file, "gurucollector") == NULL  && strstr(plugin.file, "datacollector") == NULL)
-				{
-					//SendLogMessage(CmdOK, "Plugin loaded %s", plugin.file);
-					plugins.insert(plugin.file);
-				}
-			}
-			fclose(configFile);
-		}
-	}
-	//SendLogMessage(CmdOK, "Plugins loaded %d", plugins.size());
-	return plugins;
-}
\ No newline at end of file
+	return ExtPluginChain.Call(trans, user, request_id);
+}
@@ -1,18 +1,8 @@
 #pragma once
-#include "mt4part\MT4ServerEmulator.h"
-#include <set>
-
-typedef int (APIENTRY *MtSrvTradeTransactionCall)(TradeTransInfo* trans, const UserInfo *user, int *request_id);
-
-struct ConPlugin
-  {
-   char              file[256];                    // plugin file name
-   PluginInfo        info;                         // plugin description
-   int               enabled;                      // plugin enabled/disabled
-   int               configurable;                 // is plugin configurable
-   int               manager_access;               // plugin can be accessed from manager terminal
-   int               reserved[62];                 // reserved
-  };
+#include "mt4part/MT4ServerEmulator.h"
+#include "mt4part/VerdictCache.h"
+#include "mt4part/PluginChain.h"
+#include "ProtocolStructs.h"
 
 class BaseExecutionSignal
 {
@@ -21,27 +11,55 @@ public:
 	~BaseExecutionSignal(void);	
 
 	static UserInfo UserInfoLoad(int login, MT4Server* server);
+	/// Account fields of the user record and the group name, the group itself is left to the caller
+	static void UserInfoFill(const UserRecord &ur, UserInfo &ui);
 	int Run(bool autoExecution);	
 	virtual bool Execute(double bid, double ask) = 0;
+	/// Execute timed, the result tells whether the server took the order
+	bool Complete(double bid, double ask);
+	/// Order failed before its own checks, e.g. in the pre-validation of its batch
+	void Reject(ExecutionResult result);
+
+	/// Outcome of the last Run, Complete or Reject
+	ExecutionResult Result() const { return result; }
+	/// Opened or closed order and its price, set by Execute
+	int    Ticket() const { return ticket; }
+	double Price() const { return price; }
+	/// PlatformMicroseconds when the checks started and microseconds spent in the checks and in Execute
+	unsigned long long Started() const { return started; }
+	long long CheckTime() const { return checkTime; }
+	long long ExecuteTime() const { return executeTime; }
 protected:	
 
 	double currentBid, currentAsk;
 	ConSymbol symbol;
 	UserInfo ui;	
 	MT4Server* server;
+	/// Check results shared by the orders of the plugin, NULL asks the server every time
+	CVerdictCache* verdicts;
+	ExecutionResult result;
+	int ticket;
+	double price;
+	unsigned long long started;
+	long long checkTime, executeTime;
 	
 	void PrepeareData(int login, std::string symbol, MT4Server* server);
 
 	virtual bool CheckParametres() = 0;
+	/// Failed check of CheckParametres, always false
+	bool Fail(ExecutionResult result);
+	/// Server checks of the symbol, price and volume for the account, through the verdict cache
+	int CheckSecurity();
+	int CheckTickSize(double price);
+	int CheckVolume(const TradeTransInfo &trans);
 	
 	virtual RequestInfo GenerateRequest() = 0;
 
+	/// MtSrvTradeTransaction of the other plugins of the server, through the loaded plugin chain
 	int CallTradeTransactionForAllPlugins(TradeTransInfo* trans, const UserInfo *user, int *request_id);
-	int CallTradeTransaction(std::string plugin, TradeTransInfo* trans, const UserInfo *user, int *request_id);
 
 private:
 	
-	std::set<std::string> LoadPlugins();
 	void UserInfoLoad(int login);
 	void SymbolLoad(std::string symbol);
 	void PricesLoad(std::string symbol);
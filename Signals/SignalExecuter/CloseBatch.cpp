@@ -0,0 +1,125 @@
+#include "StdAfx.h"
+#include "CloseBatch.h"
+#include "Logger.h"
+#include <algorithm>
+
+CloseBatch::CloseBatch(MT4Server* server, CVerdictCache* verdicts) :
+	server(server), verdicts(verdicts), login(0)
+{
+}
+
+CloseBatch::~CloseBatch(void)
+{
+}
+
+void CloseBatch::Add(int ticket)
+{
+	tickets.push_back(ticket);
+}
+
+bool CloseBatch::LoadContext(const TradeRecord &trade, CloseContext &context, bool &validBid, bool &validAsk)
+{
+	if(login != trade.login)
+	{
+		ui = BaseExecutionSignal::UserInfoLoad(trade.login, server);
+		login = trade.login;
+	}
+	context.ui = ui;
+
+	auto symbol = symbols.find(trade.symbol);
+	if(symbol == symbols.end())
+	{
+		ConSymbol loaded = {0};
+		server->SymbolsGet(trade.symbol, &loaded);
+		symbol = symbols.insert(std::make_pair(std::string(trade.symbol), loaded)).first;
+	}
+	context.symbol = symbol->second;
+
+	std::string key = std::string(ui.group) + "|" + trade.symbol;
+	auto price = prices.find(key);
+	if(price == prices.end())
+	{
+		double loaded[2] = { 0.0, 0.0 };
+		server->HistoryPricesGroup(trade.symbol, &ui.grp, loaded);
+		price = prices.insert(std::make_pair(key, std::make_pair(loaded[0], loaded[1]))).first;
+	}
+	context.bid = price->second.first;
+	context.ask = price->second.second;
+
+	//--- checks of the symbol and prices, the same for every order of the group
+	int security = verdicts != NULL ? verdicts->CheckSecurity(server, context.symbol, context.ui.grp) : server->TradesCheckSecurity(&context.symbol, &context.ui.grp);
+	if(security != RET_OK)
+	{
+		LogMessage("Invalid symbol for current group", CmdErr, server);
+		return false;
+	}
+	if(verdicts != NULL)
+	{
+		validBid = verdicts->CheckTickSize(server, context.bid, context.symbol) != FALSE;
+		validAsk = verdicts->CheckTickSize(server, context.ask, context.symbol) != FALSE;
+	}
+	else
+	{
+		validBid = server->TradesCheckTickSize(context.bid, &context.symbol) != FALSE;
+		validAsk = server->TradesCheckTickSize(context.ask, &context.symbol) != FALSE;
+	}
+	return true;
+}
+
+void CloseBatch::Run(bool autoExecution, std::function<void(int, CloseOrderSignal&, int)> done)
+{
+	CloseOrderSignal failed;
+	//--- the server has no lookup of several tickets, all trades are loaded before anything is closed
+	std::vector<TradeRecord> trades(tickets.size());
+	std::vector<int> loaded;
+	loaded.reserve(tickets.size());
+	for(int i = 0; i < (int)tickets.size(); i++)
+	{
+		ZeroMemory(&trades[i], sizeof(TradeRecord));
+		if(server->OrdersGet(tickets[i], &trades[i]) == FALSE || trades[i].login == 0)
+		{
+			char message[256];
+			sprintf_s(message, 256, "Invalid order data. Order: %i", tickets[i]);
+			LogMessage(message, CmdErr, server);
+			failed.Reject(ResultInvalidOrder);
+			done(i, failed, 0);
+			continue;
+		}
+		loaded.push_back(i);
+	}
+
+	std::stable_sort(loaded.begin(), loaded.end(), [&trades](int a, int b)
+	{
+		if(trades[a].login != trades[b].login)
+			return trades[a].login < trades[b].login;
+		return strcmp(trades[a].symbol, trades[b].symbol) < 0;
+	});
+
+	size_t first = 0;
+	while(first < loaded.size())
+	{
+		const TradeRecord &head = trades[loaded[first]];
+		size_t last = first + 1;
+		while(last < loaded.size() && trades[loaded[last]].login == head.login && strcmp(trades[loaded[last]].symbol, head.symbol) == 0)
+			last++;
+
+		CloseContext context;
+		bool validBid = false, validAsk = false;
+		bool valid = LoadContext(head, context, validBid, validAsk);
+		for(size_t i = first; i < last; i++)
+		{
+			int index = loaded[i];
+			if(!valid || !(trades[index].cmd == OP_BUY ? validBid : validAsk))
+			{
+				if(valid)
+					LogMessage("Invalid tick size", CmdErr, server);
+				failed.Reject(valid ? ResultInvalidPrice : ResultInvalidSymbol);
+				done(index, failed, 0);
+				continue;
+			}
+			CloseOrderSignal request(trades[index], context, server, verdicts);
+			done(index, request, request.Run(autoExecution));
+		}
+		first = last;
+	}
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include "CloseOrderSignal.h"
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+/// Close orders of one execution signal run together. Trades are loaded in one pass and grouped by
+/// login and symbol; a group loads the account, symbol and prices once and checks the symbol once,
+/// only the checks of the trade itself run per order
+class CloseBatch
+{
+public:
+	CloseBatch(MT4Server* server, CVerdictCache* verdicts = NULL);
+	~CloseBatch(void);
+
+	void Add(int ticket);
+	bool Empty() const { return tickets.empty(); }
+	/// Run the orders, done gets the index of every order in the order of Add with its request
+	/// and the result of Run (request id, 0 when nothing was added)
+	void Run(bool autoExecution, std::function<void(int, CloseOrderSignal&, int)> done);
+
+private:
+	/// Load the context of the group of the trade, false when the symbol can not be traded by the group
+	bool LoadContext(const TradeRecord &trade, CloseContext &context, bool &validBid, bool &validAsk);
+
+	MT4Server* server;
+	CVerdictCache* verdicts;
+	std::vector<int> tickets;
+	/// Account of the last group, groups of one login follow each other
+	int login;
+	UserInfo ui;
+	/// Symbols by name and prices by group and symbol, shared by the logins of the batch
+	std::map<std::string, ConSymbol> symbols;
+	std::map<std::string, std::pair<double, double> > prices;
+};
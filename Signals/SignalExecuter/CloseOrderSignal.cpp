@@ -1,15 +1,31 @@
-#include "stdafx.h"
+#include "StdAfx.h"
 #include "CloseOrderSignal.h"
 #include "Logger.h"
 
-CloseOrderSignal::CloseOrderSignal(int ticket, MT4Server* server) 
+CloseOrderSignal::CloseOrderSignal(int ticket, MT4Server* server) :
+	contextChecked(false)
 {
-	close_price = (trade.cmd == OP_BUY ? currentBid : currentAsk);
+	ZeroMemory(&trade, sizeof(trade));
 	server->OrdersGet(ticket, &trade);
 	PrepeareData(trade.login, trade.symbol, server);
+	//--- the side of the trade is known only once it is loaded
+	close_price = (trade.cmd == OP_BUY ? currentBid : currentAsk);
 }
 
-CloseOrderSignal::CloseOrderSignal()
+CloseOrderSignal::CloseOrderSignal(const TradeRecord &trade, const CloseContext &context, MT4Server* server, CVerdictCache* verdicts) :
+	contextChecked(true), trade(trade)
+{
+	this->server = server;
+	this->verdicts = verdicts;
+	ui = context.ui;
+	symbol = context.symbol;
+	currentBid = context.bid;
+	currentAsk = context.ask;
+	close_price = (trade.cmd == OP_BUY ? currentBid : currentAsk);
+}
+
+CloseOrderSignal::CloseOrderSignal() :
+	contextChecked(false)
 {
 
 }
@@ -29,41 +45,44 @@ bool CloseOrderSignal::CheckParametres()
 		char message[256];
 		sprintf_s(message, 256, "Invalid order data. Login: %i, Order: %i, Volume: %i", trade.login, trade.order, trade.volume);
 		LogMessage(message, CmdErr, server);
-		return false;
+		return Fail(ResultInvalidOrder);
 	}
 
 	if(trade.close_time != 0)
 	{	
 		LogMessage("Invalid close time", CmdErr, server);
-		return false;
+		return Fail(ResultInvalidOrder);
 	}
 	
 	trans.order = trade.order;
 	trans.volume = trade.volume;
 	trans.price = close_price;
 
-	if(server->TradesCheckTickSize(close_price, &symbol) == FALSE)
-	{	
-		LogMessage("Invalid tick size", CmdErr, server);
-		return false;
-	}
+	if(!contextChecked)
+	{
+		if(CheckTickSize(close_price) == FALSE)
+		{	
+			LogMessage("Invalid tick size", CmdErr, server);
+			return Fail(ResultInvalidPrice);
+		}
 
-	if(server->TradesCheckSecurity(&symbol, &ui.grp)!=RET_OK)
-	{	
-		LogMessage("Invalid symbol for current group", CmdErr, server);
-		return false;
+		if(CheckSecurity()!=RET_OK)
+		{	
+			LogMessage("Invalid symbol for current group", CmdErr, server);
+			return Fail(ResultInvalidSymbol);
+		}
 	}
 	//--- check volume
-	if(server->TradesCheckVolume(&trans, &symbol, &ui.grp, TRUE) != RET_OK)
+	if(CheckVolume(trans) != RET_OK)
 	{	
 		LogMessage("Invalid volume for group", CmdErr, server);
-		return false;
+		return Fail(ResultInvalidVolume);
 	}
 	//--- check stops
 	if(server->TradesCheckFreezed(&symbol, &ui.grp, &trade) != RET_OK)
 	{		
 		LogMessage("Position freezed", CmdErr, server);
-		return false;
+		return Fail(ResultInvalidStops);
 	}
 
 	return true;
@@ -83,8 +102,9 @@ bool CloseOrderSignal::Execute(double bid, double ask)
 	{
 		return false;
 	}
-	
-	return false;
+	ticket = trade.order;
+	price = close_price;
+	return true;
 }
 
 RequestInfo CloseOrderSignal::GenerateRequest()
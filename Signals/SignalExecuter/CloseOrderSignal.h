@@ -1,20 +1,32 @@
 #pragma once 
-#include "baseexecutionsignal.h"
+#include "BaseExecutionSignal.h"
+
+/// Account, symbol and prices shared by the close orders of one login and symbol
+struct CloseContext
+{
+	UserInfo  ui;
+	ConSymbol symbol;
+	double    bid;
+	double    ask;
+};
 
 class CloseOrderSignal :
 	public BaseExecutionSignal
 {
 public:
 	CloseOrderSignal(int ticket, MT4Server* server);
+	/// Trade and context loaded by a batch which has run the symbol checks already
+	CloseOrderSignal(const TradeRecord &trade, const CloseContext &context, MT4Server* server, CVerdictCache* verdicts);
 	CloseOrderSignal();
 	~CloseOrderSignal(void);
 	virtual bool Execute(double bid, double ask);
 protected:
 	double close_price;
+	/// Tick size and security were checked for the whole batch group
+	bool contextChecked;
 
 	TradeRecord trade;
 	virtual bool CheckParametres();
 	
 	virtual RequestInfo GenerateRequest();
 };
-
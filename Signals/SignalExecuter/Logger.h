@@ -5,7 +5,7 @@
 
 #include <string>
 #include <string>
-#include "mt4part\MT4ServerEmulator.h"
+#include "mt4part/MT4ServerEmulator.h"
 
 void LogMessage(std::string text, int type, MT4Server *server);
 
@@ -0,0 +1,173 @@
+#include "StdAfx.h"
+#include "OpenBatch.h"
+#include "Logger.h"
+#include <cfloat>
+
+/// Part of the estimated margin taken for sure, the server may round rates and prices otherwise
+#define OPEN_MARGIN_SAFETY 0.9
+
+void OpenBatchArrays::Resize(size_t size)
+{
+	requested.resize(size);
+	balance.resize(size);
+	lotMin.resize(size);
+	lotStep.resize(size);
+	lotMax.resize(size);
+	lotMargin.resize(size);
+	freeMoney.resize(size);
+	valid.resize(size);
+	volume.resize(size);
+	margin.resize(size);
+	verdict.resize(size);
+}
+
+void OpenBatchArrays::Compute()
+{
+	size_t size = requested.size();
+	for(size_t i = 0; i < size; i++)
+	{
+		//--- the arithmetic of OpenOrderSignal written as selects, the loop has no branches
+		double lots = requested[i] < 0 ? -requested[i] * balance[i] : requested[i];
+		int value = (int)(100 * lots);
+		int step = lotStep[i] > 0 ? lotStep[i] : 1;
+		value -= value % step;
+		value = value < lotMin[i] ? 0 : value;
+		volume[i] = value;
+		margin[i] = 0.01 * value * lotMargin[i] * OPEN_MARGIN_SAFETY;
+		int result = freeMoney[i] < margin[i] ? OpenPrecheckNoMoney : OpenPrecheckPassed;
+		result = ((lotMax[i] > 0) & (value > lotMax[i])) ? OpenPrecheckTooLarge : result;
+		result = value <= 0 ? OpenPrecheckNoVolume : result;
+		verdict[i] = valid[i] == 0 ? OpenPrecheckNoAccount : result;
+	}
+}
+
+OpenBatch::OpenBatch(MT4Server* server, CCommissionTable* commissions, CVerdictCache* verdicts, CEquityCache* equities) :
+	server(server), commissions(commissions), verdicts(verdicts), equities(equities)
+{
+}
+
+OpenBatch::~OpenBatch(void)
+{
+}
+
+void OpenBatch::Add(int login, const std::string &symbol, double volume, int cmd, double commission)
+{
+	Order order = { login, symbol, volume, cmd, commission, NULL, NULL, 0.0, 0.0 };
+	orders.push_back(order);
+}
+
+void OpenBatch::Gather(size_t index)
+{
+	Order &order = orders[index];
+
+	auto account = accounts.find(order.login);
+	if(account == accounts.end())
+	{
+		account = accounts.insert(std::make_pair(order.login, Account())).first;
+		UserRecord &record = account->second.record;
+		ZeroMemory(&record, sizeof(record));
+		server->ClientsUserInfo(order.login, &record);
+		auto group = groups.find(record.group);
+		if(group == groups.end())
+		{
+			//--- zeroed in place, an unknown group stays empty
+			group = groups.insert(std::make_pair(std::string(record.group), ConGroup())).first;
+			server->GroupsGet(record.group, &group->second);
+		}
+		account->second.group = &group->second;
+	}
+	const UserRecord &user = account->second.record;
+	const ConGroup &grp = *account->second.group;
+	order.account = &account->second;
+
+	auto symbol = symbols.find(order.symbol);
+	if(symbol == symbols.end())
+	{
+		ConSymbol loaded = {0};
+		server->SymbolsGet(order.symbol.c_str(), &loaded);
+		symbol = symbols.insert(std::make_pair(order.symbol, loaded)).first;
+	}
+	const ConSymbol &traded = symbol->second;
+	order.security = &traded;
+
+	std::string key = std::string(grp.group) + "|" + order.symbol;
+	auto price = prices.find(key);
+	if(price == prices.end())
+	{
+		double loaded[2] = { 0.0, 0.0 };
+		server->HistoryPricesGroup(order.symbol.c_str(), &grp, loaded);
+		price = prices.insert(std::make_pair(key, std::make_pair(loaded[0], loaded[1]))).first;
+	}
+	order.bid = price->second.first;
+	order.ask = price->second.second;
+
+	const ConGroupSec &sec = grp.secgroups[traded.type >= 0 && traded.type < MAX_SEC_GROUPS ? traded.type : 0];
+	arrays.requested[index] = order.volume;
+	arrays.balance[index] = user.balance;
+	arrays.lotMin[index] = sec.lot_min;
+	arrays.lotStep[index] = sec.lot_step;
+	arrays.lotMax[index] = sec.lot_max;
+	arrays.valid[index] = user.login != 0;
+	arrays.lotMargin[index] = 0.0;
+	arrays.freeMoney[index] = DBL_MAX;
+
+	//--- without positions the order holds all the margin of the account and no hedge can lower it,
+	//--- other accounts and other margin modes are left to the margin check of the server
+	EquitySnapshot snapshot;
+	if(equities == NULL || user.login == 0 || user.leverage <= 0 || traded.margin_mode != MARGIN_CALC_FOREX ||
+		!equities->Get(order.login, snapshot) || snapshot.margin != 0.0)
+		return;
+	double divider = traded.margin_divider;
+	for(int i = 0; i < grp.secmargins_total && i < MAX_SEC_GROPS_MARGIN; i++)
+		if(strcmp(grp.secmargins[i].symbol, traded.symbol) == 0)
+			divider = grp.secmargins[i].margin_divider;
+	auto rate = rates.find(key);
+	if(rate == rates.end())
+		rate = rates.insert(std::make_pair(key, server->TradesCalcRates(grp.group, traded.margin_currency, grp.currency))).first;
+	if(divider <= 0.0 || rate->second <= 0.0)
+		return;
+	arrays.lotMargin[index] = traded.contract_size / user.leverage / divider * rate->second;
+	arrays.freeMoney[index] = snapshot.equity + grp.credit;
+}
+
+void OpenBatch::Prepare()
+{
+	arrays.Resize(orders.size());
+	for(size_t i = 0; i < orders.size(); i++)
+		Gather(i);
+	arrays.Compute();
+}
+
+void OpenBatch::Run(bool autoExecution, const std::string &comment, std::function<void(int, OpenOrderSignal&, int)> done)
+{
+	Prepare();
+	OpenOrderSignal failed;
+	OpenContext context;
+	for(int i = 0; i < (int)orders.size(); i++)
+	{
+		if(arrays.verdict[i] != OpenPrecheckPassed)
+		{
+			char message[256];
+			sprintf_s(message, 256, "Order rejected before checks. Login: %i, Volume: %i, Margin: %0.2f, Reason: %i",
+				orders[i].login, arrays.volume[i], arrays.margin[i], arrays.verdict[i]);
+			LogMessage(message, CmdErr, server);
+			failed.Reject(arrays.verdict[i] == OpenPrecheckNoAccount ? ResultInvalidOrder :
+				arrays.verdict[i] == OpenPrecheckNoMoney ? ResultNoMoney : ResultInvalidVolume);
+			done(i, failed, 0);
+			continue;
+		}
+		//--- the account and group loaded by the pass, opening orders changes neither balance nor credit
+		ZeroMemory(&context.ui, sizeof(context.ui));
+		BaseExecutionSignal::UserInfoFill(orders[i].account->record, context.ui);
+		context.ui.grp = *orders[i].account->group;
+		context.symbol = *orders[i].security;
+		context.bid = orders[i].bid;
+		context.ask = orders[i].ask;
+		OpenOrderSignal request(context, arrays.volume[i], orders[i].cmd, comment, server, orders[i].commission, commissions, verdicts);
+		int res = request.Run(autoExecution);
+		//--- the margin of the account is about to change, its snapshot can not tell it has no positions
+		if(equities != NULL)
+			equities->Invalidate(orders[i].login);
+		done(i, request, res);
+	}
+}
@@ -0,0 +1,94 @@
+#pragma once
+#include "OpenOrderSignal.h"
+#include "mt4part/EquityCache.h"
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+/// Verdict of the pre-validation of an open order
+enum OpenPrecheck { OpenPrecheckPassed = 0, OpenPrecheckNoAccount, OpenPrecheckNoVolume, OpenPrecheckTooLarge, OpenPrecheckNoMoney };
+
+/// Open orders of a batch, one array per field. The inputs are gathered once per signal, Compute
+/// turns them into volumes, margin estimates and verdicts in one pass without branches on the order
+struct OpenBatchArrays
+{
+	/// Volume of the signal, negative is lots per unit of balance
+	std::vector<double> requested;
+	std::vector<double> balance;
+	/// Lot limits of the security group in hundredths of a lot, lotMax 0 is not limited
+	std::vector<int>    lotMin;
+	std::vector<int>    lotStep;
+	std::vector<int>    lotMax;
+	/// Margin of one lot in the deposit currency, contract size and margin rate over leverage and divider
+	std::vector<double> lotMargin;
+	/// Money left for the margin of the order, DBL_MAX when the account state is not known
+	std::vector<double> freeMoney;
+	/// Account of the order was loaded
+	std::vector<int>    valid;
+	//--- results
+	std::vector<int>    volume;
+	std::vector<double> margin;
+	std::vector<int>    verdict;
+
+	void Resize(size_t size);
+	void Compute();
+};
+
+/// Open orders of one execution signal run together. Accounts, symbols and prices are loaded once per
+/// batch, volumes and a conservative margin estimate are computed for all orders in one pass, and
+/// orders which can not pass are rejected before any per-order check of the server
+class OpenBatch
+{
+public:
+	OpenBatch(MT4Server* server, CCommissionTable* commissions = NULL, CVerdictCache* verdicts = NULL, CEquityCache* equities = NULL);
+	~OpenBatch(void);
+
+	void Add(int login, const std::string &symbol, double volume, int cmd, double commission);
+	bool Empty() const { return orders.empty(); }
+	/// Gather the orders and compute their volumes and verdicts
+	void Prepare();
+	const OpenBatchArrays& Arrays() const { return arrays; }
+	/// Prepare and run the orders, done gets the index of every order in the order of Add with its request
+	/// and the result of Run (request id, 0 when the order was rejected)
+	void Run(bool autoExecution, const std::string &comment, std::function<void(int, OpenOrderSignal&, int)> done);
+
+private:
+	/// Account loaded once per batch, the pass reads it and the orders which pass run with it.
+	/// A whole UserInfo is as large as its group, the group is shared by the accounts of the batch
+	struct Account
+	{
+		UserRecord      record;
+		const ConGroup* group;
+	};
+
+	struct Order
+	{
+		int         login;
+		std::string symbol;
+		double      volume;
+		int         cmd;
+		double      commission;
+		/// Loaded by the batch, account and symbol point into the tables of the batch
+		const Account*   account;
+		const ConSymbol* security;
+		double           bid;
+		double           ask;
+	};
+
+	void Gather(size_t index);
+
+	MT4Server* server;
+	CCommissionTable* commissions;
+	CVerdictCache* verdicts;
+	/// Equity snapshots of the burst window, NULL or a missing snapshot skips the margin estimate
+	CEquityCache* equities;
+	std::vector<Order> orders;
+	OpenBatchArrays arrays;
+	/// Accounts by login, groups and symbols by name, prices and margin rates by group and symbol
+	std::map<int, Account> accounts;
+	std::map<std::string, ConGroup> groups;
+	std::map<std::string, ConSymbol> symbols;
+	std::map<std::string, std::pair<double, double> > prices;
+	std::map<std::string, double> rates;
+};
@@ -1,14 +1,17 @@
-#include "stdafx.h"
+#include "StdAfx.h"
 #include "OpenOrderSignal.h"
 #include "Logger.h"
 
-OpenOrderSignal::OpenOrderSignal()
+OpenOrderSignal::OpenOrderSignal() :
+	commissions(NULL)
 {
 
 }
 
-OpenOrderSignal::OpenOrderSignal(int login, std::string symbol, double volume, int cmd, std::string comment, MT4Server* server, double commission)
+OpenOrderSignal::OpenOrderSignal(int login, std::string symbol, double volume, int cmd, std::string comment, MT4Server* server, double commission, CCommissionTable* commissions, CVerdictCache* verdicts) :
+	commissions(commissions)
 {
+	this->verdicts = verdicts;
 	std::ostringstream strs2;
 	strs2 << commission;
 	std::string str2 = strs2.str();
@@ -38,6 +41,20 @@ OpenOrderSignal::OpenOrderSignal(int login, std::string symbol, double volume, i
 	LogMessage(message, CmdOK, server);
 #endif
 }
+
+OpenOrderSignal::OpenOrderSignal(const OpenContext &context, int volume, int cmd, std::string comment, MT4Server* server, double commission, CCommissionTable* commissions, CVerdictCache* verdicts) :
+	comment(comment), commissions(commissions), cmd(cmd), volume(volume)
+{
+	this->server = server;
+	this->verdicts = verdicts;
+	ui = context.ui;
+	symbol = context.symbol;
+	currentBid = context.bid;
+	currentAsk = context.ask;
+	provider_commission = commission;
+	open_price = (cmd == OP_SELL ? currentBid : currentAsk);
+}
+
 void OpenOrderSignal::CalculateVolume()
 {
 	int min_lot = ui.grp.secgroups[symbol.type].lot_min;
@@ -60,13 +77,13 @@ bool OpenOrderSignal::CheckParametres()
 		char message[256];
 		sprintf_s(message, 256, "Invalid order data. Login: %i, Volume: %i", ui.login, volume);
 		LogMessage(message, CmdErr, server);
-		return false;
+		return Fail(ui.login == 0 || server == NULL ? ResultInvalidOrder : ResultInvalidVolume);
 	}
 	
 	if(cmd != OP_BUY && cmd != OP_SELL)
 	{
 		LogMessage("Invalid order type", CmdErr, server);
-		return false;
+		return Fail(ResultInvalidOrder);
 	}
 
 	
@@ -78,13 +95,13 @@ bool OpenOrderSignal::CheckParametres()
 	if(symbol.long_only != FALSE && cmd==OP_SELL)
 	{		
 		LogMessage("Long only avaliable", CmdErr, server);
-		return false;
+		return Fail(ResultInvalidSymbol);
 	}
 	//--- check close only
 	if(symbol.trade==TRADE_CLOSE)
 	{		
 		LogMessage("Close only avaliable", CmdErr, server);
-		return false;
+		return Fail(ResultInvalidSymbol);
 	}
 	//--- prepare transaction for checks
 	trans.cmd   =cmd;
@@ -96,35 +113,35 @@ bool OpenOrderSignal::CheckParametres()
 	
 	COPY_STR(trans.symbol, symbol.symbol);
 	//--- check tick size
-	if(server->TradesCheckTickSize(open_price, &symbol)==FALSE)
+	if(CheckTickSize(open_price)==FALSE)
 	{		
 		LogMessage("Invalid tick size", CmdErr, server);
-		return false;
+		return Fail(ResultInvalidPrice);
 	}
 	//--- check secutiry
-	if(server->TradesCheckSecurity(&symbol, &ui.grp)!=RET_OK)
+	if(CheckSecurity()!=RET_OK)
 	{		
 		LogMessage("Invalid symbol for current group", CmdErr, server);
-		return false;
+		return Fail(ResultInvalidSymbol);
 	}
 	//--- check volume
-	if(server->TradesCheckVolume(&trans,&symbol,&ui.grp,TRUE)!=RET_OK)
+	if(CheckVolume(trans)!=RET_OK)
 	{		
 		LogMessage("Invalid volume for group", CmdErr, server);
-		return false;
+		return Fail(ResultInvalidVolume);
 	}
 	//--- check stops
 	if(server->TradesCheckStops(&trans,&symbol,&ui.grp,NULL)!=RET_OK)
 	{	
 		LogMessage("Invalid SL\TP", CmdErr, server);
-		return false;
+		return Fail(ResultInvalidStops);
 	}
 	//--- check margin
 	margin = server->TradesMarginCheck(&ui, &trans, &profit, &freemargin, &prevmargin);
 	if((freemargin+ui.grp.credit)<0 && (symbol.margin_hedged_strong!=FALSE || prevmargin<=margin))
 	{		
 		LogMessage("Not enough money", CmdErr, server);
-		return false;
+		return Fail(ResultNoMoney);
 	}
 
 	return true;
@@ -199,6 +216,8 @@ bool OpenOrderSignal::Execute(double bid, double ask)
 		trade.commission -= signalCommission;
 		trade.conv_rates[1] = 0;
 		server->OrdersUpdate(&trade, &ui, UPDATE_NORMAL);		
+		ticket = order;
+		price = open_price;
 	}
 	//here we need to send commission notification
 	//signalCommission * server->TradesCalcRates(ui.group, ui.grp.currency, "USD");
@@ -208,37 +227,11 @@ bool OpenOrderSignal::Execute(double bid, double ask)
 
 double OpenOrderSignal::GetTradingCommission(int volume, double provider_commission)
 {
-	if (strstr(symbol.symbol, "bo") != NULL || strstr(symbol.symbol, "bin") != NULL)
-	{
-		//for binaries we take $1 dollar of commission for each 10 dollars of bid. volume = bid * 100.
-		//return (0.001 * volume) * server->TradesCalcRates(ui.group, "USD", ui.grp.currency);
-		return 0.0;
-	}
-	else
+	if(commissions == NULL)
 	{
-		std::string sym = symbol.symbol;
-		std::string cur = sym.substr(3, 3);
-		double rate = server->TradesCalcRates(ui.group, cur.c_str(), ui.grp.currency);
-
-		char info[256];
-		sprintf_s(info, 25, "%s %s %0.4f", cur.c_str(), ui.grp.currency, rate);
-
-		LogMessage(info, CmdOK, server);
-
-		if (rate <= 0)
-		{
-			rate = server->TradesCalcRates(ui.group, "USD", ui.grp.currency);
-		}
-
-		if (symbol.digits == 3 || symbol.digits == 5)
-		{
-			rate *= 10;
-		}
-
-		double point_price_per_lot = symbol.contract_size * symbol.point * rate;
-		
-		return provider_commission * point_price_per_lot * (0.01 * volume);
+		return provider_commission * CCommissionTable::CalculatePointValue(server, symbol, ui) * (0.01 * volume);
 	}
+	return commissions->Commission(server, symbol, ui, provider_commission, volume);
 }
 
 RequestInfo OpenOrderSignal::GenerateRequest()
@@ -269,7 +262,7 @@ RequestInfo OpenOrderSignal::GenerateRequest()
 	request.id = 0;
 	request.manager = 0;
 	request.status = DC_REQUEST;
-	request.time = GetTickCount();	
+	request.time = PlatformTickCount();	
 
 	if(RET_OK != CallTradeTransactionForAllPlugins(&request.trade, &ui, &request.id))
 	{
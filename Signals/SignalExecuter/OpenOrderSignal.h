@@ -1,19 +1,34 @@
 #pragma once
-#include "mt4part\MT4ServerEmulator.h"
+#include "mt4part/MT4ServerEmulator.h"
 #include "BaseExecutionSignal.h"
+#include "mt4part/CommissionTable.h"
+
+/// Account, symbol and prices of an open order, loaded once by the batch of the signal
+struct OpenContext
+{
+	UserInfo  ui;
+	ConSymbol symbol;
+	double    bid;
+	double    ask;
+};
 
 class OpenOrderSignal : public BaseExecutionSignal
 {
 public:
 	OpenOrderSignal();
-	OpenOrderSignal(int login, std::string symbol, double volume, int cmd, std::string comment, MT4Server* server, double commission);
+	OpenOrderSignal(int login, std::string symbol, double volume, int cmd, std::string comment, MT4Server* server, double commission, CCommissionTable* commissions, CVerdictCache* verdicts);
+	/// Order of a batch, the volume is computed already in hundredths of a lot
+	OpenOrderSignal(const OpenContext &context, int volume, int cmd, std::string comment, MT4Server* server, double commission, CCommissionTable* commissions, CVerdictCache* verdicts);
 	~OpenOrderSignal(void);
 	virtual bool Execute(double bid, double ask);
+	int Volume() const { return volume; }
 private:	
 	double GetTradingCommission(int volume, double provider_commission);
 	double equity, margin, free_margin, profit, prevmargin, open_price, provider_commission;
 	void CalculateVolume();
 	std::string comment;
+	/// Point values of the plugin, shared by all orders
+	CCommissionTable* commissions;
 
 	int cmd;
 	int volume;
@@ -1,4 +1,4 @@
 
-#include "stdafx.h"
+#include "StdAfx.h"
 //+------------------------------------------------------------------+
 std::string path = "";
\ No newline at end of file
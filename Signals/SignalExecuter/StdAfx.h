@@ -11,7 +11,15 @@
 
 #include <time.h>
 #include <stdio.h>
-#include "windows.h"
+#include "Platform.h"
+#ifndef _WIN32
+//--- the MT4 server API and the plugin entry points are written for MSVC
+#define WINAPI
+#define APIENTRY
+#define __stdcall
+#define __declspec(x)
+#define abstract
+#endif
 #include <vector>
 #include <map>
 #include <sstream>
@@ -0,0 +1,107 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// Bounded multi-producer / multi-consumer queue (D. Vyukov's sequenced ring).
+/// T must be trivially copyable: it is written into preallocated cells, no allocation on push.
+template<typename T>
+class LockFreeQueue
+{
+public:
+	/// Capacity is rounded up to the power of two
+	explicit LockFreeQueue(size_t capacity) :
+		cells(RoundUp(capacity)), mask(cells.size() - 1)
+	{
+		for(size_t i = 0; i < cells.size(); i++)
+			cells[i].sequence.store(i, std::memory_order_relaxed);
+		enqueuePos.store(0, std::memory_order_relaxed);
+		dequeuePos.store(0, std::memory_order_relaxed);
+	}
+
+	/// Push element, returns false when the queue is full
+	bool TryPush(const T &value)
+	{
+		Cell *cell;
+		size_t pos = enqueuePos.load(std::memory_order_relaxed);
+		for(;;)
+		{
+			cell = &cells[pos & mask];
+			size_t seq = cell->sequence.load(std::memory_order_acquire);
+			intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+			if(diff == 0)
+			{
+				if(enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if(diff < 0)
+				return false;
+			else
+				pos = enqueuePos.load(std::memory_order_relaxed);
+		}
+		cell->data = value;
+		cell->sequence.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	/// Pop element, returns false when the queue is empty
+	bool TryPop(T &value)
+	{
+		Cell *cell;
+		size_t pos = dequeuePos.load(std::memory_order_relaxed);
+		for(;;)
+		{
+			cell = &cells[pos & mask];
+			size_t seq = cell->sequence.load(std::memory_order_acquire);
+			intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+			if(diff == 0)
+			{
+				if(dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if(diff < 0)
+				return false;
+			else
+				pos = dequeuePos.load(std::memory_order_relaxed);
+		}
+		value = cell->data;
+		cell->sequence.store(pos + mask + 1, std::memory_order_release);
+		return true;
+	}
+
+	/// Approximate check, exact only when producers and consumers are idle
+	bool IsEmpty() const
+	{
+		return enqueuePos.load(std::memory_order_acquire) == dequeuePos.load(std::memory_order_acquire);
+	}
+
+private:
+	static size_t RoundUp(size_t capacity)
+	{
+		size_t size = 2;
+		while(size < capacity)
+			size <<= 1;
+		return size;
+	}
+
+	LockFreeQueue(const LockFreeQueue&);
+	LockFreeQueue& operator=(const LockFreeQueue&);
+
+	struct Cell
+	{
+		Cell() : data() {}
+		Cell(const Cell &other) : data(other.data) {}
+		std::atomic<size_t> sequence;
+		T data;
+	};
+
+	std::vector<Cell> cells;
+	size_t mask;
+	/// Producer and consumer positions live on separate cache lines
+	char pad0[64];
+	std::atomic<size_t> enqueuePos;
+	char pad1[64];
+	std::atomic<size_t> dequeuePos;
+	char pad2[64];
+};
@@ -1,21 +1,19 @@
-#include "stdafx.h"
+#include "StdAfx.h"
 #include "Sync.h"
 
 CSync::CSync() 
 { 
-	ZeroMemory(&m_cs,sizeof(m_cs)); InitializeCriticalSection(&m_cs); 
 }
 CSync::~CSync() 
 {
-	DeleteCriticalSection(&m_cs);   ZeroMemory(&m_cs,sizeof(m_cs));   
 }
 
 void CSync::Lock() 
 {
-	EnterCriticalSection(&m_cs); 
+	m_mutex.Lock(); 
 }
 
 void CSync::Unlock() 
 {
-	LeaveCriticalSection(&m_cs); 
+	m_mutex.Unlock(); 
 }
\ No newline at end of file
@@ -1,9 +1,10 @@
 #pragma once
+#include "Platform.h"
 
 class CSync
   {
 private:
-   CRITICAL_SECTION  m_cs;
+   PlatformMutex     m_mutex;
 public:
 	CSync();
 	~CSync();
@@ -13,8 +13,7 @@ Thread::~Thread(void)
 int Thread::startMainThread()
 {
 	bMainThread = true;
-	DWORD thread;	
-	mainThread = CreateThread(NULL, 0, MainThread, this, 0, &thread);
+	mainThread.Start(MainThread, this);
 	return 0;
 }
 
@@ -23,8 +22,8 @@ DWORD WINAPI Thread::MainThread(LPVOID pParam)
 	Thread *self = (Thread*)pParam;
 	while(self->bMainThread)
 	{
-		self->ThreadFunction();
-		Sleep(1);
+		if(self->ThreadFunction() == 0)
+			PlatformSleep(1);
 	}
 	return 0;
 }
@@ -42,6 +41,6 @@ void Thread::Stop()
 int Thread::endMainThread()
 {
 	bMainThread = false;
-	WaitForSingleObject(mainThread, 2000);
+	mainThread.Join(2000);
 	return 0;
 }
@@ -1,5 +1,5 @@
 #pragma once
-#include "windows.h"
+#include "Platform.h"
 
 class Thread abstract
 {
@@ -12,9 +12,10 @@ private:
 	static DWORD WINAPI MainThread(LPVOID pParam);
 	int startMainThread();
 	int endMainThread();
-	HANDLE mainThread;
+	PlatformThread mainThread;
 	volatile bool bMainThread;
 protected:
+	/// Returns non-zero when there may be more work, so the loop calls it again without sleeping
 	virtual int ThreadFunction() = 0;
 };
 
@@ -3,13 +3,15 @@
 //|                    Copyright  2009-2010, Tools For Brokers Inc. |
 //|                                     http://www.tools4brokers.com |
 //+------------------------------------------------------------------+
-#include "stdafx.h"
+#include "StdAfx.h"
 #include "mt4part/Configuration.h"
 #include "mt4part/Processor.h"
+#include "mt4part/PluginSettings.h"
 #include <iostream>
 #include "mt4part/MT4ServerEmulator.h"
 
 MT4Server* PluginServer = NULL;
+CSync      ExtReconfigSync;
 void UpdatePluginConifg();
 
 //#ifndef _DEBUG
@@ -63,6 +65,7 @@ int APIENTRY MtSrvStartup(CServerInterface *server)
 void APIENTRY        MtSrvCleanup(void)
 {
 	processor.Clear();
+	ExtPluginChain.Clear();
 }
 
 void APIENTRY MtSrvAbout(PluginInfo *info)
@@ -73,24 +76,22 @@ void APIENTRY MtSrvAbout(PluginInfo *info)
 
 void UpdatePluginConifg() 
 { 
- int debugMode;
- ExtConfig.GetInteger(0, "debugMode", &debugMode, "1");
-
- char host[64];
- ExtConfig.GetString(1, "host", host, 64, "127.0.0.1");
-
- char port[64];
- ExtConfig.GetString(2, "port", port, 64, "2222");
-
- char name[64];
- ExtConfig.GetString(3, "name", name, 64, "Server");
- 
- int autoExecution;
- ExtConfig.GetInteger(0, "autoExecution", &autoExecution, "1");
- processor.Clear();
- processor.Initialize(host, port, name, debugMode > 0, autoExecution > 0);
- std::cout << "Signal executer reinit" << std::endl;
-
+ //--- publish and apply in one step, so concurrent config calls cannot apply an older snapshot last
+ ExtReconfigSync.Lock();
+ PluginSettings parsed = CPluginSettings::Parse(ExtConfig);
+ //--- rejected settings are not published, the current snapshot stays the one the processor runs on
+ if(!processor.Validate(&parsed))
+	{
+	 std::cout << "Signal executer settings rejected" << std::endl;
+	 ExtReconfigSync.Unlock();
+	 return;
+	}
+ const PluginSettings *settings = ExtSettings.Publish(parsed);
+ if(processor.Reconfigure(settings))
+	std::cout << "Signal executer reinit" << std::endl;
+ else
+	std::cout << "Signal executer settings updated" << std::endl;
+ ExtReconfigSync.Unlock();
 }
 
 int APIENTRY MtSrvPluginCfgAdd(const PluginCfg *cfg)
@@ -120,13 +121,33 @@ int APIENTRY MtSrvPluginCfgTotal()                              { return ExtConf
 
 void APIENTRY MtSrvTradesUpdate(TradeRecord *trade,UserInfo *user,const int mode)
 {
-	processor.OnTradeUpdate(*user, trade, mode);
+	processor.OnTradeUpdate(user, trade, mode);
 
 }
 
 void APIENTRY MtSrvTradesAddExt(TradeRecord *trade,const UserInfo *user,const ConSymbol *symb,const int mode)
 {
-	processor.OnNewTrade(*user, trade, mode);
+	processor.OnNewTrade(user, trade, mode);
+}
+
+void APIENTRY MtSrvGroupsAdd(const ConGroup *group)
+{
+	processor.OnConfigChanged();
+}
+
+void APIENTRY MtSrvGroupsDelete(const ConGroup *group)
+{
+	processor.OnConfigChanged();
+}
+
+void APIENTRY MtSrvSymbolsAdd(const ConSymbol *symbol)
+{
+	processor.OnConfigChanged();
+}
+
+void APIENTRY MtSrvSymbolsDelete(const ConSymbol *symbol)
+{
+	processor.OnConfigChanged();
 }
 
 int APIENTRY MtSrvDealerConfirm(const int id,const UserInfo *us,double *prices)
@@ -0,0 +1,106 @@
+#include "StdAfx.h"
+#include "CommissionTable.h"
+
+size_t CommissionKeyHash::operator()(const CommissionKey &key) const
+{
+	//--- FNV-1a
+	const unsigned char *data = (const unsigned char*)&key;
+	unsigned int hash = 2166136261u;
+	for(size_t i = 0; i < sizeof(CommissionKey); i++)
+		hash = (hash ^ data[i]) * 16777619u;
+	return hash;
+}
+
+CCommissionTable::CCommissionTable() :
+	refresh(0)
+{
+}
+
+void CCommissionTable::SetRefresh(int refresh)
+{
+	this->refresh = refresh < 0 ? 0 : refresh;
+	if(this->refresh == 0)
+		Clear();
+}
+
+int CCommissionTable::GetRefresh()
+{
+	return refresh;
+}
+
+double CCommissionTable::Commission(MT4Server *server, const ConSymbol &symbol, const UserInfo &ui, double provider_commission, int volume)
+{
+	return provider_commission * PointValue(server, symbol, ui) * (0.01 * volume);
+}
+
+double CCommissionTable::PointValue(MT4Server *server, const ConSymbol &symbol, const UserInfo &ui)
+{
+	DWORD limit = refresh;
+	if(limit == 0)
+		return CalculatePointValue(server, symbol, ui);
+
+	//--- zero padded, so equal names compare equal byte for byte
+	CommissionKey key = {0};
+	COPY_STR(key.symbol, symbol.symbol);
+	COPY_STR(key.currency, ui.grp.currency);
+	DWORD now = PlatformTickCount();
+	sync.Lock();
+	auto it = rates.find(key);
+	if(it != rates.end() && now - it->second.computed < limit)
+	{
+		double pointValue = it->second.pointValue;
+		sync.Unlock();
+		return pointValue;
+	}
+	sync.Unlock();
+
+	//--- rates are asked outside of the lock, two threads may compute one entry at once
+	CommissionRate rate;
+	rate.pointValue = CalculatePointValue(server, symbol, ui);
+	rate.computed = now;
+	sync.Lock();
+	rates[key] = rate;
+	sync.Unlock();
+	return rate.pointValue;
+}
+
+double CCommissionTable::CalculatePointValue(MT4Server *server, const ConSymbol &symbol, const UserInfo &ui)
+{
+	if(strstr(symbol.symbol, "bo") != NULL || strstr(symbol.symbol, "bin") != NULL)
+	{
+		//for binaries we take $1 dollar of commission for each 10 dollars of bid. volume = bid * 100.
+		//return (0.001 * volume) * server->TradesCalcRates(ui.group, "USD", ui.grp.currency);
+		return 0.0;
+	}
+
+	//--- quote currency of a forex symbol
+	std::string sym = symbol.symbol;
+	std::string cur = sym.size() > 3 ? sym.substr(3, 3) : "";
+	double rate = server->TradesCalcRates(ui.group, cur.c_str(), ui.grp.currency);
+	if(rate <= 0)
+	{
+		rate = server->TradesCalcRates(ui.group, "USD", ui.grp.currency);
+	}
+
+	if(symbol.digits == 3 || symbol.digits == 5)
+	{
+		rate *= 10;
+	}
+
+	return symbol.contract_size * symbol.point * rate;
+}
+
+void CCommissionTable::Clear()
+{
+	sync.Lock();
+	rates.clear();
+	sync.Unlock();
+}
+
+size_t CCommissionTable::Size()
+{
+	sync.Lock();
+	size_t size = rates.size();
+	sync.Unlock();
+	return size;
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include <string>
+#include <unordered_map>
+#include "common/Sync.h"
+#include "MT4ServerEmulator.h"
+
+/// Symbol and group currency, copied as they are in the server structures
+struct CommissionKey
+{
+	char symbol[12];
+	char currency[12];
+
+	bool operator==(const CommissionKey &other) const
+	{
+		return memcmp(this, &other, sizeof(CommissionKey)) == 0;
+	}
+};
+
+struct CommissionKeyHash
+{
+	size_t operator()(const CommissionKey &key) const;
+};
+
+/// Point value of one lot of a symbol in a group currency
+struct CommissionRate
+{
+	double pointValue;
+	DWORD  computed;
+};
+
+/// Commission of signal orders by symbol and group currency.
+/// The point value per lot depends on the contract size, point and digits of the symbol and on the
+/// rate of its quote currency; it is computed once and reused until the rates get older than the
+/// refresh interval or the symbol/group configuration changes, so a commission is one multiply.
+/// Quotes do not invalidate it: a commission may be charged on rates as old as the refresh interval.
+class CCommissionTable
+{
+public:
+	CCommissionTable();
+
+	/// Age of the rates in milliseconds after which a point value is computed again, 0 disables the table
+	void   SetRefresh(int refresh);
+	int    GetRefresh();
+
+	/// Commission of the order: provider commission per point and lot times the point value of the volume
+	double Commission(MT4Server *server, const ConSymbol &symbol, const UserInfo &ui, double provider_commission, int volume);
+	/// Point value per lot in the currency of the group of the user
+	double PointValue(MT4Server *server, const ConSymbol &symbol, const UserInfo &ui);
+	/// Point value per lot straight from the server, what the table holds
+	static double CalculatePointValue(MT4Server *server, const ConSymbol &symbol, const UserInfo &ui);
+
+	/// Drop everything (symbol or group configuration changed)
+	void   Clear();
+	size_t Size();
+
+private:
+	CSync sync;
+	std::unordered_map<CommissionKey, CommissionRate, CommissionKeyHash> rates;
+	volatile int refresh;
+};
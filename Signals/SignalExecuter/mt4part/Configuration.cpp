@@ -3,7 +3,7 @@
 //|                 Copyright  2001-2006, MetaQuotes Software Corp. |
 //|                                        http://www.metaquotes.net |
 //+------------------------------------------------------------------+
-#include "stdafx.h"
+#include "StdAfx.h"
 #include "Configuration.h"
 #include "common/stringfile.h"
 
@@ -0,0 +1,123 @@
+#include "StdAfx.h"
+#include "DedupeIndex.h"
+
+/// 64K entries, 1 MB
+#define DEDUPE_INDEX_SLOTS  (1 << 16)
+/// Slots probed from the home slot
+#define DEDUPE_INDEX_PROBES 8
+/// Expiry steps per window
+#define DEDUPE_INDEX_EPOCHS 8
+
+CDedupeIndex::CDedupeIndex() :
+	entries(DEDUPE_INDEX_SLOTS), mask(DEDUPE_INDEX_SLOTS - 1), window(600), duplicates(0), evictions(0)
+{
+}
+
+void CDedupeIndex::SetWindow(int window)
+{
+	sync.Lock();
+	//--- epochs of the old window mean nothing with the new one
+	if(window != this->window)
+	{
+		this->window = window < 0 ? 0 : window;
+		for(size_t i = 0; i < entries.size(); i++)
+			entries[i].fingerprint = 0;
+	}
+	sync.Unlock();
+}
+
+bool CDedupeIndex::Insert(const DedupeKey &key)
+{
+	if(window <= 0)
+		return true;
+
+	unsigned long long fingerprint = Fingerprint(key);
+	unsigned int epoch = Epoch();
+	sync.Lock();
+	Entry *free = NULL, *oldest = NULL;
+	for(unsigned int i = 0, slot = (unsigned int)fingerprint & mask; i < DEDUPE_INDEX_PROBES; i++, slot = (slot + 1) & mask)
+	{
+		Entry &entry = entries[slot];
+		if(!Alive(entry, epoch))
+		{
+			if(free == NULL)
+				free = &entry;
+			continue;
+		}
+		if(entry.fingerprint == fingerprint)
+		{
+			sync.Unlock();
+			duplicates.fetch_add(1);
+			return false;
+		}
+		if(oldest == NULL || epoch - entry.epoch > epoch - oldest->epoch)
+			oldest = &entry;
+	}
+	if(free == NULL)
+	{
+		free = oldest;
+		evictions.fetch_add(1);
+	}
+	free->fingerprint = fingerprint;
+	free->epoch = epoch;
+	sync.Unlock();
+	return true;
+}
+
+void CDedupeIndex::Erase(const DedupeKey &key)
+{
+	if(window <= 0)
+		return;
+
+	unsigned long long fingerprint = Fingerprint(key);
+	sync.Lock();
+	for(unsigned int i = 0, slot = (unsigned int)fingerprint & mask; i < DEDUPE_INDEX_PROBES; i++, slot = (slot + 1) & mask)
+	{
+		if(entries[slot].fingerprint == fingerprint)
+		{
+			entries[slot].fingerprint = 0;
+			break;
+		}
+	}
+	sync.Unlock();
+}
+
+void CDedupeIndex::Clear()
+{
+	sync.Lock();
+	for(size_t i = 0; i < entries.size(); i++)
+	{
+		entries[i].fingerprint = 0;
+		entries[i].epoch = 0;
+	}
+	sync.Unlock();
+}
+
+unsigned long long CDedupeIndex::Fingerprint(const DedupeKey &key)
+{
+	//--- FNV-1a, then a final mix so that the low bits used for the slot depend on every field
+	unsigned long long hash = 14695981039346656037ull;
+	const std::string &comment = *key.comment;
+	for(size_t i = 0; i < comment.size(); i++)
+		hash = (hash ^ (unsigned char)comment[i]) * 1099511628211ull;
+	int fields[3] = { key.login, key.action, key.order };
+	for(int i = 0; i < 3; i++)
+		hash = (hash ^ (unsigned int)fields[i]) * 1099511628211ull;
+	hash ^= hash >> 33;
+	hash *= 0xff51afd7ed558ccdull;
+	hash ^= hash >> 33;
+	//--- zero marks a free slot
+	return hash == 0 ? 1 : hash;
+}
+
+unsigned int CDedupeIndex::Epoch() const
+{
+	//--- the tick count wraps every 49 days, entries alive at that moment expire early
+	unsigned int length = (unsigned int)window * 1000 / DEDUPE_INDEX_EPOCHS;
+	return PlatformTickCount() / (length > 0 ? length : 1);
+}
+
+bool CDedupeIndex::Alive(const Entry &entry, unsigned int epoch) const
+{
+	return entry.fingerprint != 0 && epoch - entry.epoch < DEDUPE_INDEX_EPOCHS;
+}
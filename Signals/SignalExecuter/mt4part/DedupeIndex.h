@@ -0,0 +1,55 @@
+#pragma once
+#include <atomic>
+#include <string>
+#include <vector>
+#include "common/Sync.h"
+
+/// Identity of one executed order of an execution signal
+struct DedupeKey
+{
+	const std::string *comment;
+	int login;
+	int action;
+	int order;
+};
+
+/// Fixed-memory set of recently executed orders, drops repeated execution signals of a resending router.
+/// Open addressing over 64-bit fingerprints stamped with an epoch; an entry older than the window
+/// is free again, so nothing has to be purged. When a probe run has no free slot its oldest entry is evicted.
+class CDedupeIndex
+{
+public:
+	CDedupeIndex();
+
+	/// Window in seconds, entries expire in steps of 1/8 of it. 0 disables the index
+	void SetWindow(int window);
+
+	/// Remember the key, false when it is already known within the window
+	bool Insert(const DedupeKey &key);
+	/// Forget the key, so a failed execution may be retried
+	void Erase(const DedupeKey &key);
+	void Clear();
+
+	/// Rejected duplicates and entries evicted before they expired
+	unsigned long long Duplicates() const { return duplicates.load(); }
+	unsigned long long Evictions() const { return evictions.load(); }
+
+private:
+	struct Entry
+	{
+		unsigned long long fingerprint;
+		unsigned int       epoch;
+	};
+
+	static unsigned long long Fingerprint(const DedupeKey &key);
+	unsigned int Epoch() const;
+	bool Alive(const Entry &entry, unsigned int epoch) const;
+
+	CSync sync;
+	std::vector<Entry> entries;
+	unsigned int mask;
+	volatile int window;
+
+	std::atomic<unsigned long long> duplicates;
+	std::atomic<unsigned long long> evictions;
+};
@@ -0,0 +1,751 @@
+#include "StdAfx.h"
+#include "EmulatorStore.h"
+
+CEmulatorStore ExtEmulatorStore;
+
+/// Symbols of the synthetic dataset with their initial prices
+static const struct { const char *name; double bid; int digits; } ExtDatasetSymbols[] =
+{
+	{ "EURUSD", 1.10000, 5 }, { "GBPUSD", 1.30000, 5 }, { "USDJPY", 110.000, 3 }, { "USDCHF", 0.92000, 5 },
+	{ "AUDUSD", 0.75000, 5 }, { "USDCAD", 1.30000, 5 }, { "NZDUSD", 0.70000, 5 }, { "EURGBP", 0.85000, 5 },
+	{ "EURJPY", 121.000, 3 }, { "GBPJPY", 143.000, 3 }
+};
+
+CEmulatorStore::CEmulatorStore() :
+	nextTicket(1), seed(1)
+{
+}
+
+CEmulatorStore::~CEmulatorStore()
+{
+}
+
+void CEmulatorStore::Clear()
+{
+	sync.Lock();
+	groups.clear();
+	groupIndex.clear();
+	symbols.clear();
+	quotes.clear();
+	symbolIndex.clear();
+	users.clear();
+	open.clear();
+	openByLogin.clear();
+	closed.clear();
+	closedIndex.clear();
+	nextTicket = 1;
+	sync.Unlock();
+}
+
+void CEmulatorStore::Generate(const EmulatorDataset &dataset)
+{
+	Clear();
+
+	sync.Lock();
+	seed = dataset.seed != 0 ? dataset.seed : 1;
+	time_t now = time(NULL);
+
+	//--- groups
+	int groupsTotal = dataset.groups > 0 ? dataset.groups : 1;
+	for(int i = 0; i < groupsTotal; i++)
+	{
+		ConGroup group = {0};
+		_snprintf_s(group.group, sizeof(group.group), _TRUNCATE, "demo-%d", i + 1);
+		COPY_STR(group.currency, "USD");
+		group.enable = TRUE;
+		group.default_leverage = 100;
+		group.default_deposit = 10000.0;
+		group.margin_call = 50;
+		group.margin_stopout = 20;
+		group.maxpositions = 0;
+		groupIndex[group.group] = (int)groups.size();
+		groups.push_back(group);
+	}
+
+	//--- symbols and prices
+	for(size_t i = 0; i < sizeof(ExtDatasetSymbols) / sizeof(ExtDatasetSymbols[0]); i++)
+	{
+		ConSymbol symbol = {0};
+		COPY_STR(symbol.symbol, ExtDatasetSymbols[i].name);
+		std::string base = std::string(ExtDatasetSymbols[i].name).substr(0, 3);
+		COPY_STR(symbol.currency, base.c_str());
+		COPY_STR(symbol.margin_currency, base.c_str());
+		symbol.digits = ExtDatasetSymbols[i].digits;
+		symbol.point = symbol.digits == 3 ? 0.001 : 0.00001;
+		symbol.tick_size = symbol.point;
+		symbol.contract_size = 100000.0;
+		symbol.spread = 10;
+		symbol.trade = TRADE_FULL;
+		symbol.margin_divider = 1.0;
+
+		Quote quote;
+		quote.bid = ExtDatasetSymbols[i].bid;
+		quote.ask = quote.bid + symbol.spread * symbol.point;
+		quote.time = now;
+
+		symbolIndex[symbol.symbol] = (int)symbols.size();
+		symbols.push_back(symbol);
+		quotes.push_back(quote);
+	}
+
+	//--- accounts
+	users.reserve(dataset.accounts);
+	for(int i = 0; i < dataset.accounts; i++)
+	{
+		UserRecord user = {0};
+		user.login = 100000 + i;
+		COPY_STR(user.group, groups[i % groupsTotal].group);
+		_snprintf_s(user.name, sizeof(user.name), _TRUNCATE, "Account %d", user.login);
+		user.enable = TRUE;
+		user.leverage = 100;
+		user.balance = 1000.0 + random() % 99000;
+		user.regdate = now;
+		users[user.login] = user;
+	}
+
+	//--- open orders
+	open.reserve(dataset.orders);
+	for(int i = 0; i < dataset.orders && dataset.accounts > 0; i++)
+	{
+		int symbolPos = random() % symbols.size();
+		const ConSymbol &symbol = symbols[symbolPos];
+		const Quote &quote = quotes[symbolPos];
+
+		TradeRecord trade = {0};
+		trade.login = 100000 + random() % dataset.accounts;
+		COPY_STR(trade.symbol, symbol.symbol);
+		trade.digits = symbol.digits;
+		trade.cmd = random() % 2 == 0 ? OP_BUY : OP_SELL;
+		trade.volume = 1 + random() % 100;
+		trade.open_time = now - random() % 86400;
+		trade.open_price = (trade.cmd == OP_BUY ? quote.ask : quote.bid) + ((int)(random() % 200) - 100) * symbol.point;
+		trade.close_price = trade.cmd == OP_BUY ? quote.bid : quote.ask;
+		trade.margin_rate = 1.0;
+		addOpen(trade);
+	}
+	sync.Unlock();
+}
+
+void CEmulatorStore::Tick()
+{
+	sync.Lock();
+	time_t now = time(NULL);
+	for(size_t i = 0; i < quotes.size(); i++)
+	{
+		double step = ((int)(random() % 21) - 10) * symbols[i].point;
+		quotes[i].bid += step;
+		quotes[i].ask += step;
+		quotes[i].time = now;
+	}
+	sync.Unlock();
+}
+
+void CEmulatorStore::SubscribeTrades(TradeHook onAdd, TradeHook onUpdate)
+{
+	sync.Lock();
+	this->onAdd = onAdd;
+	this->onUpdate = onUpdate;
+	sync.Unlock();
+}
+
+int CEmulatorStore::GroupsAdd(const ConGroup *group)
+{
+	if(group == NULL || group->group[0] == 0) return FALSE;
+
+	sync.Lock();
+	auto it = groupIndex.find(group->group);
+	if(it != groupIndex.end())
+		groups[it->second] = *group;
+	else
+	{
+		groupIndex[group->group] = (int)groups.size();
+		groups.push_back(*group);
+	}
+	sync.Unlock();
+	return TRUE;
+}
+
+int CEmulatorStore::GroupsGet(LPCSTR name, ConGroup *group)
+{
+	if(name == NULL || group == NULL) return FALSE;
+
+	int res = FALSE;
+	sync.Lock();
+	auto it = groupIndex.find(name);
+	if(it != groupIndex.end())
+	{
+		*group = groups[it->second];
+		res = TRUE;
+	}
+	sync.Unlock();
+	return res;
+}
+
+int CEmulatorStore::GroupsNext(const int pos, ConGroup *group)
+{
+	if(group == NULL) return FALSE;
+
+	int res = FALSE;
+	sync.Lock();
+	if(pos >= 0 && pos < (int)groups.size())
+	{
+		*group = groups[pos];
+		res = TRUE;
+	}
+	sync.Unlock();
+	return res;
+}
+
+int CEmulatorStore::SymbolsAdd(const ConSymbol *symbol)
+{
+	if(symbol == NULL || symbol->symbol[0] == 0) return FALSE;
+
+	sync.Lock();
+	auto it = symbolIndex.find(symbol->symbol);
+	if(it != symbolIndex.end())
+		symbols[it->second] = *symbol;
+	else
+	{
+		Quote quote = { 0.0, 0.0, 0 };
+		symbolIndex[symbol->symbol] = (int)symbols.size();
+		symbols.push_back(*symbol);
+		quotes.push_back(quote);
+	}
+	sync.Unlock();
+	return TRUE;
+}
+
+int CEmulatorStore::SymbolsGet(LPCSTR name, ConSymbol *symbol)
+{
+	if(name == NULL || symbol == NULL) return FALSE;
+
+	int res = FALSE;
+	sync.Lock();
+	auto it = symbolIndex.find(name);
+	if(it != symbolIndex.end())
+	{
+		*symbol = symbols[it->second];
+		res = TRUE;
+	}
+	sync.Unlock();
+	return res;
+}
+
+int CEmulatorStore::SymbolsNext(const int pos, ConSymbol *symbol)
+{
+	if(symbol == NULL) return FALSE;
+
+	int res = FALSE;
+	sync.Lock();
+	if(pos >= 0 && pos < (int)symbols.size())
+	{
+		*symbol = symbols[pos];
+		res = TRUE;
+	}
+	sync.Unlock();
+	return res;
+}
+
+void CEmulatorStore::PricesSet(LPCSTR symbol, const double bid, const double ask)
+{
+	if(symbol == NULL) return;
+
+	sync.Lock();
+	auto it = symbolIndex.find(symbol);
+	if(it != symbolIndex.end())
+	{
+		quotes[it->second].bid = bid;
+		quotes[it->second].ask = ask;
+		quotes[it->second].time = time(NULL);
+	}
+	sync.Unlock();
+}
+
+int CEmulatorStore::PricesGet(LPCSTR symbol, double *prices)
+{
+	if(symbol == NULL || prices == NULL) return RET_ERROR;
+
+	int res = RET_ERROR;
+	sync.Lock();
+	auto it = symbolIndex.find(symbol);
+	if(it != symbolIndex.end() && quotes[it->second].bid > 0.0)
+	{
+		prices[0] = quotes[it->second].bid;
+		prices[1] = quotes[it->second].ask;
+		res = RET_OK;
+	}
+	sync.Unlock();
+	return res;
+}
+
+double CEmulatorStore::CalcRates(LPCSTR from, LPCSTR to)
+{
+	if(from == NULL || to == NULL) return 0.0;
+	if(strcmp(from, to) == 0) return 1.0;
+
+	double rate = 0.0;
+	std::string direct = std::string(from) + to, reverse = std::string(to) + from;
+	sync.Lock();
+	auto it = symbolIndex.find(direct);
+	if(it != symbolIndex.end() && quotes[it->second].bid > 0.0)
+		rate = quotes[it->second].bid;
+	else
+	{
+		it = symbolIndex.find(reverse);
+		if(it != symbolIndex.end() && quotes[it->second].ask > 0.0)
+			rate = 1.0 / quotes[it->second].ask;
+	}
+	sync.Unlock();
+	return rate;
+}
+
+int CEmulatorStore::UsersAdd(const UserRecord *user)
+{
+	if(user == NULL || user->login <= 0) return FALSE;
+
+	sync.Lock();
+	users[user->login] = *user;
+	sync.Unlock();
+	return TRUE;
+}
+
+int CEmulatorStore::UsersGet(const int login, UserRecord *user)
+{
+	if(user == NULL) return FALSE;
+
+	int res = FALSE;
+	sync.Lock();
+	auto it = users.find(login);
+	if(it != users.end())
+	{
+		*user = it->second;
+		res = TRUE;
+	}
+	sync.Unlock();
+	return res;
+}
+
+int CEmulatorStore::UsersTotal()
+{
+	sync.Lock();
+	int total = (int)users.size();
+	sync.Unlock();
+	return total;
+}
+
+int CEmulatorStore::OrdersAdd(const TradeRecord *trade, const UserInfo *user)
+{
+	if(trade == NULL) return 0;
+
+	TradeRecord record = *trade;
+	sync.Lock();
+	if(users.find(record.login) == users.end())
+	{
+		sync.Unlock();
+		return 0;
+	}
+	if(record.open_time == 0)
+		record.open_time = time(NULL);
+	int ticket = addOpen(record);
+	sync.Unlock();
+
+	fireAdd(record, user);
+	return ticket;
+}
+
+int CEmulatorStore::OrdersUpdate(const TradeRecord *trade, const UserInfo *user, const int mode)
+{
+	if(trade == NULL) return FALSE;
+
+	TradeRecord record = *trade;
+	sync.Lock();
+	auto it = open.find(record.order);
+	if(it == open.end())
+	{
+		sync.Unlock();
+		return FALSE;
+	}
+
+	if(mode == UPDATE_CLOSE || mode == UPDATE_DELETE)
+	{
+		if(record.close_time == 0)
+			record.close_time = time(NULL);
+		removeOpen(record.order, record.login);
+		closedIndex[record.order] = closed.size();
+		closed.push_back(record);
+	}
+	else
+		it->second = record;
+	sync.Unlock();
+
+	fireUpdate(record, user, mode);
+	return TRUE;
+}
+
+int CEmulatorStore::OrdersOpen(const TradeTransInfo *trans, const UserInfo *user)
+{
+	if(trans == NULL || user == NULL || (trans->cmd != OP_BUY && trans->cmd != OP_SELL) || trans->volume <= 0)
+		return 0;
+
+	TradeRecord trade = {0};
+	sync.Lock();
+	auto it = symbolIndex.find(trans->symbol);
+	if(it == symbolIndex.end() || users.find(user->login) == users.end())
+	{
+		sync.Unlock();
+		return 0;
+	}
+	const Quote &quote = quotes[it->second];
+	trade.login = user->login;
+	COPY_STR(trade.symbol, trans->symbol);
+	trade.digits = symbols[it->second].digits;
+	trade.cmd = trans->cmd;
+	trade.volume = trans->volume;
+	trade.open_time = time(NULL);
+	trade.open_price = trans->price > 0.0 ? trans->price : (trans->cmd == OP_BUY ? quote.ask : quote.bid);
+	trade.close_price = trans->cmd == OP_BUY ? quote.bid : quote.ask;
+	trade.sl = trans->sl;
+	trade.tp = trans->tp;
+	trade.margin_rate = 1.0;
+	COPY_STR(trade.comment, trans->comment);
+	int ticket = addOpen(trade);
+	sync.Unlock();
+
+	fireAdd(trade, user);
+	return ticket;
+}
+
+int CEmulatorStore::OrdersClose(const TradeTransInfo *trans, const UserInfo *user)
+{
+	if(trans == NULL) return FALSE;
+
+	TradeRecord trade;
+	sync.Lock();
+	auto it = open.find(trans->order);
+	if(it == open.end())
+	{
+		sync.Unlock();
+		return FALSE;
+	}
+	trade = it->second;
+
+	auto sym = symbolIndex.find(trade.symbol);
+	if(sym != symbolIndex.end())
+	{
+		const Quote &quote = quotes[sym->second];
+		trade.close_price = trans->price > 0.0 ? trans->price : (trade.cmd == OP_BUY ? quote.bid : quote.ask);
+		Quote closeQuote = quote;
+		closeQuote.bid = closeQuote.ask = trade.close_price;
+		trade.profit = profit(trade, symbols[sym->second], closeQuote);
+	}
+	trade.close_time = time(NULL);
+	removeOpen(trade.order, trade.login);
+	closedIndex[trade.order] = closed.size();
+	closed.push_back(trade);
+
+	auto acc = users.find(trade.login);
+	if(acc != users.end())
+		acc->second.balance += trade.profit + trade.commission + trade.storage;
+	sync.Unlock();
+
+	fireUpdate(trade, user, UPDATE_CLOSE);
+	return TRUE;
+}
+
+int CEmulatorStore::OrdersGet(const int ticket, TradeRecord *trade)
+{
+	if(trade == NULL) return FALSE;
+
+	int res = FALSE;
+	sync.Lock();
+	auto it = open.find(ticket);
+	if(it != open.end())
+	{
+		*trade = it->second;
+		res = TRUE;
+	}
+	else
+	{
+		auto cl = closedIndex.find(ticket);
+		if(cl != closedIndex.end())
+		{
+			*trade = closed[cl->second];
+			res = TRUE;
+		}
+	}
+	sync.Unlock();
+	return res;
+}
+
+TradeRecord* CEmulatorStore::OrdersGetOpen(const int login, int *total)
+{
+	*total = 0;
+	TradeRecord *trades = NULL;
+	sync.Lock();
+	auto it = openByLogin.find(login);
+	if(it != openByLogin.end() && !it->second.empty())
+	{
+		trades = (TradeRecord*)HEAP_ALLOC(sizeof(TradeRecord) * it->second.size());
+		if(trades != NULL)
+		{
+			for(size_t i = 0; i < it->second.size(); i++)
+				trades[i] = open[it->second[i]];
+			*total = (int)it->second.size();
+		}
+	}
+	sync.Unlock();
+	return trades;
+}
+
+TradeRecord* CEmulatorStore::OrdersGet(const time_t from, const time_t to, const int *logins, const int count, int *total)
+{
+	*total = 0;
+	std::vector<TradeRecord> found;
+	sync.Lock();
+	for(int i = 0; i < count; i++)
+	{
+		auto it = openByLogin.find(logins[i]);
+		if(it == openByLogin.end()) continue;
+		for(size_t j = 0; j < it->second.size(); j++)
+		{
+			const TradeRecord &trade = open[it->second[j]];
+			if(trade.open_time >= from && (to == 0 || trade.open_time <= to))
+				found.push_back(trade);
+		}
+	}
+	sync.Unlock();
+
+	if(found.empty()) return NULL;
+	TradeRecord *trades = (TradeRecord*)HEAP_ALLOC(sizeof(TradeRecord) * found.size());
+	if(trades == NULL) return NULL;
+	memcpy(trades, &found[0], sizeof(TradeRecord) * found.size());
+	*total = (int)found.size();
+	return trades;
+}
+
+TradeRecord* CEmulatorStore::OrdersGetClosed(const time_t from, const time_t to, const int *logins, const int count, int *total)
+{
+	*total = 0;
+	std::vector<TradeRecord> found;
+	sync.Lock();
+	for(size_t i = 0; i < closed.size(); i++)
+	{
+		const TradeRecord &trade = closed[i];
+		if(trade.close_time < from || (to != 0 && trade.close_time > to)) continue;
+		bool match = count <= 0;
+		for(int j = 0; j < count && !match; j++)
+			match = logins[j] == trade.login;
+		if(match)
+			found.push_back(trade);
+	}
+	sync.Unlock();
+
+	if(found.empty()) return NULL;
+	TradeRecord *trades = (TradeRecord*)HEAP_ALLOC(sizeof(TradeRecord) * found.size());
+	if(trades == NULL) return NULL;
+	memcpy(trades, &found[0], sizeof(TradeRecord) * found.size());
+	*total = (int)found.size();
+	return trades;
+}
+
+int CEmulatorStore::OrdersTotal()
+{
+	sync.Lock();
+	int total = (int)open.size();
+	sync.Unlock();
+	return total;
+}
+
+int CEmulatorStore::CalcProfit(TradeRecord *trade)
+{
+	if(trade == NULL) return RET_ERROR;
+
+	int res = RET_ERROR;
+	sync.Lock();
+	auto it = symbolIndex.find(trade->symbol);
+	if(it != symbolIndex.end())
+	{
+		const Quote &quote = quotes[it->second];
+		trade->close_price = trade->cmd == OP_BUY ? quote.bid : quote.ask;
+		trade->profit = profit(*trade, symbols[it->second], quote);
+		res = RET_OK;
+	}
+	sync.Unlock();
+	return res;
+}
+
+int CEmulatorStore::MarginInfo(const int login, double *margin, double *freemargin, double *equity)
+{
+	*margin = *freemargin = *equity = 0.0;
+
+	int res = RET_ERROR;
+	sync.Lock();
+	auto acc = users.find(login);
+	if(acc != users.end())
+	{
+		double floating = 0.0, used = 0.0;
+		int leverage = acc->second.leverage > 0 ? acc->second.leverage : 1;
+		auto it = openByLogin.find(login);
+		if(it != openByLogin.end())
+		{
+			for(size_t i = 0; i < it->second.size(); i++)
+			{
+				const TradeRecord &trade = open[it->second[i]];
+				auto sym = symbolIndex.find(trade.symbol);
+				if(sym == symbolIndex.end()) continue;
+				floating += profit(trade, symbols[sym->second], quotes[sym->second]) + trade.commission + trade.storage;
+				used += this->margin(trade, symbols[sym->second], leverage);
+			}
+		}
+		*equity = acc->second.balance + acc->second.credit + floating;
+		*margin = used;
+		*freemargin = *equity - used;
+		res = RET_OK;
+	}
+	sync.Unlock();
+	return res;
+}
+
+double CEmulatorStore::MarginCheck(const int login, const TradeTransInfo *trans, double *freemargin, double *prevmargin)
+{
+	double margin = 0.0, equity = 0.0;
+	*freemargin = *prevmargin = 0.0;
+	if(trans == NULL || MarginInfo(login, &margin, freemargin, &equity) != RET_OK)
+		return 0.0;
+	*prevmargin = margin;
+
+	sync.Lock();
+	auto acc = users.find(login);
+	auto sym = symbolIndex.find(trans->symbol);
+	if(acc != users.end() && sym != symbolIndex.end())
+	{
+		//--- positions are not hedged, the new order adds its full margin
+		TradeRecord trade = {0};
+		trade.volume = trans->volume;
+		margin += this->margin(trade, symbols[sym->second], acc->second.leverage > 0 ? acc->second.leverage : 1);
+	}
+	sync.Unlock();
+	*freemargin = equity - margin;
+	return margin;
+}
+
+double CEmulatorStore::profit(const TradeRecord &trade, const ConSymbol &symbol, const Quote &quote)
+{
+	double lots = trade.volume * 0.01;
+	double diff = trade.cmd == OP_BUY ? quote.bid - trade.open_price : trade.open_price - quote.ask;
+	//--- profit is in the quote currency
+	return toUsd(std::string(symbol.symbol + 3, 3), diff * symbol.contract_size * lots);
+}
+
+double CEmulatorStore::margin(const TradeRecord &trade, const ConSymbol &symbol, int leverage)
+{
+	double lots = trade.volume * 0.01;
+	//--- margin is in the base currency
+	return toUsd(std::string(symbol.symbol, 3), lots * symbol.contract_size / leverage);
+}
+
+double CEmulatorStore::toUsd(const std::string &currency, double value)
+{
+	//--- deposits of the synthetic dataset are in USD
+	if(currency == "USD")
+		return value;
+	auto it = symbolIndex.find(currency + "USD");
+	if(it != symbolIndex.end() && quotes[it->second].bid > 0.0)
+		return value * quotes[it->second].bid;
+	it = symbolIndex.find("USD" + currency);
+	if(it != symbolIndex.end() && quotes[it->second].ask > 0.0)
+		return value / quotes[it->second].ask;
+	return value;
+}
+
+int CEmulatorStore::addOpen(TradeRecord &trade)
+{
+	if(trade.order <= 0 || open.find(trade.order) != open.end())
+		trade.order = nextTicket;
+	if(trade.order >= nextTicket)
+		nextTicket = trade.order + 1;
+	open[trade.order] = trade;
+	openByLogin[trade.login].push_back(trade.order);
+	return trade.order;
+}
+
+void CEmulatorStore::removeOpen(int ticket, int login)
+{
+	open.erase(ticket);
+	auto it = openByLogin.find(login);
+	if(it == openByLogin.end()) return;
+	std::vector<int> &tickets = it->second;
+	for(size_t i = 0; i < tickets.size(); i++)
+	{
+		if(tickets[i] == ticket)
+		{
+			tickets[i] = tickets.back();
+			tickets.pop_back();
+			break;
+		}
+	}
+}
+
+void CEmulatorStore::fillUserInfo(const UserRecord &record, UserInfo *user)
+{
+	ZeroMemory(user, sizeof(UserInfo));
+	user->login = record.login;
+	user->enable = record.enable;
+	user->enable_read_only = record.enable_read_only;
+	user->leverage = record.leverage;
+	user->agent_account = record.agent_account;
+	user->balance = record.balance;
+	user->credit = record.credit;
+	user->prevbalance = record.prevbalance;
+	COPY_STR(user->group, record.group);
+	auto it = groupIndex.find(record.group);
+	if(it != groupIndex.end())
+		user->grp = groups[it->second];
+}
+
+void CEmulatorStore::fireAdd(const TradeRecord &trade, const UserInfo *user)
+{
+	UserInfo info;
+	sync.Lock();
+	TradeHook hook = onAdd;
+	if(hook && user == NULL)
+	{
+		auto it = users.find(trade.login);
+		if(it != users.end())
+		{
+			fillUserInfo(it->second, &info);
+			user = &info;
+		}
+	}
+	sync.Unlock();
+	if(hook)
+		hook(user, &trade, OPEN_NEW);
+}
+
+void CEmulatorStore::fireUpdate(const TradeRecord &trade, const UserInfo *user, int mode)
+{
+	UserInfo info;
+	sync.Lock();
+	TradeHook hook = onUpdate;
+	if(hook && user == NULL)
+	{
+		auto it = users.find(trade.login);
+		if(it != users.end())
+		{
+			fillUserInfo(it->second, &info);
+			user = &info;
+		}
+	}
+	sync.Unlock();
+	if(hook)
+		hook(user, &trade, mode);
+}
+
+unsigned int CEmulatorStore::random()
+{
+	//--- xorshift, reproducible for the same seed
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	return seed;
+}
@@ -0,0 +1,106 @@
+#pragma once
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "common/Sync.h"
+
+/// Size of the synthetic dataset
+struct EmulatorDataset
+{
+	int          accounts;
+	int          orders;
+	int          groups;
+	unsigned int seed;
+
+	EmulatorDataset() : accounts(1000), orders(10000), groups(4), seed(1) {}
+};
+
+/// In-memory server state behind MT4ServerEmulator when it runs without a real server.
+/// Every table is indexed: users by login, groups and symbols by name, trades by ticket and login.
+class CEmulatorStore
+{
+public:
+	typedef std::function<void(const UserInfo*, const TradeRecord*, int)> TradeHook;
+
+	CEmulatorStore();
+	~CEmulatorStore();
+
+	/// Drop everything
+	void Clear();
+	/// Fill with synthetic groups, symbols, prices, accounts and open orders
+	void Generate(const EmulatorDataset &dataset);
+	/// Move every price by a random step
+	void Tick();
+
+	/// Trade hooks, called like MtSrvTradesAddExt/MtSrvTradesUpdate of a plugin
+	void SubscribeTrades(TradeHook onAdd, TradeHook onUpdate);
+
+	//--- groups
+	int  GroupsAdd(const ConGroup *group);
+	int  GroupsGet(LPCSTR name, ConGroup *group);
+	int  GroupsNext(const int pos, ConGroup *group);
+	//--- symbols
+	int  SymbolsAdd(const ConSymbol *symbol);
+	int  SymbolsGet(LPCSTR name, ConSymbol *symbol);
+	int  SymbolsNext(const int pos, ConSymbol *symbol);
+	//--- prices
+	void PricesSet(LPCSTR symbol, const double bid, const double ask);
+	int  PricesGet(LPCSTR symbol, double *prices);
+	double CalcRates(LPCSTR from, LPCSTR to);
+	//--- users
+	int  UsersAdd(const UserRecord *user);
+	int  UsersGet(const int login, UserRecord *user);
+	int  UsersTotal();
+	//--- trades, arrays are allocated with HEAP_ALLOC
+	int  OrdersAdd(const TradeRecord *trade, const UserInfo *user);
+	int  OrdersUpdate(const TradeRecord *trade, const UserInfo *user, const int mode);
+	int  OrdersOpen(const TradeTransInfo *trans, const UserInfo *user);
+	int  OrdersClose(const TradeTransInfo *trans, const UserInfo *user);
+	int  OrdersGet(const int ticket, TradeRecord *trade);
+	TradeRecord* OrdersGetOpen(const int login, int *total);
+	TradeRecord* OrdersGet(const time_t from, const time_t to, const int *logins, const int count, int *total);
+	TradeRecord* OrdersGetClosed(const time_t from, const time_t to, const int *logins, const int count, int *total);
+	int  OrdersTotal();
+	//--- calculations
+	int  CalcProfit(TradeRecord *trade);
+	int  MarginInfo(const int login, double *margin, double *freemargin, double *equity);
+	/// Margin of the account with the order added, like TradesMarginCheck
+	double MarginCheck(const int login, const TradeTransInfo *trans, double *freemargin, double *prevmargin);
+
+private:
+	struct Quote
+	{
+		double bid;
+		double ask;
+		time_t time;
+	};
+
+	void   fillUserInfo(const UserRecord &record, UserInfo *user);
+	double profit(const TradeRecord &trade, const ConSymbol &symbol, const Quote &quote);
+	double margin(const TradeRecord &trade, const ConSymbol &symbol, int leverage);
+	double toUsd(const std::string &currency, double value);
+	int    addOpen(TradeRecord &trade);
+	void   removeOpen(int ticket, int login);
+	void   fireAdd(const TradeRecord &trade, const UserInfo *user);
+	void   fireUpdate(const TradeRecord &trade, const UserInfo *user, int mode);
+	unsigned int random();
+
+	CSync sync;
+	std::vector<ConGroup>                   groups;
+	std::unordered_map<std::string, int>    groupIndex;
+	std::vector<ConSymbol>                  symbols;
+	std::vector<Quote>                      quotes;
+	std::unordered_map<std::string, int>    symbolIndex;
+	std::unordered_map<int, UserRecord>     users;
+	std::unordered_map<int, TradeRecord>    open;
+	std::unordered_map<int, std::vector<int> > openByLogin;
+	std::vector<TradeRecord>                closed;
+	std::unordered_map<int, size_t>         closedIndex;
+	int          nextTicket;
+	unsigned int seed;
+	TradeHook    onAdd;
+	TradeHook    onUpdate;
+};
+
+extern CEmulatorStore ExtEmulatorStore;
@@ -0,0 +1,81 @@
+#include "StdAfx.h"
+#include "EquityCache.h"
+
+#define EQUITY_CACHE_PRUNE_SIZE 4096
+
+CEquityCache::CEquityCache() :
+	window(0), lastPrune(0)
+{
+}
+
+void CEquityCache::SetWindow(int window)
+{
+	this->window = window < 0 ? 0 : window;
+	if(this->window == 0)
+		Clear();
+}
+
+int CEquityCache::GetWindow()
+{
+	return window;
+}
+
+bool CEquityCache::Get(int login, EquitySnapshot &snapshot)
+{
+	DWORD limit = window;
+	if(limit == 0)
+		return false;
+
+	bool found = false;
+	sync.Lock();
+	auto it = snapshots.find(login);
+	if(it != snapshots.end() && PlatformTickCount() - it->second.computed < limit)
+	{
+		snapshot = it->second;
+		found = true;
+	}
+	sync.Unlock();
+	return found;
+}
+
+void CEquityCache::Put(int login, const EquitySnapshot &snapshot)
+{
+	if(window == 0)
+		return;
+
+	DWORD now = PlatformTickCount();
+	sync.Lock();
+	EquitySnapshot &entry = snapshots[login];
+	entry = snapshot;
+	entry.computed = now;
+	if(snapshots.size() > EQUITY_CACHE_PRUNE_SIZE && now - lastPrune > (DWORD)window)
+		Prune(now);
+	sync.Unlock();
+}
+
+void CEquityCache::Invalidate(int login)
+{
+	sync.Lock();
+	snapshots.erase(login);
+	sync.Unlock();
+}
+
+void CEquityCache::Clear()
+{
+	sync.Lock();
+	snapshots.clear();
+	sync.Unlock();
+}
+
+void CEquityCache::Prune(DWORD now)
+{
+	DWORD limit = window;
+	for(auto it = snapshots.begin(); it != snapshots.end();)
+	{
+		if(now - it->second.computed >= limit)
+			it = snapshots.erase(it);
+		else
+			++it;
+	}
+	lastPrune = now;
+}
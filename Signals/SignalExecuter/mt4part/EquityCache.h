@@ -0,0 +1,41 @@
+#pragma once
+#include <unordered_map>
+#include "common/Sync.h"
+
+/// Account state returned by TradesMarginInfo
+struct EquitySnapshot
+{
+	double equity;
+	double margin;
+	double free_margin;
+	DWORD  computed;
+};
+
+/// Per-login equity/margin snapshots, shared by all signals of one burst window.
+/// A stop-out or basket close produces hundreds of trades of one account within milliseconds,
+/// its equity does not change by closing at market, so it is computed once per window.
+class CEquityCache
+{
+public:
+	CEquityCache();
+
+	/// Burst window in milliseconds, 0 disables coalescing
+	void SetWindow(int window);
+	int  GetWindow();
+
+	/// Get snapshot computed less than window ago
+	bool Get(int login, EquitySnapshot &snapshot);
+	/// Store freshly computed snapshot
+	void Put(int login, const EquitySnapshot &snapshot);
+	/// Drop snapshot (e.g. after balance operation)
+	void Invalidate(int login);
+	void Clear();
+
+private:
+	void Prune(DWORD now);
+
+	CSync sync;
+	std::unordered_map<int, EquitySnapshot> snapshots;
+	volatile int window;
+	DWORD lastPrune;
+};
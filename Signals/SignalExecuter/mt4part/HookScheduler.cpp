@@ -0,0 +1,217 @@
+#include "StdAfx.h"
+#include "HookScheduler.h"
+#include "MT4ServerEmulator.h"
+#include <math.h>
+#include <iostream>
+
+//--- the last stretch before a deadline is spent yielding instead of sleeping, sleeps are only ~1 ms precise
+#define HOOK_SCHEDULER_SPIN_US 2000
+#define HOOK_SCHEDULER_STOP_WAIT 2000
+#define HOOK_SCHEDULER_WORKERS 4
+
+CHookScheduler ExtHookScheduler;
+
+CHookScheduler::CHookScheduler() :
+	sequence(0), running(false), workers(HOOK_SCHEDULER_WORKERS), period(1000), random(1), fired(0), latenessTotal(0), latenessMax(0)
+{
+}
+
+CHookScheduler::~CHookScheduler()
+{
+	Stop();
+}
+
+void CHookScheduler::SetWorkers(int workers)
+{
+	this->workers = workers < 1 ? 1 : workers;
+}
+
+void CHookScheduler::Start()
+{
+	if(running)
+		return;
+
+	PlatformHighResolutionTimer(true);
+	running = true;
+	for(int i = 0; i < workers; i++)
+	{
+		PlatformThread *thread = new PlatformThread();
+		if(thread->Start(WorkerThread, this))
+			threads.push_back(thread);
+		else
+			delete thread;
+	}
+}
+
+void CHookScheduler::Stop()
+{
+	if(!running)
+		return;
+
+	running = false;
+	for(size_t i = 0; i < threads.size(); i++)
+	{
+		//--- the event is auto-reset, keep setting it until this worker is the one that woke up
+		DWORD waited = 0;
+		do
+		{
+			wakeup.Set();
+		} while(!threads[i]->Join(10) && (waited += 10) < HOOK_SCHEDULER_STOP_WAIT);
+		delete threads[i];
+	}
+	threads.clear();
+	PlatformHighResolutionTimer(false);
+
+	sync.Lock();
+	while(!timers.empty())
+	{
+		delete timers.top().hook;
+		timers.pop();
+	}
+	sync.Unlock();
+}
+
+void CHookScheduler::Schedule(Hook *hook)
+{
+	int delay = hook->delay == 0 ? period : hook->delay;
+	Push(hook, PlatformMicroseconds() + (unsigned long long)delay * 1000);
+}
+
+void CHookScheduler::SetPeriod(int period)
+{
+	this->period = period < 1 ? 1 : period;
+}
+
+void CHookScheduler::SetLatency(const HookLatency &latency)
+{
+	latencySync.Lock();
+	this->latency = latency;
+	latencySync.Unlock();
+}
+
+int CHookScheduler::SampleDelay()
+{
+	double delay;
+	latencySync.Lock();
+	switch(latency.type)
+	{
+		case HookLatencyUniform:
+			delay = std::uniform_real_distribution<double>(latency.mean - latency.spread, latency.mean + latency.spread)(random);
+			break;
+		case HookLatencyLognormal:
+			delay = std::lognormal_distribution<double>(log((double)(latency.mean > 0 ? latency.mean : 1)), latency.spread / 1000.0)(random);
+			break;
+		default:
+			delay = latency.mean;
+			break;
+	}
+	latencySync.Unlock();
+	//--- zero delay would make a periodic hook
+	return delay < 1 ? 1 : (int)delay;
+}
+
+unsigned long long CHookScheduler::Fired()
+{
+	return fired.load();
+}
+
+double CHookScheduler::AverageLateness()
+{
+	unsigned long long count = fired.load();
+	return count > 0 ? (double)latenessTotal.load() / count : 0;
+}
+
+unsigned long long CHookScheduler::MaxLateness()
+{
+	return latenessMax.load();
+}
+
+void CHookScheduler::ResetStats()
+{
+	fired.store(0);
+	latenessTotal.store(0);
+	latenessMax.store(0);
+}
+
+DWORD WINAPI CHookScheduler::WorkerThread(LPVOID param)
+{
+	((CHookScheduler*)param)->Work();
+	return 0;
+}
+
+void CHookScheduler::Push(Hook *hook, unsigned long long deadline)
+{
+	sync.Lock();
+	Timer timer = { deadline, sequence++, hook };
+	timers.push(timer);
+	//--- only a new earliest deadline changes what the workers wait for
+	bool earliest = timers.top().hook == hook;
+	sync.Unlock();
+	if(earliest)
+		wakeup.Set();
+}
+
+void CHookScheduler::Work()
+{
+	while(running)
+	{
+		Hook *hook = NULL;
+		unsigned long long deadline = 0;
+		DWORD wait = INFINITE;
+
+		sync.Lock();
+		if(!timers.empty())
+		{
+			unsigned long long now = PlatformMicroseconds();
+			if(timers.top().deadline <= now)
+			{
+				hook = timers.top().hook;
+				deadline = timers.top().deadline;
+				timers.pop();
+				//--- more timers are due, hand them to another worker
+				if(!timers.empty() && timers.top().deadline <= now)
+					wakeup.Set();
+			}
+			else
+			{
+				unsigned long long left = timers.top().deadline - now;
+				wait = left > HOOK_SCHEDULER_SPIN_US ? (DWORD)((left - HOOK_SCHEDULER_SPIN_US) / 1000) : 0;
+			}
+		}
+		sync.Unlock();
+
+		if(hook == NULL)
+		{
+			if(wait == 0)
+				PlatformYield();
+			else
+				wakeup.Wait(wait);
+			continue;
+		}
+
+		unsigned long long lateness = PlatformMicroseconds() - deadline;
+		unsigned long long worst = latenessMax.load();
+		while(lateness > worst && !latenessMax.compare_exchange_weak(worst, lateness));
+		latenessTotal.fetch_add(lateness);
+		fired.fetch_add(1);
+
+		try
+		{
+			hook->Run();
+		}
+		catch(std::exception &ex)
+		{
+			std::cout << "Exception in emulator hook: " << ex.what() << std::endl;
+		}
+
+		if(hook->delay == 0)
+		{
+			//--- keep the period steady, but do not replay missed runs after a stall
+			unsigned long long next = deadline + (unsigned long long)period * 1000;
+			unsigned long long now = PlatformMicroseconds();
+			Push(hook, next > now ? next : now);
+		}
+		else
+			delete hook;
+	}
+}
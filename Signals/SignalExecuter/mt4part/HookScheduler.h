@@ -0,0 +1,93 @@
+#pragma once
+#include <atomic>
+#include <functional>
+#include <queue>
+#include <random>
+#include <vector>
+#include "common/Sync.h"
+
+struct Hook;
+
+/// Delay distribution of emulated dealer confirms
+enum HookLatencyType { HookLatencyFixed = 0, HookLatencyUniform, HookLatencyLognormal };
+
+/// Latency model, values in milliseconds.
+/// Fixed: always mean. Uniform: mean +/- spread. Lognormal: median mean, spread is sigma of ln(delay) in 1/1000
+struct HookLatency
+{
+	int type;
+	int mean;
+	int spread;
+
+	HookLatency() : type(HookLatencyFixed), mean(1000), spread(0) {}
+};
+
+/// Timer queue for emulator hooks: a min-heap ordered by deadline served by a pool of workers.
+/// Every hook fires at its own deadline, a slow hook delays only the worker running it.
+class CHookScheduler
+{
+public:
+	CHookScheduler();
+	~CHookScheduler();
+
+	/// Count of workers, applied on the next Start
+	void SetWorkers(int workers);
+	/// Start workers, does nothing when already started
+	void Start();
+	/// Stop workers, pending hooks are deleted without running
+	void Stop();
+
+	/// Schedule hook after its delay, the scheduler owns it from now on.
+	/// Hook with zero delay is periodic and runs every period
+	void Schedule(Hook *hook);
+
+	/// Period of hooks with zero delay, milliseconds
+	void SetPeriod(int period);
+	/// Delay model of new confirms
+	void SetLatency(const HookLatency &latency);
+	/// Next delay of the latency model, milliseconds
+	int  SampleDelay();
+
+	/// Count of run hooks
+	unsigned long long Fired();
+	/// Average and worst lateness of runs against deadlines, microseconds
+	double AverageLateness();
+	unsigned long long MaxLateness();
+	void ResetStats();
+
+private:
+	struct Timer
+	{
+		unsigned long long deadline;
+		unsigned long long sequence;
+		Hook *hook;
+
+		bool operator>(const Timer &other) const
+		{
+			return deadline != other.deadline ? deadline > other.deadline : sequence > other.sequence;
+		}
+	};
+
+	static DWORD WINAPI WorkerThread(LPVOID param);
+	void Work();
+	void Push(Hook *hook, unsigned long long deadline);
+
+	CSync sync;
+	std::priority_queue<Timer, std::vector<Timer>, std::greater<Timer> > timers;
+	unsigned long long sequence;
+	PlatformEvent wakeup;
+	std::vector<PlatformThread*> threads;
+	volatile bool running;
+	int workers;
+	volatile int period;
+
+	CSync latencySync;
+	HookLatency latency;
+	std::mt19937 random;
+
+	std::atomic<unsigned long long> fired;
+	std::atomic<unsigned long long> latenessTotal;
+	std::atomic<unsigned long long> latenessMax;
+};
+
+extern CHookScheduler ExtHookScheduler;
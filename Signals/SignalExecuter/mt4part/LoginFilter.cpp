@@ -0,0 +1,121 @@
+#include "StdAfx.h"
+#include "LoginFilter.h"
+#include <algorithm>
+
+/// Largest login range kept as a bitmap (2 MB)
+#define LOGIN_BITMAP_RANGE (1 << 24)
+
+LoginSet::LoginSet(const std::vector<int> &logins) :
+	base(0), range(0), mask(0)
+{
+	if(logins.empty())
+		return;
+
+	int min = logins[0], max = logins[0];
+	for(size_t i = 1; i < logins.size(); i++)
+	{
+		if(logins[i] < min) min = logins[i];
+		if(logins[i] > max) max = logins[i];
+	}
+
+	if((unsigned int)max - (unsigned int)min < LOGIN_BITMAP_RANGE)
+	{
+		base = min;
+		range = (unsigned int)max - (unsigned int)min + 1;
+		bits.assign((range + 31) / 32, 0);
+		for(size_t i = 0; i < logins.size(); i++)
+		{
+			unsigned int bit = (unsigned int)logins[i] - (unsigned int)base;
+			bits[bit >> 5] |= 1u << (bit & 31);
+		}
+		return;
+	}
+
+	//--- sparse logins, table at most half full; login 0 never exists and marks an empty slot
+	unsigned int size = 16;
+	while(size < logins.size() * 2)
+		size <<= 1;
+	table.assign(size, 0);
+	mask = size - 1;
+	for(size_t i = 0; i < logins.size(); i++)
+	{
+		unsigned int slot = ((unsigned int)logins[i] * 2654435761u) & mask;
+		while(table[slot] != 0 && table[slot] != logins[i])
+			slot = (slot + 1) & mask;
+		table[slot] = logins[i];
+	}
+}
+
+bool LoginSet::Contains(int login) const
+{
+	if(range != 0)
+	{
+		unsigned int bit = (unsigned int)login - (unsigned int)base;
+		return bit < range && (bits[bit >> 5] & (1u << (bit & 31))) != 0;
+	}
+
+	if(table.empty() || login == 0)
+		return false;
+
+	unsigned int slot = ((unsigned int)login * 2654435761u) & mask;
+	while(table[slot] != 0)
+	{
+		if(table[slot] == login)
+			return true;
+		slot = (slot + 1) & mask;
+	}
+	return false;
+}
+
+CLoginFilter::CLoginFilter() :
+	current(NULL)
+{
+}
+
+CLoginFilter::~CLoginFilter()
+{
+	delete current.load();
+	for(size_t i = 0; i < retired.size(); i++)
+		delete retired[i];
+	retired.clear();
+}
+
+void CLoginFilter::Update(const std::vector<int> &logins)
+{
+	std::vector<int> sorted(logins);
+	std::sort(sorted.begin(), sorted.end());
+	sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+
+	sync.Lock();
+	//--- the router pushes the set again and again, only a changed one is built
+	if(current.load(std::memory_order_relaxed) == NULL || sorted != this->logins)
+	{
+		swap(new LoginSet(sorted));
+		this->logins.swap(sorted);
+	}
+	sync.Unlock();
+}
+
+void CLoginFilter::Reset()
+{
+	sync.Lock();
+	if(current.load(std::memory_order_relaxed) != NULL)
+	{
+		swap(NULL);
+		logins.clear();
+	}
+	sync.Unlock();
+}
+
+bool CLoginFilter::IsWatched(int login) const
+{
+	LoginSet *set = current.load(std::memory_order_acquire);
+	return set == NULL || set->Contains(login);
+}
+
+void CLoginFilter::swap(LoginSet *set)
+{
+	LoginSet *previous = current.exchange(set, std::memory_order_acq_rel);
+	if(previous != NULL)
+		retired.push_back(previous);
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include <atomic>
+#include <vector>
+#include "common/Sync.h"
+
+/// Immutable set of logins.
+/// Dense logins are kept as a bitmap over [min, max], sparse ones in an open addressing table.
+class LoginSet
+{
+public:
+	LoginSet(const std::vector<int> &logins);
+
+	bool Contains(int login) const;
+
+private:
+	int          base;
+	unsigned int range;
+	std::vector<unsigned int> bits;
+	std::vector<int> table;
+	unsigned int mask;
+};
+
+/// Provider and subscriber accounts watched by the router.
+/// Until the first update every login is watched, so an old router keeps receiving all trades.
+class CLoginFilter
+{
+public:
+	CLoginFilter();
+	~CLoginFilter();
+
+	/// Replace the whole set, called on the module thread. The same set pushed again changes nothing
+	void Update(const std::vector<int> &logins);
+	/// Watch every login again
+	void Reset();
+	/// Lock free lookup, called on the MT4 trade thread
+	bool IsWatched(int login) const;
+
+private:
+	/// Publish the set, called under the lock
+	void swap(LoginSet *set);
+
+	std::atomic<LoginSet*> current;
+	/// Replaced sets live until shutdown: a trade thread may still be inside a lookup of any of them.
+	/// The set changes only when accounts come or go, the list stays short
+	std::vector<LoginSet*> retired;
+	/// Sorted logins of the current set, empty when every login is watched
+	std::vector<int> logins;
+	CSync sync;
+};
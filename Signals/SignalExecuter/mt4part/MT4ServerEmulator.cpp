@@ -1,5 +1,7 @@
 #include "StdAfx.h"
 #include "MT4ServerEmulator.h"
+#include "EmulatorStore.h"
+#include "HookScheduler.h"
 
 
 MT4ServerEmulator::MT4ServerEmulator(CServerInterface *mt4)
@@ -7,46 +9,27 @@ MT4ServerEmulator::MT4ServerEmulator(CServerInterface *mt4)
 	this->mt4 = mt4;
 	if(mt4 == NULL)
 	{
-		Start(); //Start emulation
+		ExtHookScheduler.Start(); //Start emulation
 	}
 }
 
 
 MT4ServerEmulator::~MT4ServerEmulator(void)
 {
-	if(mt4 != NULL)
+	if(mt4 == NULL)
 	{
-		Stop();
+		ExtHookScheduler.Stop();
 	}
 }
 
 void MT4ServerEmulator::InitiateHook(Hook* hook)
 {
-	hookSync.Lock();
-	hooks.push_back(hook);
-	hookSync.Unlock();
+	ExtHookScheduler.Schedule(hook);
 }
 
 int MT4ServerEmulator::ThreadFunction()
 {
-	Hook *hook = NULL;
-	hookSync.Lock();
-	if(hooks.size() > 0)
-	{
-		hook = *(hooks.begin());
-		hooks.pop_front();
-		if(hook->delay == 0)
-		{
-			hooks.push_back(hook);
-		}
-	}
-	hookSync.Unlock();
-
-	if(hook != NULL)
-	{
-		Sleep(1000);
-		hook->Run();
-	}
+	//--- hooks are run by ExtHookScheduler workers
 	return 0;
 }
 
@@ -298,7 +281,7 @@ int  __stdcall MT4ServerEmulator::GroupsNext(const int pos,ConGroup *group)
 {
 	if(mt4 == NULL)
 	{
-		return FALSE;
+		return ExtEmulatorStore.GroupsNext(pos, group);
 	}
 	else
 	{
@@ -310,12 +293,7 @@ int  __stdcall MT4ServerEmulator::GroupsGet(LPCSTR name,ConGroup *group)
 {
 	if(mt4 == NULL)
 	{
-		COPY_STR(group->group, "real-1");
-		group->enable = 1;
-		group->secgroups[1].comm_agent = 20.0;
-		group->secmargins[1].margin_divider = 15.23;
-		group->reserved[25] = 1232;
-		return TRUE;
+		return ExtEmulatorStore.GroupsGet(name, group);
 	}
 	else
 	{
@@ -551,75 +529,24 @@ int  __stdcall MT4ServerEmulator::SymbolsNext(const int pos, ConSymbol *sec)
 {
 	if(mt4 == NULL)
 	{
-		if(pos == 0)
-		{
-			ConSymbol symbol = {0};
-			COPY_STR(symbol.symbol, "EURUSD");
-			symbol.digits = 6;
-			
-			symbol.sessions[0].quote[0].open_hour = 12;
-			symbol.sessions[0].quote[0].align[6] = 22;
-
-			symbol.sessions[0].quote[1].open_hour = 32;
-			symbol.sessions[0].quote[1].align[6] = 42;
-			
-			symbol.spread = 4;
-			symbol.long_only = 123;
-			symbol.swap_openprice = 5423;
-			symbol.expiration = 5436;
-			symbol.count_original = 4343;
-			symbol.realtime = 5454;
-			symbol.profit_mode = 323314;
-			symbol.spread = 1234556;
-			symbol.margin_initial = 13423;
-			symbol.expiration = 5436;
-			symbol.profit_mode = 12;
-			symbol.filter_smoothing = 12;
-			symbol.logging = 543;
-			symbol.contract_size = 543.12;
-			symbol.exemode = 123;
-			symbol.swap_rollover3days = 124;
-			symbol.swap_type = 547;
-			symbol.swap_long = 232.4;
-			symbol.value_date = 1232;
-			symbol.unused[21] = 5554;
-			*sec = symbol; 
-			return TRUE;
-		}
-		
-		if(pos == 1)
-		{
-			ConSymbol symbol = {0};
-			COPY_STR(symbol.symbol, "GBPUSD");
-			symbol.digits = 4;
-			symbol.sessions[1].trade[1].open = 224;
-			symbol.sessions[1].quote[1].open = 22;
-			*sec = symbol; 
-			return TRUE;
-		}
-		return FALSE;
+		return ExtEmulatorStore.SymbolsNext(pos, sec);
 	}
 	else
 	{
 		return mt4->SymbolsNext(pos, sec);
 	}
-
 }
 
 int  __stdcall MT4ServerEmulator::SymbolsGet(LPCSTR symbol,ConSymbol *security)
 {
 	if(mt4 == NULL)
 	{
-		ConSymbol c;
-		strcpy(c.symbol, symbol);
-		*security = c;
-		return FALSE;
+		return ExtEmulatorStore.SymbolsGet(symbol, security);
 	}
 	else
 	{
 		return mt4->SymbolsGet(symbol, security);
 	}
-
 }
 /*
 int  __stdcall MT4ServerEmulator::SymbolsShift(const int pos,const int shift)
@@ -712,20 +639,12 @@ int  __stdcall MT4ServerEmulator::ClientsUserInfo(const int login, UserRecord *i
 {
 	if(mt4 == NULL)
 	{
-		COPY_STR(inf->address, "test");
-		COPY_STR(inf->group, "demoforex");
-		COPY_STR(inf->publickey, "demoforex");
-		COPY_STR(inf->api_data, "api_data");
-		inf->login = 1006;
-		inf->regdate = 516;
-		inf->enable_reserved[1] = 123;
-		return TRUE;
+		return ExtEmulatorStore.UsersGet(login, inf);
 	}
 	else
 	{
 		return mt4->ClientsUserInfo(login, inf);
 	}
-
 }
 /*
 int  __stdcall MT4ServerEmulator::ClientsUserUpdate(const UserRecord *inf)
@@ -813,7 +732,7 @@ int  __stdcall MT4ServerEmulator::RequestsAdd(RequestInfo *request,const int isd
 	{
 		//printf("Emulator: Request added\n");
 		*request_id = id;
-		InitiateHook(new DealerConfirmHook(id, 1000) );
+		InitiateHook(new DealerConfirmHook(id, ExtHookScheduler.SampleDelay()) );
 		id++;
 		return RET_TRADE_ACCEPTED;
 	}
@@ -907,7 +826,7 @@ int  __stdcall MT4ServerEmulator::OrdersAdd(const TradeRecord *start,UserInfo* u
 {
 	if(mt4 == NULL)
 	{
-		return 1001;
+		return ExtEmulatorStore.OrdersAdd(start, user);
 	}
 	else
 	{
@@ -919,7 +838,7 @@ int  __stdcall MT4ServerEmulator::OrdersUpdate(TradeRecord *order,UserInfo* user
 {
 	if(mt4 == NULL)
 	{
-		return RET_OK;
+		return ExtEmulatorStore.OrdersUpdate(order, user, mode);
 	}
 	else
 	{
@@ -932,7 +851,7 @@ int  __stdcall MT4ServerEmulator::OrdersGet(const int ticket,TradeRecord *order)
 {
 	if(mt4 == NULL)
 	{
-		return RET_OK;
+		return ExtEmulatorStore.OrdersGet(ticket, order);
 	}
 	else
 	{
@@ -948,26 +867,26 @@ TradeRecord*__stdcall MT4ServerEmulator::OrdersGet(const time_t from,const time_
 */
 TradeRecord*__stdcall MT4ServerEmulator::OrdersGetOpen(const UserInfo* user,int* total)
 {
-	TradeRecord temp = {0};
-	*total = 2;
-	TradeRecord* trade = (TradeRecord*)HEAP_ALLOC(sizeof(TradeRecord) * 2);
-	trade[0] = temp;
-	trade[0].login = 1006;
-	trade[0].order = 12353;
-	trade[0].reserved[4] = 12345;
-	COPY_STR(trade[0].comment, "test order");
-
-	trade[1] = temp;
-	trade[1].login = 1006;
-	trade[1].order = 32538;
-	trade[1].reserved[4] = 2345;
-	COPY_STR(trade[1].comment, "test order2");
-	return trade;
+	if(mt4 == NULL)
+	{
+		return ExtEmulatorStore.OrdersGetOpen(user->login, total);
+	}
+	else
+	{
+		return mt4->OrdersGetOpen(user, total);
+	}
 }
 
 TradeRecord*__stdcall MT4ServerEmulator::OrdersGetClosed(const time_t from,const time_t to,const int *logins,const int count,int* total)
 {
-	return NULL;
+	if(mt4 == NULL)
+	{
+		return ExtEmulatorStore.OrdersGetClosed(from, to, logins, count, total);
+	}
+	else
+	{
+		return mt4->OrdersGetClosed(from, to, logins, count, total);
+	}
 }
 
 //--- trade info access
@@ -975,23 +894,19 @@ int  __stdcall MT4ServerEmulator::TradesCalcProfit(LPCSTR group,TradeRecord *tpi
 {
 	if(mt4 == NULL)
 	{
-		return RET_OK;
+		return ExtEmulatorStore.CalcProfit(tpi);
 	}
 	else
 	{
 		return mt4->TradesCalcProfit(group, tpi);
 	}
-
 }
 
 int  __stdcall MT4ServerEmulator::TradesMarginInfo(UserInfo *user,double *margin,double *freemargin,double *equity)
 {
 	if(mt4 == NULL)
 	{
-		*margin = 0.0;
-		*freemargin = 0.0;
-		*equity = 0.0;
-		return RET_OK;
+		return ExtEmulatorStore.MarginInfo(user->login, margin, freemargin, equity);
 	}
 	else
 	{
@@ -1022,15 +937,12 @@ int  __stdcall MT4ServerEmulator::HistoryPrices(LPCSTR symbol,double *prices,tim
 {
 	if(mt4 == NULL)
 	{
-		prices[0] = 1.0;
-		prices[1] = 1.1;
-		return RET_OK;
+		return ExtEmulatorStore.PricesGet(symbol, prices);
 	}
 	else
 	{
 		return mt4->HistoryPrices(symbol, prices, ctm, dir);
 	}
-
 }
 
 
@@ -1038,13 +950,12 @@ int  __stdcall MT4ServerEmulator::HistoryPricesGroup(LPCSTR symbol,const ConGrou
 {
 	if(mt4 == NULL)
 	{
-		return RET_OK;
+		return ExtEmulatorStore.PricesGet(symbol, prices);
 	}
 	else
 	{
 		return mt4->HistoryPricesGroup(symbol, grp, prices);
 	}
-
 }
 /*
 int  __stdcall MT4ServerEmulator::HistoryPricesGroup(RequestInfo *request,double *prices)
@@ -1154,8 +1065,8 @@ double       __stdcall MT4ServerEmulator::TradesMarginCheck(const UserInfo *user
 {
 	if(mt4 == NULL)
 	{
-		*freemargin = 1000;
-		return 0.0;
+		*profit = 0.0;
+		return ExtEmulatorStore.MarginCheck(user->login, trade, freemargin, new_margin);
 	}
 	else
 	{
@@ -1170,26 +1081,24 @@ int   __stdcall MT4ServerEmulator::OrdersOpen(const TradeTransInfo *trans,UserIn
 {
 	if(mt4 == NULL)
 	{
-		return RET_OK;
+		return ExtEmulatorStore.OrdersOpen(trans, user);
 	}
 	else
 	{
 		return mt4->OrdersOpen(trans, user);
 	}
-
 }
 
 int   __stdcall MT4ServerEmulator::OrdersClose(const TradeTransInfo *trans,UserInfo *user)
 {
 	if(mt4 == NULL)
 	{
-		return RET_OK;
+		return ExtEmulatorStore.OrdersClose(trans, user);
 	}
 	else
 	{
 		return mt4->OrdersClose(trans, user);
 	}
-
 }
 /*
 int   __stdcall MT4ServerEmulator::OrdersCloseBy(const TradeTransInfo *trans,UserInfo *user)
@@ -0,0 +1,96 @@
+#include "StdAfx.h"
+#include "PluginChain.h"
+#include <set>
+
+/// plugins.ini holds up to this many records after its 4 byte header
+#define PLUGINS_MAX 100
+
+CPluginChain ExtPluginChain;
+
+CPluginChain::CPluginChain() :
+	loaded(false)
+{
+}
+
+CPluginChain::~CPluginChain()
+{
+	Clear();
+}
+
+int CPluginChain::Load(const std::string &root)
+{
+	sync.Lock();
+	if(!loaded.load(std::memory_order_relaxed))
+	{
+		//--- sorted and unique like the set the requests used to build every time
+		std::set<std::string> files;
+		std::string fileName = root;
+		fileName.append("\\config\\plugins.ini");
+		FILE *configFile;
+		if(fopen_s(&configFile, fileName.c_str(), "rb") == 0)
+		{
+			fseek(configFile, 4, SEEK_SET);
+			ConPlugin plugin;
+			for(int i = 0; i < PLUGINS_MAX && fread(&plugin, sizeof(ConPlugin), 1, configFile) == 1; i++)
+			{
+				plugin.file[sizeof(plugin.file) - 1] = 0;
+				if(plugin.enabled == 1 && strstr(plugin.file, ".dll") != NULL && strstr(plugin.file, "gurucollector") == NULL && strstr(plugin.file, "datacollector") == NULL)
+					files.insert(plugin.file);
+			}
+			fclose(configFile);
+		}
+
+		for(std::set<std::string>::iterator file = files.begin(); file != files.end(); file++)
+		{
+			Plugin plugin;
+			plugin.file = *file;
+			plugin.library = new PlatformLibrary();
+			plugin.function = NULL;
+			std::string library = root;
+			library.append("\\plugins\\");
+			library.append(*file);
+			//--- the server has the plugin loaded already, this only takes a reference to it
+			if(plugin.library->Load(library.c_str()))
+				plugin.function = (MtSrvTradeTransactionCall)plugin.library->Symbol("MtSrvTradeTransaction");
+			plugins.push_back(plugin);
+		}
+		loaded.store(true, std::memory_order_release);
+	}
+	int hooks = Hooks();
+	sync.Unlock();
+	return hooks;
+}
+
+int CPluginChain::Hooks() const
+{
+	int hooks = 0;
+	for(size_t i = 0; i < plugins.size(); i++)
+		if(plugins[i].function != NULL)
+			hooks++;
+	return hooks;
+}
+
+int CPluginChain::Call(TradeTransInfo *trans, const UserInfo *user, int *request_id)
+{
+	if(!loaded.load(std::memory_order_acquire))
+		Load(path);
+	for(size_t i = 0; i < plugins.size(); i++)
+	{
+		if(plugins[i].function == NULL)
+			continue;
+		int result = plugins[i].function(trans, user, request_id);
+		if(result != RET_OK)
+			return result;
+	}
+	return RET_OK;
+}
+
+void CPluginChain::Clear()
+{
+	sync.Lock();
+	loaded.store(false, std::memory_order_release);
+	for(size_t i = 0; i < plugins.size(); i++)
+		delete plugins[i].library;
+	plugins.clear();
+	sync.Unlock();
+}
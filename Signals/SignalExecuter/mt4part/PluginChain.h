@@ -0,0 +1,54 @@
+#pragma once
+#include <atomic>
+#include <string>
+#include <vector>
+#include "common/Sync.h"
+#include "MT4ServerEmulator.h"
+
+typedef int (APIENTRY *MtSrvTradeTransactionCall)(TradeTransInfo* trans, const UserInfo *user, int *request_id);
+
+struct ConPlugin
+  {
+   char              file[256];                    // plugin file name
+   PluginInfo        info;                         // plugin description
+   int               enabled;                      // plugin enabled/disabled
+   int               configurable;                 // is plugin configurable
+   int               manager_access;               // plugin can be accessed from manager terminal
+   int               reserved[62];                 // reserved
+  };
+
+/// MtSrvTradeTransaction hooks of the other plugins of the server, every request added by the plugin passes them.
+/// plugins.ini is read and the libraries are loaded once, a request calls the resolved entry points only
+class CPluginChain
+{
+public:
+	CPluginChain();
+	~CPluginChain();
+
+	/// Read config\plugins.ini under the server directory and load the enabled plugins, returns the count of hooks
+	int  Load(const std::string &root);
+	bool IsLoaded() const { return loaded.load(std::memory_order_acquire); }
+	/// Hooks of the plugins in the order of their file names, the first result other than RET_OK stops the chain.
+	/// Loads the chain on the first call unless it was loaded before
+	int  Call(TradeTransInfo *trans, const UserInfo *user, int *request_id);
+	/// Plugins read from plugins.ini and hooks resolved in them
+	int  Plugins() const { return (int)plugins.size(); }
+	int  Hooks() const;
+	/// Free the libraries, the chain is loaded again on the next call
+	void Clear();
+
+private:
+	struct Plugin
+	{
+		std::string               file;
+		PlatformLibrary*          library;
+		MtSrvTradeTransactionCall function;
+	};
+
+	CSync sync;
+	/// Not changed while loaded is set, calls read it without the lock
+	std::vector<Plugin> plugins;
+	std::atomic<bool> loaded;
+};
+
+extern CPluginChain ExtPluginChain;
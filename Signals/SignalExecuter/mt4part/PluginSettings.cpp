@@ -0,0 +1,133 @@
+#include "StdAfx.h"
+#include "PluginSettings.h"
+#ifdef _WIN32
+#include "Configuration.h"
+#endif
+
+CPluginSettings ExtSettings;
+
+CPluginSettings::CPluginSettings() :
+	current(NULL)
+{
+}
+
+CPluginSettings::~CPluginSettings()
+{
+	current.store(NULL);
+	for(size_t i = 0; i < published.size(); i++)
+		delete published[i];
+	published.clear();
+}
+
+#ifdef _WIN32
+PluginSettings CPluginSettings::Parse(CConfiguration &config)
+{
+	PluginSettings settings;
+	char buffer[64];
+	int value;
+
+	config.GetInteger(0, "debugMode", &value, "1");
+	settings.debugMode = value > 0;
+
+	char hosts[256];
+	config.GetString(1, "host", hosts, sizeof(hosts), "127.0.0.1");
+	settings.host = hosts;
+
+	config.GetString(2, "port", buffer, sizeof(buffer), "2222");
+	settings.port = buffer;
+
+	config.GetString(3, "name", buffer, sizeof(buffer), "Server");
+	settings.name = buffer;
+
+	config.GetInteger(0, "autoExecution", &value, "1");
+	settings.autoExecution = value > 0;
+
+	config.GetInteger(0, "equityBurstWindow", &value, "100");
+	settings.equityBurstWindow = value;
+
+	config.GetInteger(0, "dedupeWindow", &value, "600");
+	settings.dedupeWindow = value;
+
+	config.GetInteger(0, "executionReports", &value, "1");
+	settings.executionReports = value > 0;
+
+	config.GetInteger(0, "commissionRefresh", &value, "1000");
+	settings.commissionRefresh = value;
+
+	config.GetInteger(0, "verdictCacheSize", &value, "65536");
+	settings.verdictCacheSize = value;
+
+	config.GetInteger(0, "statusBatchSize", &value, "1000");
+	settings.statusBatchSize = value;
+
+	config.GetInteger(0, "statusCoalesceWindow", &value, "5");
+	settings.statusCoalesceWindow = value;
+
+	config.GetInteger(0, "statusCacheSize", &value, "100000");
+	settings.statusCacheSize = value;
+
+	config.GetInteger(0, "warmUp", &value, "1");
+	settings.warmUp = value > 0;
+
+	char board[64];
+	config.GetString(5, "positionsBoard", board, sizeof(board), "");
+	settings.positionsBoard = board;
+
+	config.GetInteger(0, "positionsBoardLogins", &value, "10000");
+	settings.positionsBoardLogins = value;
+
+	config.GetInteger(0, "positionsBoardPositions", &value, "64");
+	settings.positionsBoardPositions = value;
+
+	config.GetInteger(0, "closeLaneWeight", &value, "8");
+	settings.closeLaneWeight = value;
+
+	config.GetInteger(0, "openLaneWeight", &value, "4");
+	settings.openLaneWeight = value;
+
+	config.GetInteger(0, "statusLaneWeight", &value, "1");
+	settings.statusLaneWeight = value;
+
+	config.GetInteger(0, "routerMode", &value, "0");
+	settings.routerMode = value;
+
+	config.GetInteger(0, "heartbeatInterval", &value, "0");
+	settings.heartbeatInterval = value;
+
+	config.GetInteger(0, "failoverTimeout", &value, "0");
+	settings.failoverTimeout = value;
+
+	char path[256];
+	config.GetString(4, "journalPath", path, sizeof(path), "");
+	settings.journalPath = path;
+
+	config.GetInteger(0, "journalSize", &value, "64");
+	settings.journalSize = value;
+
+	config.GetInteger(0, "journalCommitInterval", &value, "10");
+	settings.journalCommitInterval = value;
+
+	config.GetInteger(0, "journalReplayAge", &value, "60");
+	settings.journalReplayAge = value;
+
+	config.GetInteger(0, "experimentalSharedMemory", &value, "0");
+	settings.experimentalSharedMemory = value > 0;
+
+	return settings;
+}
+#endif
+
+const PluginSettings* CPluginSettings::Publish(const PluginSettings &settings)
+{
+	PluginSettings *snapshot = new PluginSettings(settings);
+	sync.Lock();
+	published.push_back(snapshot);
+	current.store(snapshot, std::memory_order_release);
+	sync.Unlock();
+	return snapshot;
+}
+
+const PluginSettings* CPluginSettings::Current() const
+{
+	return current.load(std::memory_order_acquire);
+}
@@ -0,0 +1,101 @@
+#pragma once
+#include <atomic>
+#include <string>
+#include <vector>
+#include "common/Sync.h"
+
+class CConfiguration;
+
+/// Typed plugin settings, never changed once published
+struct PluginSettings
+{
+	/// Comma separated routers: host[:port], tcp://host:port, ipc://path or shm://name (experimentalSharedMemory only)
+	std::string host;
+	std::string port;
+	std::string name;
+	bool        debugMode;
+	bool        autoExecution;
+	int         equityBurstWindow;
+	/// Seconds an executed order of an execution signal is remembered, 0 disables deduplication
+	int         dedupeWindow;
+	/// Send the outcome and timings of the orders of every execution signal to the router
+	bool        executionReports;
+	/// Milliseconds a commission point value is reused before the rates are asked again, 0 disables the table.
+	/// The table is not told about quotes: commissions are charged on rates up to this old
+	int         commissionRefresh;
+	/// Security, tick size and volume check results held before the cache starts over, 0 disables the cache
+	int         verdictCacheSize;
+	/// Logins of an orders status request fetched with one server call, 0 loads every account on its own
+	int         statusBatchSize;
+	/// Milliseconds status requests wait for others to be answered with one scan, 0 answers each on its own
+	int         statusCoalesceWindow;
+	/// Watched logins whose last orders status is kept until their next trade, 0 disables the cache
+	int         statusCacheSize;
+	/// Load the plugin chain, groups, symbols, rates and messages before the router connection starts
+	bool        warmUp;
+	/// Shared memory name of the open positions board of the watched logins, empty disables it
+	std::string positionsBoard;
+	/// Logins the board holds and positions per login
+	int         positionsBoardLogins;
+	int         positionsBoardPositions;
+	/// Messages handled from the close, open and status lanes per round
+	int         closeLaneWeight;
+	int         openLaneWeight;
+	int         statusLaneWeight;
+	/// RouterMode of several routers, heartbeat interval and silence after which a router is dead, milliseconds.
+	/// Heartbeats are off by default, except with several active/standby routers (50 and 200 ms): failover needs them.
+	/// A zero timeout is twice the interval
+	int         routerMode;
+	int         heartbeatInterval;
+	int         failoverTimeout;
+	/// Router message journal, empty path disables it. Execution requests older than journalReplayAge seconds are not replayed
+	std::string journalPath;
+	int         journalSize;
+	int         journalCommitInterval;
+	int         journalReplayAge;
+	/// Allow shm:// routers. The service router has no shared memory listener yet, the channel is for trials only
+	bool        experimentalSharedMemory;
+
+	/// Router of the host list is a shm:// channel
+	bool HasSharedMemoryRouter() const
+	{
+		return host.find("shm://") != std::string::npos;
+	}
+
+	/// Connection settings differ, the router connection has to be rebuilt
+	bool ConnectionDiffers(const PluginSettings &other) const
+	{
+		return host != other.host || port != other.port || name != other.name ||
+			routerMode != other.routerMode || heartbeatInterval != other.heartbeatInterval || failoverTimeout != other.failoverTimeout ||
+			journalPath != other.journalPath || journalSize != other.journalSize || journalCommitInterval != other.journalCommitInterval ||
+			journalReplayAge != other.journalReplayAge;
+	}
+};
+
+/// Publishes settings snapshots parsed from the plugin configuration.
+/// Readers get the current snapshot with one atomic load: no lock and no string parsing on the hot path.
+/// Everything written before Publish is visible to a reader which loaded the published snapshot.
+class CPluginSettings
+{
+public:
+	CPluginSettings();
+	~CPluginSettings();
+
+#ifdef _WIN32
+	/// Parse configuration, adding defaults for missing keys. The configuration file is Windows only
+	static PluginSettings Parse(CConfiguration &config);
+#endif
+	/// Publish a copy of ready settings
+	const PluginSettings* Publish(const PluginSettings &settings);
+	/// Current snapshot, NULL before the first Publish
+	const PluginSettings* Current() const;
+
+private:
+	std::atomic<const PluginSettings*> current;
+	/// Published snapshots live until shutdown, so a reader never has to pin one.
+	/// Reconfiguration is a manual action, the list stays tiny.
+	std::vector<PluginSettings*> published;
+	CSync sync;
+};
+
+extern CPluginSettings ExtSettings;
@@ -3,9 +3,12 @@
 //|                    Copyright  2009-2010, Tools For Brokers Inc. |
 //|                                     http://www.tools4brokers.com |
 //+------------------------------------------------------------------+
-#include "stdafx.h"
+#include "StdAfx.h"
 #include "Processor.h"
 #include "Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <set>
 
 
 
@@ -20,9 +23,28 @@ std::vector<std::string> split(std::string line, char delim)
 }
 
 
-CProcessor::CProcessor(void)
+/// Open trade as a position of the board
+static void BoardPositionFromTrade(const TradeRecord &trade, BoardPosition &position)
+{
+	memset(&position, 0, sizeof(position));
+	position.order = trade.order;
+	position.cmd = trade.cmd;
+	position.volume = trade.volume;
+	position.openTime = trade.open_time;
+	position.openPrice = trade.open_price;
+	position.sl = trade.sl;
+	position.tp = trade.tp;
+	COPY_STR(position.symbol, trade.symbol);
+	COPY_STR(position.comment, trade.comment);
+}
+
+CProcessor::CProcessor(void) :
+	settings(NULL), connection(NULL), boardLogins(0), boardPositions(0)
 {
 	started = false;
+	memset(&warmUpStats, 0, sizeof(warmUpStats));
+	pipeline.Subscribe(std::function<void(TradeSnapshot&)>(std::bind(&CProcessor::OnTradeSnapshot, this, std::placeholders::_1)));
+	statusWorker.Subscribe(std::function<void(std::vector<std::vector<int> >&)>(std::bind(&CProcessor::answerTradesRequests, this, std::placeholders::_1)));
 }
 
 CProcessor::~CProcessor(void)
@@ -44,33 +66,94 @@ bool CProcessor::SetServerInterface(MT4Server *server)
 void CProcessor::Clear()
 {
 	std::cout << "Start clearing" << std::endl;
+	if(started)
+	{
+		pipeline.Stop();
+		statusWorker.Stop();
+	}
 	module.Stop();
 	started = false;
 	std::cout << "Cleared" << std::endl;
 }
 
-void CProcessor::Initialize(std::string host, std::string port, std::string serverName, bool debug, bool autoExecution)
+void CProcessor::Initialize(const PluginSettings *settings)
 {
-	if(server == NULL) 
+	if(server == NULL || settings == NULL) 
 	{
 		return;
 	}
 
+	//--- caches and settings are in place before the first request can arrive
+	Configure(settings);
 	if(!started)
 	{
-		this->serverName = serverName;
-		module.Init(host, port, serverName);
-		module.Start();			
+		connection = settings;
+		serverName = settings->name;
+		if(settings->warmUp)
+			WarmUp();
+		module.Init(settings->host, settings->port, settings->name);
+		module.SetRouters(settings->routerMode, settings->heartbeatInterval, settings->failoverTimeout);
+		module.SetJournal(settings->journalPath, settings->journalSize, settings->journalCommitInterval, settings->journalReplayAge);
+		//--- subscribe first, Start replays journaled requests
 		module.SubscribeOnOrderStatusRequest(std::function<void(std::vector<int>)>(std::bind(&CProcessor::OnTradesRequest, this, std::placeholders::_1)));
 		module.SubscribeOnExecuteSignal(std::function<void(ExecutionSignal)>(std::bind(&CProcessor::OnExecuteSignalRequest, this, std::placeholders::_1)));
+		module.SubscribeOnWatchedLogins(std::function<void(std::vector<int>&)>(std::bind(&CProcessor::OnWatchedLoginsRequest, this, std::placeholders::_1)));
+		module.Start();
+		//--- trade signals are queued behind the replayed journal, after the module is connected
+		pipeline.Start();
+		statusWorker.Start();
 		started = true;
 	}
-
-	cs.Lock();
-	this->autoExecution = autoExecution;
-	debugMode = debug;
 	sendLogMessage("Plugin initialized", CmdOK);
-	cs.Unlock();
+}
+
+void CProcessor::Configure(const PluginSettings *settings)
+{
+	equityCache.SetWindow(settings->equityBurstWindow);
+	commissions.SetRefresh(settings->commissionRefresh);
+	verdicts.SetLimit(settings->verdictCacheSize);
+	executedOrders.SetWindow(settings->dedupeWindow);
+	statusWorker.SetWindow(settings->statusCoalesceWindow);
+	statusCache.SetLimit(settings->statusCacheSize);
+	module.SetLaneWeights(settings->closeLaneWeight, settings->openLaneWeight, settings->statusLaneWeight);
+	openBoard(settings);
+	this->settings.store(settings, std::memory_order_release);
+}
+
+bool CProcessor::Validate(const PluginSettings *settings)
+{
+	if(settings->HasSharedMemoryRouter() && !settings->experimentalSharedMemory)
+	{
+		//--- nothing listens on shm:// at the router yet, the plugin would lose its router connection
+		sendLogMessage("shm:// routers need experimentalSharedMemory=1, settings are not applied", CmdErr);
+		return false;
+	}
+	return true;
+}
+
+bool CProcessor::Reconfigure(const PluginSettings *settings)
+{
+	bool reconnect;
+	reconfigureLock.Lock();
+	if(!Validate(settings))
+	{
+		reconfigureLock.Unlock();
+		return false;
+	}
+	reconnect = !started || connection == NULL || settings->ConnectionDiffers(*connection);
+	if(reconnect)
+	{
+		//--- connection settings changed, router connection and queues have to be rebuilt
+		Clear();
+		Initialize(settings);
+	}
+	else
+	{
+		Configure(settings);
+		sendLogMessage("Plugin settings updated", CmdOK);
+	}
+	reconfigureLock.Unlock();
+	return reconnect;
 }
 
 void CProcessor::addExecutedCommand(OpenOrderSignal signal, int request_id)
@@ -87,14 +170,63 @@ void CProcessor::addExecutedCommand(CloseOrderSignal signal, int request_id)
 	closeRequestsLock.Unlock();
 }
 
+void CProcessor::addPendingReport(int request_id, const std::string &comment, const ExecutionOrderReport &order)
+{
+	pendingReportsLock.Lock();
+	PendingReport &pending = pendingReports[request_id];
+	pending.comment = comment;
+	pending.order = order;
+	pending.added = PlatformMicroseconds();
+	pendingReportsLock.Unlock();
+}
+
+/// Outcome and timings of an order, queue time counts from the receive time of its signal
+static void reportOrder(ExecutionOrderReport &entry, const BaseExecutionSignal &request, unsigned long long received)
+{
+	entry.Result = request.Result();
+	entry.Ticket = request.Ticket();
+	entry.Price = request.Price();
+	entry.QueueTime = request.Started() > received ? (long long)(request.Started() - received) : 0;
+	entry.CheckTime = request.CheckTime();
+	entry.ExecuteTime = request.ExecuteTime();
+}
+
 void CProcessor::OnExecuteSignalRequest(ExecutionSignal signal)
 {
+	const PluginSettings *current = settings.load(std::memory_order_acquire);
+	bool autoExecution = current != NULL && current->autoExecution;
+	bool reports = current != NULL && current->executionReports;
+	unsigned long long received = signal.Received != 0 ? signal.Received : PlatformMicroseconds();
 	char message[256];
 	sprintf_s(message, 256, "OnExecuteSignalRequest, orders: %d", signal.Orders.size());
 	sendLogMessage(message, CmdOK);
+	//--- orders of the signal share account, symbol and price loads, opens are validated in one pass
+	OpenBatch opens(server, &commissions, &verdicts, &equityCache);
+	std::vector<DedupeKey> openKeys;
+	CloseBatch closes(server, &verdicts);
+	std::vector<DedupeKey> closeKeys;
+	//--- entries of the report in the order of the signal, batch orders point at theirs
+	ExecutionSignalReport report;
+	report.Comment = signal.comment;
+	report.Orders.resize(signal.Orders.size());
+	std::vector<int> openEntries, closeEntries;
 	for(int i = 0; i < signal.Orders.size(); i++)
 	{
 		auto order = signal.Orders[i];
+		ExecutionOrderReport &entry = report.Orders[i];
+		entry.Login = order.Login;
+		entry.ActionType = order.ActionType;
+		entry.OrderID = order.OrderID;
+		//--- a router resending after a reconnect must not execute the order twice
+		DedupeKey key = { &signal.comment, order.Login, (int)order.ActionType, order.OrderID };
+		if(!executedOrders.Insert(key))
+		{
+			sprintf_s(message, 256, "Duplicate order skipped, login: %d, order: %d", order.Login, order.OrderID);
+			sendLogMessage(message, CmdOK);
+			entry.Result = ResultDuplicate;
+			entry.QueueTime = (long long)(PlatformMicroseconds() - received);
+			continue;
+		}
 		switch(order.ActionType)
 		{
 		case ActionType::Open:
@@ -105,59 +237,182 @@ void CProcessor::OnExecuteSignalRequest(ExecutionSignal signal)
 
 				//char comment[32];
 				//sprintf_s(comment, 32, "Signal_%d_%d", signal.InitiatorTradingAccountId, signal.InitiatorOrderId);
-								 
-				auto request = OpenOrderSignal(order.Login, order.Symbol, order.Volume, 
-					order.TradeSide == TradeSide::Buy ? OP_BUY : OP_SELL, signal.comment, server, order.Commission);
-				auto res = request.Run(autoExecution);
-				if(res == 0)
-					sendLogMessage("No request added", CmdOK);
-				else
-				{
-					addExecutedCommand(request, res);
-				}
+
+				opens.Add(order.Login, order.Symbol, order.Volume, order.TradeSide == TradeSide::Buy ? OP_BUY : OP_SELL, order.Commission);
+				openKeys.push_back(key);
+				openEntries.push_back(i);
 			}
 			break;
 		case ActionType::Close:
-			{
-				//CloseOrderSignal(order.OrderID, server).Run();
-				auto request = CloseOrderSignal(order.OrderID, server);
-				auto res = request.Run(autoExecution);
-				if(res == 0)
-					sendLogMessage("No request added", CmdOK);
-				else
-				{
-					addExecutedCommand(request, res);
-				}
-			}
+			closes.Add(order.OrderID);
+			closeKeys.push_back(key);
+			closeEntries.push_back(i);
 			break;
 		default:
 			sendLogMessage("Invalid action type", CmdErr);
+			executedOrders.Erase(key);
+			entry.Result = ResultInvalidOrder;
+			entry.QueueTime = (long long)(PlatformMicroseconds() - received);
 		}
 	}
+
+	//--- closes run first, a reversal opens with the margin its close released
+	if(!closes.Empty())
+	{
+		closes.Run(autoExecution, [&](int index, CloseOrderSignal &request, int res)
+		{
+			ExecutionOrderReport &entry = report.Orders[closeEntries[index]];
+			reportOrder(entry, request, received);
+			entry.RequestId = res;
+			equityCache.Invalidate(entry.Login);
+			//--- executed and added orders stay in the dedupe window, failed ones may be sent again
+			if(request.Result() != ResultExecuted && request.Result() != ResultRequestAdded)
+				executedOrders.Erase(closeKeys[index]);
+			if(res == 0)
+			{
+				sendLogMessage("No request added", CmdOK);
+			}
+			else
+			{
+				if(reports)
+					addPendingReport(res, signal.comment, entry);
+				addExecutedCommand(request, res);
+			}
+		});
+	}
+
+	if(!opens.Empty())
+	{
+		opens.Run(autoExecution, signal.comment, [&](int index, OpenOrderSignal &request, int res)
+		{
+			ExecutionOrderReport &entry = report.Orders[openEntries[index]];
+			reportOrder(entry, request, received);
+			entry.RequestId = res;
+			if(request.Result() != ResultExecuted && request.Result() != ResultRequestAdded)
+				executedOrders.Erase(openKeys[index]);
+			if(res == 0)
+			{
+				sendLogMessage("No request added", CmdOK);
+			}
+			else
+			{
+				if(reports)
+					addPendingReport(res, signal.comment, entry);
+				addExecutedCommand(request, res);
+			}
+		});
+	}
+
+	//--- one report per signal, the router needs no status request to learn what happened
+	if(reports && !report.Orders.empty())
+		module.SendExecutionReport(report);
 }
 
-void CProcessor::sendOpenSignal(UserInfo &ui, TradeRecord *trade)
+void CProcessor::captureTrade(int event, const UserInfo *ui, const TradeRecord *trade)
 {
-	if(trade->cmd > OP_SELL) return;
+	TradeSnapshot snapshot;
+	snapshot.event = event;
+	snapshot.login = trade->login;
+	snapshot.order = trade->order;
+	snapshot.cmd = trade->cmd;
+	snapshot.volume = trade->volume;
+	snapshot.time = event == TradeEventOpen ? trade->open_time : trade->close_time;
+	snapshot.sl = trade->sl;
+	snapshot.tp = trade->tp;
+	snapshot.profit = trade->profit;
+	snapshot.commission = trade->conv_rates[1];
+	COPY_STR(snapshot.symbol, trade->symbol);
+	COPY_STR(snapshot.comment, trade->comment);
+	if(ui != NULL)
+	{
+		snapshot.balance = ui->balance;
+		snapshot.credit = ui->credit;
+		COPY_STR(snapshot.group, ui->group);
+		COPY_STR(snapshot.currency, ui->grp.currency);
+	}
+	else
+	{
+		//--- account will be loaded on the pipeline thread
+		snapshot.balance = snapshot.credit = 0.0;
+		snapshot.group[0] = snapshot.currency[0] = 0;
+	}
+	if(!pipeline.Push(snapshot))
+	{
+		//--- a lost provider trade is a lost copy for every follower, the consistency check tells which
+		char message[256];
+		sprintf_s(message, 256, "Trade pipeline is full, trade dropped, login: %d, order: %d, event: %d", snapshot.login, snapshot.order, snapshot.event);
+		sendLogMessage(message, CmdErr);
+	}
+}
+
+void CProcessor::OnTradeSnapshot(TradeSnapshot &snapshot)
+{
+	switch(snapshot.event)
+	{
+		case TradeEventOpen:
+			sendOpenSignal(snapshot);
+		break;
+		case TradeEventClose:
+			sendCloseSignal(snapshot);
+		break;
+	}
+}
 
-	double equity, margin, free_margin;
-	server->TradesMarginInfo(&ui, &margin, &free_margin, &equity);
+UserInfo CProcessor::snapshotUserInfo(TradeSnapshot &snapshot)
+{
+	UserInfo ui = BaseExecutionSignal::UserInfoLoad(snapshot.login, server);
+	if(snapshot.group[0] != 0)
+	{
+		//--- balance as it was at the moment of the trade
+		ui.balance = snapshot.balance;
+		ui.credit = snapshot.credit;
+	}
+	else
+	{
+		snapshot.balance = ui.balance;
+		snapshot.credit = ui.credit;
+		COPY_STR(snapshot.group, ui.group);
+		COPY_STR(snapshot.currency, ui.grp.currency);
+	}
+	return ui;
+}
+
+double CProcessor::snapshotEquity(TradeSnapshot &snapshot)
+{
+	EquitySnapshot account;
+	if(equityCache.Get(snapshot.login, account))
+	{
+		if(snapshot.group[0] == 0)
+			snapshotUserInfo(snapshot);
+		return account.equity;
+	}
+
+	UserInfo ui = snapshotUserInfo(snapshot);
+	server->TradesMarginInfo(&ui, &account.margin, &account.free_margin, &account.equity);
+	equityCache.Put(snapshot.login, account);
+	return account.equity;
+}
+
+void CProcessor::sendOpenSignal(TradeSnapshot &snapshot)
+{
+	double equity = snapshotEquity(snapshot);
 	
 	MT4TradeSignal signal;
-	signal.Side = trade->cmd == OP_BUY ? TradeSide::Buy : TradeSide::Sell;
+	signal.Side = snapshot.cmd == OP_BUY ? TradeSide::Buy : TradeSide::Sell;
 	signal.ActionType = ActionType::Open;
-	signal.DateTime = trade->open_time;
+	signal.DateTime = snapshot.time;
 	signal.Equity = equity;
-	signal.Balance = ui.balance;
-	signal.Volume = 0.01 * trade->volume;
-	signal.Symbol = trade->symbol;
-	signal.Login = trade->login;
+	signal.Balance = snapshot.balance;
+	signal.Volume = 0.01 * snapshot.volume;
+	signal.Symbol = snapshot.symbol;
+	signal.Login = snapshot.login;
 	signal.Server = serverName;
-	signal.StopLoss = trade->sl;
-	signal.TakeProfit = trade->tp;
-	signal.OrderID = trade->order;
-	signal.Comment = trade->comment;
-	signal.ProviderCommission = trade->conv_rates[1] * server->TradesCalcRates(ui.group, ui.grp.currency, "USD");
+	signal.StopLoss = snapshot.sl;
+	signal.TakeProfit = snapshot.tp;
+	signal.OrderID = snapshot.order;
+	signal.Comment = snapshot.comment;
+	signal.Profit = 0.0;
+	signal.ProviderCommission = snapshot.commission * server->TradesCalcRates(snapshot.group, snapshot.currency, "USD");
 
 	char orderinfo[256];
 	sprintf_s(orderinfo, 256, "sendOpenSignal, comm: %0.2f", signal.ProviderCommission);
@@ -166,101 +421,358 @@ void CProcessor::sendOpenSignal(UserInfo &ui, TradeRecord *trade)
 	module.SendTradeSignal(signal);
 }
 
-void CProcessor::sendCloseSignal(UserInfo &ui, TradeRecord *trade)
+void CProcessor::sendCloseSignal(TradeSnapshot &snapshot)
 {
-	if(trade->cmd > OP_SELL) return;
-	
-	double equity, margin, free_margin;
-	server->TradesMarginInfo(&ui, &margin, &free_margin, &equity);	
+	double equity = snapshotEquity(snapshot);
 
 	MT4TradeSignal signal;
-	signal.Side = trade->cmd == OP_BUY ? TradeSide::Buy : TradeSide::Sell;
+	signal.Side = snapshot.cmd == OP_BUY ? TradeSide::Buy : TradeSide::Sell;
 	signal.ActionType = ActionType::Close;	
 
-	signal.OrderID = trade->order;
-	signal.DateTime = trade->close_time;
+	signal.OrderID = snapshot.order;
+	signal.DateTime = snapshot.time;
 	signal.Equity = equity; 
-	signal.Balance = ui.balance;
-	signal.Volume = 0.01 * trade->volume;
-	signal.Symbol = trade->symbol;
-	signal.Login = trade->login;
+	signal.Balance = snapshot.balance;
+	signal.Volume = 0.01 * snapshot.volume;
+	signal.Symbol = snapshot.symbol;
+	signal.Login = snapshot.login;
 	signal.Server = serverName;
-	signal.StopLoss = trade->sl;
-	signal.TakeProfit = trade->tp;
-	signal.Comment = trade->comment;
-	signal.Profit = trade->profit;
+	signal.StopLoss = snapshot.sl;
+	signal.TakeProfit = snapshot.tp;
+	signal.Comment = snapshot.comment;
+	signal.Profit = snapshot.profit;
+	signal.ProviderCommission = 0.0;
 
 
 	module.SendTradeSignal(signal);
 }
 	
 
-void CProcessor::OnNewTrade(UserInfo ui, TradeRecord *trade, int mode)
+void CProcessor::OnNewTrade(const UserInfo *ui, const TradeRecord *trade, int mode)
 {
+	//--- a trade which is not watched costs one lookup and nothing else
+	if(!watchedLogins.IsWatched(trade->login)) return;
+	//--- status entries list pending orders too, they change the cached status as well
+	statusCache.Touch(trade->login);
+	if(trade->cmd > OP_SELL) return;
+	//--- a restored trade is still open, the board gets it without a signal
+	putBoardPosition(trade);
 	if(mode == OPEN_RESTORE) return;
 
-	sendOpenSignal(ui, trade);
+	captureTrade(TradeEventOpen, ui, trade);
 }
 
-void CProcessor::OnTradeUpdate(UserInfo ui, TradeRecord *trade, int mode)
+void CProcessor::OnTradeUpdate(const UserInfo *ui, const TradeRecord *trade, int mode)
 {
+	if(!watchedLogins.IsWatched(trade->login)) return;
+	statusCache.Touch(trade->login);
+	if(trade->cmd > OP_SELL) return;
+	if(board.IsOpen())
+	{
+		if(mode == UPDATE_CLOSE || mode == UPDATE_DELETE)
+			board.Erase(trade->login, trade->order);
+		else
+			putBoardPosition(trade);
+	}
+
 	switch(mode)
 	{
 		case UPDATE_ACTIVATE:	
-				sendOpenSignal(ui, trade);
+				captureTrade(TradeEventOpen, ui, trade);
 		break;
 		case UPDATE_CLOSE:	
 		case UPDATE_DELETE:	
-				sendCloseSignal(ui, trade);
+				captureTrade(TradeEventClose, ui, trade);
 		break;		
 	}
 }
 	
+void CProcessor::OnWatchedLoginsRequest(std::vector<int> &logins)
+{
+	watchedLogins.Update(logins);
+	//--- trades of a login which is not watched do not touch its entry, entries are kept for watched logins only
+	statusCache.Clear();
+	loadBoard(logins);
+
+	char message[256];
+	sprintf_s(message, 256, "OnWatchedLoginsRequest, logins: %d", (int)logins.size());
+	sendLogMessage(message, CmdOK);
+}
+
+unsigned long long CProcessor::TradesProcessed()
+{
+	return pipeline.Processed();
+}
+
+unsigned long long CProcessor::TradesDropped()
+{
+	return pipeline.Dropped();
+}
+
+unsigned long long CProcessor::TradesSpilled()
+{
+	return pipeline.Spilled();
+}
+
+unsigned long long CProcessor::StatusProcessed()
+{
+	return statusWorker.Processed();
+}
+
+unsigned long long CProcessor::StatusScans()
+{
+	return statusWorker.Scans();
+}
+
 void CProcessor::OnTradesRequest(std::vector<int> logins)
 {
-	OrdersStatusResponse responce;
+	//--- the scan runs on the status lane, the module thread goes on with executions
+	statusWorker.Push(logins);
+}
 
-	for(int i = 0; i < logins.size(); i++)
-	{
-		
-		AccountOrdersStatus status;
-		status.Login = logins[i];
+LaneStats CProcessor::GetLaneStats(int lane)
+{
+	return module.GetLaneStats(lane);
+}
 
-		std::vector<TradeRecord> orders = LoadOpenedOrders(logins[i]);
-		for(int j = 0; j < orders.size(); j++)
+void CProcessor::OnConfigChanged()
+{
+	//--- contract size, digits, group securities or currency may be different now
+	commissions.Clear();
+	verdicts.Clear();
+}
+
+WarmUpStats CProcessor::WarmUp()
+{
+	WarmUpStats stats;
+	memset(&stats, 0, sizeof(stats));
+	if(server == NULL)
+		return stats;
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	stats.hooks = ExtPluginChain.Load(path);
+	stats.plugins = ExtPluginChain.Plugins();
+	stats.messages = SignalModule::WarmUp();
+
+	std::vector<ConSymbol> symbols;
+	ConSymbol symbol;
+	for(int pos = 0; server->SymbolsNext(pos, &symbol); pos++)
+		symbols.push_back(symbol);
+	stats.symbols = (int)symbols.size();
+
+	//--- the group goes into an account, point values take one
+	UserInfo ui;
+	memset(&ui, 0, sizeof(ui));
+	std::set<std::string> currencies;
+	size_t verdictRoom = (size_t)(std::max)(verdicts.GetLimit(), 0) / 2;
+	for(int pos = 0; server->GroupsNext(pos, &ui.grp); pos++)
+	{
+		stats.groups++;
+		COPY_STR(ui.group, ui.grp.group);
+		bool currency = currencies.insert(ui.grp.currency).second;
+		for(size_t i = 0; i < symbols.size(); i++)
 		{
-			OrderStatus order;
-			order.DateTime = orders[j].close_time;
-			order.Volume = 0.01 * orders[j].volume;
-			order.Symbol = orders[j].symbol;
-			order.StopLoss = orders[j].sl;
-			order.TakeProfit = orders[j].tp;
-			order.OrderID = orders[j].order;
-			order.Side = orders[j].cmd == OP_BUY ? TradeSide::Buy : TradeSide::Sell;
-			order.Comment = orders[j].comment;
-			status.Status.push_back(order);
+			//--- point values depend on the currency of the group only
+			if(currency)
+			{
+				commissions.PointValue(server, symbols[i], ui);
+				stats.pointValues++;
+			}
+			//--- half of the verdict cache at most, orders need room for their volumes and prices
+			if(verdicts.Size() < verdictRoom)
+			{
+				verdicts.CheckSecurity(server, symbols[i], ui.grp);
+				stats.verdicts++;
+			}
 		}
-		responce.OrdersStatus.push_back(status);
 	}
 
-	module.SendOrdersStatusResponse(responce);
+	stats.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	char message[256];
+	sprintf_s(message, 256, "Warm-up done in %0.1f ms: plugins %d, hooks %d, groups %d, symbols %d, point values %d, verdicts %d, messages %d",
+		stats.ms, stats.plugins, stats.hooks, stats.groups, stats.symbols, stats.pointValues, stats.verdicts, stats.messages);
+	sendLogMessage(message, CmdOK);
+	cs.Lock();
+	warmUpStats = stats;
+	cs.Unlock();
+	return stats;
 }
 
-std::vector<TradeRecord> CProcessor::LoadOpenedOrders(int login)
+WarmUpStats CProcessor::LastWarmUp()
 {
-	std::vector<TradeRecord> opened_trades;
+	cs.Lock();
+	WarmUpStats stats = warmUpStats;
+	cs.Unlock();
+	return stats;
+}
+
+void CProcessor::answerTradesRequests(std::vector<std::vector<int> > &requests)
+{
+	const PluginSettings *current = settings.load(std::memory_order_acquire);
+	int batchSize = current != NULL ? current->statusBatchSize : 0;
+
+	//--- requests of the window overlap, every login is read once for all of them
+	statusLogins.clear();
+	for(size_t r = 0; r < requests.size(); r++)
+		statusLogins.insert(statusLogins.end(), requests[r].begin(), requests[r].end());
+	std::sort(statusLogins.begin(), statusLogins.end());
+	statusLogins.erase(std::unique(statusLogins.begin(), statusLogins.end()), statusLogins.end());
+
+	//--- versions are taken before the orders are read, entries without a trade since then are copied as they are
+	statusEntries.Clear();
+	statusSpans.resize(statusLogins.size());
+	statusMissed.clear();
+	for(size_t i = 0; i < statusLogins.size(); i++)
+	{
+		StatusSpan &span = statusSpans[i];
+		span.version = statusCache.Version(statusLogins[i]);
+		span.offset = statusEntries.Size();
+		if(watchedLogins.IsWatched(statusLogins[i]) && statusCache.Get(statusLogins[i], span.version, statusEntries))
+			span.size = statusEntries.Size() - span.offset;
+		else
+			statusMissed.push_back(statusLogins[i]);
+	}
+
+	//--- orders go from the server array straight into the wire format
+	if(batchSize > 0)
+	{
+		for(size_t first = 0; first < statusMissed.size(); first += batchSize)
+			readStatusBatch(&statusMissed[first], (int)(std::min)((size_t)batchSize, statusMissed.size() - first));
+	}
+	else
+	{
+		for(size_t i = 0; i < statusMissed.size(); i++)
+			readStatusLogin(statusMissed[i]);
+	}
 
+	//--- every request gets its own response of its logins in its order
+	for(size_t r = 0; r < requests.size(); r++)
+	{
+		statusResponse.Clear();
+		for(size_t i = 0; i < requests[r].size(); i++)
+		{
+			size_t index = std::lower_bound(statusLogins.begin(), statusLogins.end(), requests[r][i]) - statusLogins.begin();
+			statusResponse.AddAccount(statusEntries.Content().data() + statusSpans[index].offset, statusSpans[index].size);
+		}
+		module.SendOrdersStatusResponse(statusResponse);
+	}
+}
+
+void CProcessor::readStatusLogin(int login)
+{
 	UserInfo ui = BaseExecutionSignal::UserInfoLoad(login, server);
 	int total = 0;
 	TradeRecord* trades = server->OrdersGetOpen(&ui, &total);
 
+	size_t offset = statusEntries.Size();
+	statusEntries.BeginAccount(login);
+	for(int j = 0; j < total; j++)
+		addStatusOrder(trades[j]);
+	statusEntries.EndAccount();
+	endStatusEntry(login, offset);
+
+	if(trades != NULL)
+		HEAP_FREE(trades);
+}
+
+void CProcessor::readStatusBatch(const int *logins, int count)
+{
+	//--- open trades of all logins of the batch in one call, no account is loaded
+	int total = 0;
+	TradeRecord* trades = server->OrdersGet(0, STATUS_TIME_MAX, logins, count, &total);
+
+	//--- the server does not promise any order of the trades, they are grouped by login
+	statusOrder.resize(total);
 	for(int i = 0; i < total; i++)
+		statusOrder[i] = i;
+	std::stable_sort(statusOrder.begin(), statusOrder.end(), [trades](int a, int b) { return trades[a].login < trades[b].login; });
+
+	for(int i = 0; i < count; i++)
+	{
+		size_t offset = statusEntries.Size();
+		statusEntries.BeginAccount(logins[i]);
+		auto it = std::lower_bound(statusOrder.begin(), statusOrder.end(), logins[i], [trades](int index, int login) { return trades[index].login < login; });
+		for(; it != statusOrder.end() && trades[*it].login == logins[i]; ++it)
+			addStatusOrder(trades[*it]);
+		statusEntries.EndAccount();
+		endStatusEntry(logins[i], offset);
+	}
+
+	if(trades != NULL)
+		HEAP_FREE(trades);
+}
+
+void CProcessor::addStatusOrder(const TradeRecord &trade)
+{
+	statusEntries.AddOrder(trade.order, trade.cmd == OP_BUY ? TradeSide::Buy : TradeSide::Sell,
+		trade.close_time, 0.01 * trade.volume, trade.symbol, trade.sl, trade.tp, trade.comment);
+}
+
+void CProcessor::endStatusEntry(int login, size_t offset)
+{
+	StatusSpan &span = statusSpans[std::lower_bound(statusLogins.begin(), statusLogins.end(), login) - statusLogins.begin()];
+	span.offset = offset;
+	span.size = statusEntries.Size() - offset;
+	if(watchedLogins.IsWatched(login))
+		statusCache.Put(login, span.version, statusEntries.Content().data() + offset, span.size);
+}
+
+void CProcessor::openBoard(const PluginSettings *settings)
+{
+	boardLock.Lock();
+	if(settings->positionsBoard != boardName || settings->positionsBoardLogins != boardLogins || settings->positionsBoardPositions != boardPositions)
 	{
-		opened_trades.push_back(trades[i]);
+		boardName = settings->positionsBoard;
+		boardLogins = settings->positionsBoardLogins;
+		boardPositions = settings->positionsBoardPositions;
+		board.Close();
+		if(!boardName.empty())
+		{
+			if(board.Open(boardName, PositionsBoardWriter, boardLogins, boardPositions))
+				loadBoard(boardWatched);
+			else
+				sendLogMessage("Positions board " + boardName + " can not be opened", CmdErr);
+		}
 	}
+	boardLock.Unlock();
+}
 
-	HEAP_FREE(trades);
-	return opened_trades;
+void CProcessor::loadBoard(const std::vector<int> &logins)
+{
+	boardLock.Lock();
+	boardWatched = logins;
+	if(board.IsOpen() && !logins.empty())
+	{
+		//--- slots are taken first, trade hooks keep them up to date while the trades load
+		board.BeginLoad(&logins[0], (int)logins.size());
+		for(size_t first = 0; first < logins.size(); first += BOARD_LOAD_BATCH)
+		{
+			int total = 0;
+			int count = (int)(std::min)((size_t)BOARD_LOAD_BATCH, logins.size() - first);
+			TradeRecord* trades = server->OrdersGet(0, STATUS_TIME_MAX, &logins[first], count, &total);
+			for(int i = 0; i < total; i++)
+			{
+				if(trades[i].cmd > OP_SELL)
+					continue;
+				BoardPosition position;
+				BoardPositionFromTrade(trades[i], position);
+				board.Load(trades[i].login, position);
+			}
+			if(trades != NULL)
+				HEAP_FREE(trades);
+		}
+		board.EndLoad();
+	}
+	boardLock.Unlock();
+}
+
+void CProcessor::putBoardPosition(const TradeRecord *trade)
+{
+	if(!board.IsOpen())
+		return;
+	BoardPosition position;
+	BoardPositionFromTrade(*trade, position);
+	board.Put(trade->login, position);
 }
 
 void CProcessor::sendLogMessage(std::string text, int type) 
@@ -288,14 +800,13 @@ int  CProcessor::OnDealerReset(const int id,const UserInfo *us,const char flag)
 
 void CProcessor::HandleDealerAnswer(int id, double bid, double ask, RequestResultType type)
 {
-	DWORD thread;	
 	RequestResult *r = new RequestResult();
 	r->ask = ask;
 	r->bid = bid;
 	r->id = id;
 	r->type = type;
 	r->pParam = this;
-	CreateThread(NULL, 0, DealerAnswer, r, 0, &thread);
+	PlatformThread::Run(DealerAnswer, r);
 }
 
 void CProcessor::OnDealerAnswer(RequestResult result)
@@ -304,7 +815,8 @@ void CProcessor::OnDealerAnswer(RequestResult result)
 	openRequestsLock.Lock();
 	if(openRequests.find(result.id) != openRequests.end() )
 	{
-		openRequests[result.id].Execute(result.bid, result.ask);
+		openRequests[result.id].Complete(result.bid, result.ask);
+		sendDealerReport(result.id, openRequests[result.id]);
 		openRequests.erase(result.id);
 	}
 	openRequestsLock.Unlock();
@@ -312,12 +824,40 @@ void CProcessor::OnDealerAnswer(RequestResult result)
 	closeRequestsLock.Lock();
 	if(closeRequests.find(result.id) != closeRequests.end() )
 	{
-		closeRequests[result.id].Execute(result.bid, result.ask);
+		closeRequests[result.id].Complete(result.bid, result.ask);
+		sendDealerReport(result.id, closeRequests[result.id]);
 		closeRequests.erase(result.id);
 	}
 	closeRequestsLock.Unlock();
 }
 
+void CProcessor::sendDealerReport(int request_id, const BaseExecutionSignal &request)
+{
+	pendingReportsLock.Lock();
+	auto pending = pendingReports.find(request_id);
+	if(pending == pendingReports.end())
+	{
+		pendingReportsLock.Unlock();
+		return;
+	}
+	ExecutionSignalReport report;
+	report.Comment.swap(pending->second.comment);
+	report.Orders.push_back(pending->second.order);
+	unsigned long long added = pending->second.added;
+	pendingReports.erase(pending);
+	pendingReportsLock.Unlock();
+
+	//--- the order waited for the dealer since it was added, its checks ran before
+	ExecutionOrderReport &entry = report.Orders.back();
+	entry.Result = request.Result();
+	entry.Ticket = request.Ticket();
+	entry.Price = request.Price();
+	entry.ExecuteTime = request.ExecuteTime();
+	unsigned long long waited = PlatformMicroseconds() - added;
+	entry.QueueTime = waited > (unsigned long long)entry.ExecuteTime ? (long long)waited - entry.ExecuteTime : 0;
+	module.SendExecutionReport(report);
+}
+
 DWORD WINAPI CProcessor::DealerAnswer(LPVOID pParam)
 {
 	RequestResult *result = (RequestResult*)pParam;
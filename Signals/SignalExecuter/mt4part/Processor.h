@@ -4,12 +4,28 @@
 #include "common/Sync.h"
 #include "MT4ServerEmulator.h"
 #include "CloseOrderSignal.h"
+#include "CloseBatch.h"
 #include "OpenOrderSignal.h"
+#include "OpenBatch.h"
+#include "TradePipeline.h"
+#include "EquityCache.h"
+#include "CommissionTable.h"
+#include "VerdictCache.h"
+#include "LoginFilter.h"
+#include "DedupeIndex.h"
+#include "StatusWorker.h"
+#include "StatusCache.h"
+#include "PluginSettings.h"
 #include <string>
 #include <iostream>
 #include "SignalModule.h"
+#include "PositionsBoard.h"
 
 #define PLUGIN_NAME "Executer"
+/// Latest open time of the trades of a status batch, the last second of 32-bit time
+#define STATUS_TIME_MAX 0x7FFFFFFF
+/// Logins of the positions board loaded with one server call
+#define BOARD_LOAD_BATCH 1000
 
 std::vector<std::string> split(std::string line, char delim);
 
@@ -38,16 +54,51 @@ struct RequestResult
 	LPVOID pParam;
 };
 
+/// What the warm-up loaded and how long it took
+struct WarmUpStats
+{
+	int    plugins;
+	int    hooks;
+	int    groups;
+	int    symbols;
+	int    pointValues;
+	int    verdicts;
+	int    messages;
+	double ms;
+};
+
 class CProcessor
 {
 public:
 	CProcessor(void);
 	~CProcessor(void);
 
-	void Initialize(std::string host, std::string port, std::string serverName, bool debug, bool autoExecution);	
-	void OnNewTrade(UserInfo ui, TradeRecord *trade, int mode);
-	void OnTradeUpdate(UserInfo ui, TradeRecord *trade, int mode);
+	void Initialize(const PluginSettings *settings);	
+	/// Settings the processor can run on, logs why not. Settings are published only after they pass
+	bool Validate(const PluginSettings *settings);
+	/// Apply settings in place, reconnects only when host, port or name change. Returns true on reconnect,
+	/// settings which do not pass Validate are not applied
+	bool Reconfigure(const PluginSettings *settings);
+	void OnNewTrade(const UserInfo *ui, const TradeRecord *trade, int mode);
+	void OnTradeUpdate(const UserInfo *ui, const TradeRecord *trade, int mode);
 	void OnTradesRequest(std::vector<int> logins);
+	void OnWatchedLoginsRequest(std::vector<int> &logins);
+	unsigned long long TradesProcessed();
+	/// Trades dropped because the pipeline queue and its overflow list were full
+	unsigned long long TradesDropped();
+	/// Trades which went through the overflow list of the pipeline
+	unsigned long long TradesSpilled();
+	/// Orders status requests answered and scans they were answered with
+	unsigned long long StatusProcessed();
+	unsigned long long StatusScans();
+	/// Counters of the module's inbound lane
+	LaneStats GetLaneStats(int lane);
+	/// Symbol or group configuration of the server changed
+	void OnConfigChanged();
+	/// Load what the first signal would otherwise load: the plugin chain, groups and symbols, point values,
+	/// security verdicts and protobuf messages. Initialize runs it before the router connection starts
+	WarmUpStats WarmUp();
+	WarmUpStats LastWarmUp();
 	void OnExecuteSignalRequest(ExecutionSignal signal);
 	void Clear();
 	bool SetServerInterface(MT4Server *server);	
@@ -57,12 +108,26 @@ public:
 	int  OnDealerReset(const int id,const UserInfo *us,const char flag);
 
 private:	
-	std::vector<TradeRecord> CProcessor::LoadOpenedOrders(int login);
 	void sendLogMessage(std::string text, int type);
-	void sendOpenSignal(UserInfo &ui, TradeRecord *trade);
-	void sendCloseSignal(UserInfo &ui, TradeRecord *trade);
+	void Configure(const PluginSettings *settings);
+	void captureTrade(int event, const UserInfo *ui, const TradeRecord *trade);
+	void OnTradeSnapshot(TradeSnapshot &snapshot);
+	void answerTradesRequests(std::vector<std::vector<int> > &requests);
+	void readStatusBatch(const int *logins, int count);
+	void readStatusLogin(int login);
+	void addStatusOrder(const TradeRecord &trade);
+	void endStatusEntry(int login, size_t offset);
+	void openBoard(const PluginSettings *settings);
+	void loadBoard(const std::vector<int> &logins);
+	void putBoardPosition(const TradeRecord *trade);
+	UserInfo snapshotUserInfo(TradeSnapshot &snapshot);
+	double snapshotEquity(TradeSnapshot &snapshot);
+	void sendOpenSignal(TradeSnapshot &snapshot);
+	void sendCloseSignal(TradeSnapshot &snapshot);
 	void addExecutedCommand(OpenOrderSignal signal, int request_id);
 	void addExecutedCommand(CloseOrderSignal signal, int request_id);
+	void addPendingReport(int request_id, const std::string &comment, const ExecutionOrderReport &order);
+	void sendDealerReport(int request_id, const BaseExecutionSignal &request);
 	void HandleDealerAnswer(int id, double bid, double ask, RequestResultType type);
 
 	void OnDealerAnswer(RequestResult result);
@@ -70,8 +135,12 @@ private:
 
 	std::string serverName;
 	MT4Server *server;	
-	bool debugMode;
 	CSync cs;
+	CSync reconfigureLock;
+	/// Settings used on the hot path, published snapshot owned by CPluginSettings
+	std::atomic<const PluginSettings*> settings;
+	/// Snapshot the router connection was built from
+	const PluginSettings *connection;
 
 	CSync openRequestsLock;
 	std::map<int, OpenOrderSignal> openRequests;
@@ -79,8 +148,56 @@ private:
 	CSync closeRequestsLock;
 	std::map<int, CloseOrderSignal> closeRequests;
 
+	/// Report entry of an order passed to the dealer, sent again with the outcome of his answer
+	struct PendingReport
+	{
+		std::string          comment;
+		ExecutionOrderReport order;
+		unsigned long long   added;
+	};
+	CSync pendingReportsLock;
+	std::map<int, PendingReport> pendingReports;
+
 	SignalModule module;
-	volatile bool started, autoExecution;
+	/// Entry of an account in statusEntries and the version its orders were read at
+	struct StatusSpan
+	{
+		unsigned int version;
+		size_t       offset;
+		size_t       size;
+	};
+
+	/// Status response buffer, reused by the status lane
+	OrdersStatusWriter statusResponse;
+	/// Account entries of the logins of coalesced requests, each login once, reused by the status lane
+	OrdersStatusWriter statusEntries;
+	/// Sorted logins of coalesced requests, their entries and the logins read from the server
+	std::vector<int> statusLogins;
+	std::vector<StatusSpan> statusSpans;
+	std::vector<int> statusMissed;
+	/// Trades of a status batch ordered by login, reused by the status lane
+	std::vector<int> statusOrder;
+	/// Entries of the last orders status of logins, dropped by their trades
+	CStatusCache statusCache;
+	CTradePipeline pipeline;
+	CStatusWorker statusWorker;
+	CEquityCache equityCache;
+	CCommissionTable commissions;
+	/// Security, tick size and volume checks of the orders of execution signals
+	CVerdictCache verdicts;
+	CLoginFilter watchedLogins;
+	/// Open positions of the watched logins for readers on this host
+	PositionsBoard board;
+	/// Board settings it was opened with and the logins it holds, guarded by boardLock
+	std::string boardName;
+	int boardLogins;
+	int boardPositions;
+	std::vector<int> boardWatched;
+	CSync boardLock;
+	/// Orders of execution signals run within the dedupe window
+	CDedupeIndex executedOrders;
+	WarmUpStats warmUpStats;
+	volatile bool started;
 };
 
 extern CProcessor processor;
\ No newline at end of file
@@ -0,0 +1,74 @@
+#include "StdAfx.h"
+#include "StatusCache.h"
+
+CStatusCache::CStatusCache() :
+	limit(0)
+{
+	for(int i = 0; i < STATUS_VERSIONS; i++)
+		versions[i].store(0, std::memory_order_relaxed);
+}
+
+void CStatusCache::SetLimit(int limit)
+{
+	this->limit = limit < 0 ? 0 : limit;
+	if(this->limit == 0)
+		Clear();
+}
+
+int CStatusCache::GetLimit()
+{
+	return limit;
+}
+
+void CStatusCache::Touch(int login)
+{
+	versions[login & (STATUS_VERSIONS - 1)].fetch_add(1, std::memory_order_acq_rel);
+}
+
+unsigned int CStatusCache::Version(int login)
+{
+	return versions[login & (STATUS_VERSIONS - 1)].load(std::memory_order_acquire);
+}
+
+bool CStatusCache::Get(int login, unsigned int version, OrdersStatusWriter &writer)
+{
+	if(limit == 0)
+		return false;
+
+	sync.Lock();
+	auto it = entries.find(login);
+	bool found = it != entries.end() && it->second.version == version;
+	if(found)
+		writer.AddAccount(it->second.entry.data(), it->second.entry.size());
+	sync.Unlock();
+	return found;
+}
+
+void CStatusCache::Put(int login, unsigned int version, const char *entry, size_t size)
+{
+	if(limit == 0 || Version(login) != version)
+		return;
+
+	sync.Lock();
+	if(entries.size() >= (size_t)limit && entries.find(login) == entries.end())
+		entries.clear();
+	Entry &cached = entries[login];
+	cached.version = version;
+	cached.entry.assign(entry, size);
+	sync.Unlock();
+}
+
+void CStatusCache::Clear()
+{
+	sync.Lock();
+	entries.clear();
+	sync.Unlock();
+}
+
+size_t CStatusCache::Size()
+{
+	sync.Lock();
+	size_t size = entries.size();
+	sync.Unlock();
+	return size;
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <atomic>
+#include <string>
+#include <unordered_map>
+#include "common/Sync.h"
+#include "OrdersStatusWriter.h"
+
+/// Version counters of the logins, a power of two. Logins share a counter when they differ
+/// by a multiple of it, a trade of one of them only makes the others be read again
+#define STATUS_VERSIONS 4096
+
+/// Orders status entries of logins as they were written into a response, reused until a trade of the login changes.
+/// Trade hooks bump the version of the login, an entry is used only while the version it was read at is current.
+/// The version is taken before the orders are read: a trade changed while they are read bumps it past the entry.
+class CStatusCache
+{
+public:
+	CStatusCache();
+
+	/// Logins held before the cache starts over, 0 disables the cache
+	void SetLimit(int limit);
+	int  GetLimit();
+
+	/// A trade of the login was added, changed or closed
+	void Touch(int login);
+	/// Version to read the orders of the login at
+	unsigned int Version(int login);
+
+	/// Add the entry of the login read at the version to the response, false when there is none
+	bool Get(int login, unsigned int version, OrdersStatusWriter &writer);
+	/// Store the entry of the login read at the version, dropped when a trade came in meanwhile
+	void Put(int login, unsigned int version, const char *entry, size_t size);
+
+	void   Clear();
+	size_t Size();
+
+private:
+	struct Entry
+	{
+		unsigned int version;
+		std::string  entry;
+	};
+
+	std::atomic<unsigned int> versions[STATUS_VERSIONS];
+	CSync sync;
+	std::unordered_map<int, Entry> entries;
+	volatile int limit;
+};
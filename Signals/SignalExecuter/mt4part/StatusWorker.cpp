@@ -0,0 +1,107 @@
+#include "StdAfx.h"
+#include "StatusWorker.h"
+#include <iostream>
+
+#define STATUS_WORKER_IDLE_WAIT 100
+
+CStatusWorker::CStatusWorker() :
+	firstArrival(0), window(0), processed(0), scans(0)
+{
+}
+
+CStatusWorker::~CStatusWorker()
+{
+}
+
+void CStatusWorker::Subscribe(std::function<void(std::vector<std::vector<int> >&)> func)
+{
+	handler = func;
+}
+
+void CStatusWorker::SetWindow(int window)
+{
+	this->window = window < 0 ? 0 : window;
+}
+
+int CStatusWorker::GetWindow()
+{
+	return window;
+}
+
+void CStatusWorker::Push(std::vector<int> &logins)
+{
+	sync.Lock();
+	if(requests.empty())
+		firstArrival = PlatformTickCount();
+	requests.push_back(std::vector<int>());
+	requests.back().swap(logins);
+	sync.Unlock();
+	wakeup.Set();
+}
+
+size_t CStatusWorker::Depth()
+{
+	sync.Lock();
+	size_t depth = requests.size();
+	sync.Unlock();
+	return depth;
+}
+
+unsigned long long CStatusWorker::Processed()
+{
+	return processed.load();
+}
+
+unsigned long long CStatusWorker::Scans()
+{
+	return scans.load();
+}
+
+int CStatusWorker::ThreadFunction()
+{
+	DWORD limit = window;
+	DWORD waited = 0;
+	taken.clear();
+	sync.Lock();
+	bool found = !requests.empty();
+	if(found)
+		waited = PlatformTickCount() - firstArrival;
+	if(found && waited >= limit)
+	{
+		//--- one request without a window, everything that came within it otherwise
+		size_t count = limit == 0 ? 1 : requests.size();
+		taken.resize(count);
+		for(size_t i = 0; i < count; i++)
+		{
+			taken[i].swap(requests.front());
+			requests.pop_front();
+		}
+		firstArrival = PlatformTickCount();
+	}
+	sync.Unlock();
+
+	if(!found)
+	{
+		wakeup.Wait(STATUS_WORKER_IDLE_WAIT);
+		return 1;
+	}
+	if(taken.empty())
+	{
+		//--- the window of the first request is still open, a new request wakes the lane earlier
+		wakeup.Wait(limit - waited);
+		return 1;
+	}
+
+	try
+	{
+		if(handler)
+			handler(taken);
+	}
+	catch(std::exception &ex)
+	{
+		std::cout << "Exception in status worker: " << ex.what() << std::endl;
+	}
+	scans.fetch_add(1);
+	processed.fetch_add(taken.size());
+	return 1;
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <vector>
+#include "common/Sync.h"
+#include "common/Thread.h"
+
+/// Status lane of the processor: orders status scans run here, off the module handler thread,
+/// so a scan of thousands of logins never delays the next execution signal.
+/// Requests arriving within the coalescing window of the first one are handled together
+class CStatusWorker : public Thread
+{
+public:
+	CStatusWorker();
+	~CStatusWorker();
+
+	/// Set request handler, called on the worker thread with the logins of every request taken at once
+	void Subscribe(std::function<void(std::vector<std::vector<int> >&)> func);
+
+	/// Milliseconds the first waiting request waits for others, 0 handles requests one by one
+	void SetWindow(int window);
+	int  GetWindow();
+
+	/// Add request, the logins are taken over
+	void Push(std::vector<int> &logins);
+
+	/// Requests waiting and handled, and handler calls they were handled in
+	size_t Depth();
+	unsigned long long Processed();
+	unsigned long long Scans();
+
+protected:
+	virtual int ThreadFunction();
+
+private:
+	CSync sync;
+	std::deque<std::vector<int> > requests;
+	/// Tick count the first waiting request arrived at
+	DWORD firstArrival;
+	volatile int window;
+	PlatformEvent wakeup;
+	std::atomic<unsigned long long> processed;
+	std::atomic<unsigned long long> scans;
+	std::vector<std::vector<int> > taken;
+	std::function<void(std::vector<std::vector<int> >&)> handler;
+};
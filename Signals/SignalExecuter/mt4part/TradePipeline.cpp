@@ -0,0 +1,135 @@
+#include "StdAfx.h"
+#include "TradePipeline.h"
+#include <iostream>
+
+#define TRADE_PIPELINE_CAPACITY 65536
+#define TRADE_PIPELINE_IDLE_WAIT 100
+/// Snapshots the overflow list may hold besides the queue, about 40 MB
+#define TRADE_PIPELINE_OVERFLOW 262144
+
+CTradePipeline::CTradePipeline() :
+	queue(TRADE_PIPELINE_CAPACITY), overflowSize(0), waiting(false), running(false), processed(0), dropped(0), spilled(0)
+{
+}
+
+CTradePipeline::~CTradePipeline()
+{
+}
+
+void CTradePipeline::Subscribe(std::function<void(TradeSnapshot&)> func)
+{
+	handler = func;
+}
+
+void CTradePipeline::Start()
+{
+	running.store(true);
+	Thread::Start();
+}
+
+void CTradePipeline::Stop()
+{
+	running.store(false);
+	Thread::Stop();
+}
+
+bool CTradePipeline::Push(const TradeSnapshot &snapshot)
+{
+	if(overflowSize.load() == 0 && queue.TryPush(snapshot))
+	{
+		if(waiting.load())
+			wakeup.Set();
+		return true;
+	}
+
+	//--- the pipeline is far behind, the trade thread is not held and the trade is not lost
+	bool added = false;
+	overflowSync.Lock();
+	if(overflow.size() < TRADE_PIPELINE_OVERFLOW)
+	{
+		overflow.push_back(snapshot);
+		overflowSize.store(overflow.size());
+		added = true;
+	}
+	overflowSync.Unlock();
+
+	if(added)
+		spilled.fetch_add(1);
+	else
+		dropped.fetch_add(1);
+	wakeup.Set();
+	return added;
+}
+
+unsigned long long CTradePipeline::Processed()
+{
+	return processed.load();
+}
+
+unsigned long long CTradePipeline::Dropped()
+{
+	return dropped.load();
+}
+
+unsigned long long CTradePipeline::Spilled()
+{
+	return spilled.load();
+}
+
+bool CTradePipeline::takeOverflow(std::vector<TradeSnapshot> &snapshots)
+{
+	snapshots.clear();
+	if(overflowSize.load() == 0)
+		return false;
+	//--- snapshots pushed after the swap go to the queue, they are newer than the taken ones
+	overflowSync.Lock();
+	overflow.swap(snapshots);
+	overflowSize.store(0);
+	overflowSync.Unlock();
+	return !snapshots.empty();
+}
+
+int CTradePipeline::ThreadFunction()
+{
+	TradeSnapshot snapshot;
+	if(!queue.TryPop(snapshot))
+	{
+		//--- everything queued is older than the spilled snapshots, they are handled next
+		if(takeOverflow(taken))
+		{
+			for(size_t i = 0; i < taken.size(); i++)
+				handle(taken[i]);
+			return 1;
+		}
+		//--- announce the sleep before the last check, so a concurrent Push either is seen here or wakes us
+		waiting.store(true);
+		if(!queue.TryPop(snapshot))
+		{
+			wakeup.Wait(TRADE_PIPELINE_IDLE_WAIT);
+			waiting.store(false);
+			return 1;
+		}
+		waiting.store(false);
+	}
+
+	do
+	{
+		handle(snapshot);
+	} while(queue.TryPop(snapshot));
+
+	return 1;
+}
+
+void CTradePipeline::handle(TradeSnapshot &snapshot)
+{
+	try
+	{
+		if(handler)
+			handler(snapshot);
+	}
+	catch(std::exception &ex)
+	{
+		std::cout << "Exception in trade pipeline: " << ex.what() << std::endl;
+	}
+	processed.fetch_add(1);
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include <atomic>
+#include <functional>
+#include <vector>
+#include "common/Thread.h"
+#include "common/Sync.h"
+#include "common/LockFreeQueue.h"
+
+enum TradeEventType { TradeEventOpen = 0, TradeEventClose };
+
+/// Plain copy of the trade fields needed to build a trade signal.
+/// Captured on the MT4 trade thread, everything else is done on the pipeline thread.
+struct TradeSnapshot
+{
+	int    event;
+	int    login;
+	int    order;
+	int    cmd;
+	int    volume;
+	time_t time;
+	double sl;
+	double tp;
+	double profit;
+	double commission;
+	double balance;
+	double credit;
+	char   symbol[12];
+	char   comment[32];
+	char   group[16];
+	char   currency[12];
+};
+
+/// Single consumer thread which handles trade snapshots in the order they were captured
+class CTradePipeline : public Thread
+{
+public:
+	CTradePipeline();
+	~CTradePipeline();
+
+	/// Set snapshot handler, called on the pipeline thread
+	void Subscribe(std::function<void(TradeSnapshot&)> func);
+
+	/// Start or stop the pipeline thread, snapshots pushed while it is stopped wait for the next start
+	void Start();
+	void Stop();
+
+	/// Add snapshot, never waits. A full queue spills into the overflow list, which allocates.
+	/// Returns false when the overflow list is full too and the snapshot is dropped
+	bool Push(const TradeSnapshot &snapshot);
+
+	/// Count of handled snapshots
+	unsigned long long Processed();
+	/// Count of snapshots dropped with the queue and the overflow list full
+	unsigned long long Dropped();
+	/// Count of snapshots which went through the overflow list
+	unsigned long long Spilled();
+
+protected:
+	virtual int ThreadFunction();
+
+private:
+	/// Move the overflow list to the pipeline thread, called when the queue is empty
+	bool takeOverflow(std::vector<TradeSnapshot> &snapshots);
+	void handle(TradeSnapshot &snapshot);
+
+	LockFreeQueue<TradeSnapshot> queue;
+	/// Snapshots which did not fit into the queue, in the order they were pushed.
+	/// While it is not empty, later snapshots go there too, so the order of the trades is kept
+	std::vector<TradeSnapshot> overflow;
+	std::atomic<size_t> overflowSize;
+	CSync overflowSync;
+	/// Overflow list taken by the pipeline thread, its memory is reused
+	std::vector<TradeSnapshot> taken;
+	PlatformEvent wakeup;
+	std::atomic<bool> waiting;
+	std::atomic<bool> running;
+	std::atomic<unsigned long long> processed;
+	std::atomic<unsigned long long> dropped;
+	std::atomic<unsigned long long> spilled;
+	std::function<void(TradeSnapshot&)> handler;
+};
@@ -0,0 +1,125 @@
+#include "StdAfx.h"
+#include "VerdictCache.h"
+
+size_t VerdictKeyHash::operator()(const VerdictKey &key) const
+{
+	//--- FNV-1a
+	const unsigned char *data = (const unsigned char*)&key;
+	unsigned int hash = 2166136261u;
+	for(size_t i = 0; i < sizeof(VerdictKey); i++)
+		hash = (hash ^ data[i]) * 16777619u;
+	return hash;
+}
+
+CVerdictCache::CVerdictCache() :
+	limit(0)
+{
+}
+
+void CVerdictCache::SetLimit(int limit)
+{
+	this->limit = limit < 0 ? 0 : limit;
+	if(this->limit == 0)
+		Clear();
+}
+
+int CVerdictCache::GetLimit()
+{
+	return limit;
+}
+
+int CVerdictCache::CheckSecurity(MT4Server *server, const ConSymbol &symbol, const ConGroup &group)
+{
+	if(limit == 0)
+		return server->TradesCheckSecurity(&symbol, &group);
+
+	VerdictKey key;
+	memset(&key, 0, sizeof(key));
+	key.check = VerdictSecurity;
+	COPY_STR(key.group, group.group);
+	COPY_STR(key.symbol, symbol.symbol);
+	int verdict;
+	if(!find(key, verdict))
+	{
+		verdict = server->TradesCheckSecurity(&symbol, &group);
+		store(key, verdict);
+	}
+	return verdict;
+}
+
+int CVerdictCache::CheckTickSize(MT4Server *server, double price, const ConSymbol &symbol)
+{
+	if(limit == 0)
+		return server->TradesCheckTickSize(price, &symbol);
+
+	VerdictKey key;
+	memset(&key, 0, sizeof(key));
+	key.check = VerdictTickSize;
+	COPY_STR(key.symbol, symbol.symbol);
+	key.price = price;
+	int verdict;
+	if(!find(key, verdict))
+	{
+		verdict = server->TradesCheckTickSize(price, &symbol);
+		store(key, verdict);
+	}
+	return verdict;
+}
+
+int CVerdictCache::CheckVolume(MT4Server *server, const TradeTransInfo &trans, const ConSymbol &symbol, const ConGroup &group)
+{
+	if(limit == 0)
+		return server->TradesCheckVolume(&trans, &symbol, &group, TRUE);
+
+	VerdictKey key;
+	memset(&key, 0, sizeof(key));
+	key.check = VerdictVolume;
+	COPY_STR(key.group, group.group);
+	COPY_STR(key.symbol, symbol.symbol);
+	key.cmd = trans.cmd;
+	key.volume = trans.volume;
+	key.closing = trans.order != 0;
+	int verdict;
+	if(!find(key, verdict))
+	{
+		verdict = server->TradesCheckVolume(&trans, &symbol, &group, TRUE);
+		store(key, verdict);
+	}
+	return verdict;
+}
+
+bool CVerdictCache::find(const VerdictKey &key, int &verdict)
+{
+	sync.Lock();
+	auto it = verdicts.find(key);
+	bool found = it != verdicts.end();
+	if(found)
+		verdict = it->second;
+	sync.Unlock();
+	return found;
+}
+
+void CVerdictCache::store(const VerdictKey &key, int verdict)
+{
+	//--- the server is asked outside of the lock, two threads may store one verdict at once
+	sync.Lock();
+	if(verdicts.size() >= (size_t)limit)
+		verdicts.clear();
+	verdicts[key] = verdict;
+	sync.Unlock();
+}
+
+void CVerdictCache::Clear()
+{
+	sync.Lock();
+	verdicts.clear();
+	sync.Unlock();
+}
+
+size_t CVerdictCache::Size()
+{
+	sync.Lock();
+	size_t size = verdicts.size();
+	sync.Unlock();
+	return size;
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include <unordered_map>
+#include "common/Sync.h"
+#include "MT4ServerEmulator.h"
+
+/// Check of the server a verdict answers
+enum VerdictCheck { VerdictSecurity = 0, VerdictTickSize = 1, VerdictVolume = 2 };
+
+/// Everything a check result depends on, zero padded so equal keys compare equal byte for byte
+struct VerdictKey
+{
+	int    check;
+	char   group[16];
+	char   symbol[12];
+	/// Volume check: command, volume and closed order or 0
+	int    cmd;
+	int    volume;
+	int    closing;
+	/// Tick size check: price
+	double price;
+
+	bool operator==(const VerdictKey &other) const
+	{
+		return memcmp(this, &other, sizeof(VerdictKey)) == 0;
+	}
+};
+
+struct VerdictKeyHash
+{
+	size_t operator()(const VerdictKey &key) const;
+};
+
+/// Results of TradesCheckSecurity, TradesCheckTickSize and TradesCheckVolume by group, symbol, volume and price.
+/// Subscribers of one signal repeat the same few keys, so a fan-out asks the server once per distinct key.
+/// The results depend on the group and symbol configuration only: the cache is dropped when it changes
+/// and when it holds more verdicts than the limit (prices keep adding tick size keys).
+class CVerdictCache
+{
+public:
+	CVerdictCache();
+
+	/// Verdicts held before the cache starts over, 0 disables the cache
+	void SetLimit(int limit);
+	int  GetLimit();
+
+	/// Same results as the server calls
+	int  CheckSecurity(MT4Server *server, const ConSymbol &symbol, const ConGroup &group);
+	int  CheckTickSize(MT4Server *server, double price, const ConSymbol &symbol);
+	int  CheckVolume(MT4Server *server, const TradeTransInfo &trans, const ConSymbol &symbol, const ConGroup &group);
+
+	/// Drop everything (symbol or group configuration changed)
+	void   Clear();
+	size_t Size();
+
+private:
+	/// Cached verdict of the key, false when it is not known yet
+	bool find(const VerdictKey &key, int &verdict);
+	void store(const VerdictKey &key, int verdict);
+
+	CSync sync;
+	std::unordered_map<VerdictKey, int, VerdictKeyHash> verdicts;
+	volatile int limit;
+};
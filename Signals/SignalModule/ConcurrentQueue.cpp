@@ -20,4 +20,10 @@ bool ConcurrentQueue::IsEmpty()
 {
 	ScopedLock lock(mutex);
 	return queue.empty();
-}
\ No newline at end of file
+}
+
+void ConcurrentQueue::Clear()
+{
+	ScopedLock lock(mutex);
+	std::queue<std::string>().swap(queue);
+}
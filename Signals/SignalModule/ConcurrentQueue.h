@@ -33,6 +33,8 @@ public:
 	std::string Pop();
 	/// Queue is empty
 	bool IsEmpty();
+	/// Drop all messages
+	void Clear();
 ///Fields
 private:
 	/// Queue with messages
@@ -0,0 +1,28 @@
+#ifndef _MESSAGE_LANES_H_
+#define _MESSAGE_LANES_H_
+
+/// Priority lanes of inbound router messages, a lower lane is served first
+enum MessageLane
+{
+	/// Executions closing positions
+	LaneClose = 0,
+	/// Executions opening positions and everything else
+	LaneOpen,
+	/// Orders status requests
+	LaneStatus,
+	LaneCount
+};
+
+/// Counters of one lane, times in microseconds
+struct LaneStats
+{
+	unsigned long long depth;
+	unsigned long long maxDepth;
+	unsigned long long handled;
+	unsigned long long waitTotal;
+	unsigned long long waitMax;
+
+	LaneStats() : depth(0), maxDepth(0), handled(0), waitTotal(0), waitMax(0) {}
+};
+
+#endif //_MESSAGE_LANES_H_
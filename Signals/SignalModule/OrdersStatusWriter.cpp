@@ -0,0 +1,104 @@
+#include "OrdersStatusWriter.h"
+#include <string.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/wire_format_lite_inl.h>
+
+using google::protobuf::uint8;
+using google::protobuf::uint32;
+using google::protobuf::io::CodedOutputStream;
+using google::protobuf::internal::WireFormatLite;
+
+/// Field numbers of SignalOrdersStatus.proto
+#define RESPONSE_ACCOUNTS_FIELD 1
+#define ACCOUNT_LOGIN_FIELD     1
+#define ACCOUNT_ORDERS_FIELD    2
+#define ORDER_ID_FIELD          1
+#define ORDER_SIDE_FIELD        2
+#define ORDER_DATETIME_FIELD    4
+#define ORDER_VOLUME_FIELD      7
+#define ORDER_SYMBOL_FIELD      8
+#define ORDER_STOPLOSS_FIELD    9
+#define ORDER_TAKEPROFIT_FIELD  10
+#define ORDER_COMMENT_FIELD     11
+/// Room left for the length of an account, the longest varint of 32 bits
+#define ACCOUNT_LENGTH_SIZE     5
+
+OrdersStatusWriter::OrdersStatusWriter() :
+	accountStart(0)
+{
+}
+
+void OrdersStatusWriter::Clear()
+{
+	buffer.clear();
+	accountStart = 0;
+}
+
+void OrdersStatusWriter::BeginAccount(int login)
+{
+	size_t start = buffer.size();
+	buffer.resize(start + 1 + ACCOUNT_LENGTH_SIZE + 1 + 10);
+	uint8 *target = (uint8*)&buffer[start];
+	target = WireFormatLite::WriteTagToArray(RESPONSE_ACCOUNTS_FIELD, WireFormatLite::WIRETYPE_LENGTH_DELIMITED, target);
+	accountStart = target - (uint8*)buffer.data();
+	target += ACCOUNT_LENGTH_SIZE;
+	target = WireFormatLite::WriteInt32ToArray(ACCOUNT_LOGIN_FIELD, login, target);
+	buffer.resize(target - (uint8*)buffer.data());
+}
+
+void OrdersStatusWriter::AddOrder(int orderId, TradeSide side, long long dateTime, double volume,
+	const char *symbol, double stopLoss, double takeProfit, const char *comment)
+{
+	uint32 symbolSize = (uint32)strlen(symbol);
+	uint32 commentSize = (uint32)strlen(comment);
+	//--- every tag of OrderStatus takes one byte
+	int size = 1 + WireFormatLite::Int32Size(orderId)
+		+ 1 + WireFormatLite::EnumSize(side)
+		+ 1 + WireFormatLite::Int64Size(dateTime)
+		+ 1 + WireFormatLite::kDoubleSize
+		+ 1 + CodedOutputStream::VarintSize32(symbolSize) + symbolSize
+		+ (stopLoss != 0.0 ? 1 + WireFormatLite::kDoubleSize : 0)
+		+ (takeProfit != 0.0 ? 1 + WireFormatLite::kDoubleSize : 0)
+		+ 1 + CodedOutputStream::VarintSize32(commentSize) + commentSize;
+
+	size_t start = buffer.size();
+	buffer.resize(start + 1 + CodedOutputStream::VarintSize32(size) + size);
+	uint8 *target = (uint8*)&buffer[start];
+	target = WireFormatLite::WriteTagToArray(ACCOUNT_ORDERS_FIELD, WireFormatLite::WIRETYPE_LENGTH_DELIMITED, target);
+	target = CodedOutputStream::WriteVarint32ToArray(size, target);
+	target = WireFormatLite::WriteInt32ToArray(ORDER_ID_FIELD, orderId, target);
+	target = WireFormatLite::WriteEnumToArray(ORDER_SIDE_FIELD, side, target);
+	target = WireFormatLite::WriteInt64ToArray(ORDER_DATETIME_FIELD, dateTime, target);
+	target = WireFormatLite::WriteDoubleToArray(ORDER_VOLUME_FIELD, volume, target);
+	target = WireFormatLite::WriteTagToArray(ORDER_SYMBOL_FIELD, WireFormatLite::WIRETYPE_LENGTH_DELIMITED, target);
+	target = CodedOutputStream::WriteVarint32ToArray(symbolSize, target);
+	target = CodedOutputStream::WriteRawToArray(symbol, symbolSize, target);
+	if(stopLoss != 0.0)
+		target = WireFormatLite::WriteDoubleToArray(ORDER_STOPLOSS_FIELD, stopLoss, target);
+	if(takeProfit != 0.0)
+		target = WireFormatLite::WriteDoubleToArray(ORDER_TAKEPROFIT_FIELD, takeProfit, target);
+	target = WireFormatLite::WriteTagToArray(ORDER_COMMENT_FIELD, WireFormatLite::WIRETYPE_LENGTH_DELIMITED, target);
+	target = CodedOutputStream::WriteVarint32ToArray(commentSize, target);
+	CodedOutputStream::WriteRawToArray(comment, commentSize, target);
+}
+
+void OrdersStatusWriter::EndAccount()
+{
+	//--- the length is written in as few bytes as it needs, the account moves up to it
+	size_t body = accountStart + ACCOUNT_LENGTH_SIZE;
+	uint32 length = (uint32)(buffer.size() - body);
+	uint8 *target = (uint8*)&buffer[accountStart];
+	uint8 *end = CodedOutputStream::WriteVarint32ToArray(length, target);
+	size_t lengthSize = end - target;
+	if(lengthSize < ACCOUNT_LENGTH_SIZE)
+	{
+		memmove(end, target + ACCOUNT_LENGTH_SIZE, length);
+		buffer.resize(buffer.size() - (ACCOUNT_LENGTH_SIZE - lengthSize));
+	}
+}
+
+void OrdersStatusWriter::AddAccount(const char *entry, size_t size)
+{
+	buffer.append(entry, size);
+}
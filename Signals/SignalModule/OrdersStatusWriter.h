@@ -0,0 +1,47 @@
+#ifndef _ORDERS_STATUS_WRITER_H_
+#define _ORDERS_STATUS_WRITER_H_
+
+#include <string>
+#include "ProtocolStructs.h"
+
+/// Serialized OrdersStatusResponse written field by field into a buffer which is reused between responses:
+/// no status structures and no proto objects in between. The bytes are those OrdersStatusResponseToProto
+/// and SerializeAsString give for the same orders
+class OrdersStatusWriter
+{
+/// Construction / destruction
+public:
+	OrdersStatusWriter();
+
+/// Public methods
+public:
+	/// Start a new response, the buffer keeps its capacity
+	void Clear();
+
+	/// Open the entry of the account, its orders follow
+	void BeginAccount(int login);
+
+	/// Add an order to the open account, zero stops are left out like in OrdersStatusResponseToProto
+	void AddOrder(int orderId, TradeSide side, long long dateTime, double volume,
+		const char *symbol, double stopLoss, double takeProfit, const char *comment);
+
+	/// Close the entry of the account, its length goes in front of it
+	void EndAccount();
+
+	/// Add an account entry written from BeginAccount to EndAccount of another response
+	void AddAccount(const char *entry, size_t size);
+
+	/// Bytes written so far, an account entry spans the sizes before BeginAccount and after EndAccount
+	size_t Size() const { return buffer.size(); }
+
+	/// Serialized response
+	const std::string& Content() const { return buffer; }
+
+///Private fields
+private:
+	std::string buffer;
+	/// Offset of the length of the open account
+	size_t accountStart;
+};
+
+#endif //_ORDERS_STATUS_WRITER_H_
@@ -0,0 +1,707 @@
+#include "Platform.h"
+
+#ifdef _WIN32
+#include <mmsystem.h>
+#else
+#include <dlfcn.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+#endif
+
+#ifndef _WIN32
+/// Absolute CLOCK_MONOTONIC deadline after timeout milliseconds
+static timespec Deadline(DWORD timeout)
+{
+	timespec deadline;
+	clock_gettime(CLOCK_MONOTONIC, &deadline);
+	deadline.tv_sec += timeout / 1000;
+	deadline.tv_nsec += (long)(timeout % 1000) * 1000000;
+	if(deadline.tv_nsec >= 1000000000)
+	{
+		deadline.tv_sec++;
+		deadline.tv_nsec -= 1000000000;
+	}
+	return deadline;
+}
+#endif
+
+//--- mutex
+
+PlatformMutex::PlatformMutex()
+{
+#ifdef _WIN32
+	InitializeCriticalSection(&section);
+#else
+	pthread_mutexattr_t attr;
+	pthread_mutexattr_init(&attr);
+	pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+	pthread_mutex_init(&mutex, &attr);
+	pthread_mutexattr_destroy(&attr);
+#endif
+}
+
+PlatformMutex::~PlatformMutex()
+{
+#ifdef _WIN32
+	DeleteCriticalSection(&section);
+#else
+	pthread_mutex_destroy(&mutex);
+#endif
+}
+
+void PlatformMutex::Lock()
+{
+#ifdef _WIN32
+	EnterCriticalSection(&section);
+#else
+	pthread_mutex_lock(&mutex);
+#endif
+}
+
+bool PlatformMutex::TryLock()
+{
+#ifdef _WIN32
+	return TryEnterCriticalSection(&section) != FALSE;
+#else
+	return pthread_mutex_trylock(&mutex) == 0;
+#endif
+}
+
+void PlatformMutex::Unlock()
+{
+#ifdef _WIN32
+	LeaveCriticalSection(&section);
+#else
+	pthread_mutex_unlock(&mutex);
+#endif
+}
+
+//--- condition
+
+PlatformCondition::PlatformCondition()
+{
+#ifdef _WIN32
+	InitializeConditionVariable(&condition);
+#else
+	pthread_condattr_t attr;
+	pthread_condattr_init(&attr);
+	pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+	pthread_cond_init(&condition, &attr);
+	pthread_condattr_destroy(&attr);
+#endif
+}
+
+PlatformCondition::~PlatformCondition()
+{
+#ifndef _WIN32
+	pthread_cond_destroy(&condition);
+#endif
+}
+
+bool PlatformCondition::Wait(PlatformMutex &mutex, DWORD timeout)
+{
+#ifdef _WIN32
+	return SleepConditionVariableCS(&condition, &mutex.section, timeout) != FALSE;
+#else
+	if(timeout == INFINITE)
+		return pthread_cond_wait(&condition, &mutex.mutex) == 0;
+	timespec deadline = Deadline(timeout);
+	return pthread_cond_timedwait(&condition, &mutex.mutex, &deadline) != ETIMEDOUT;
+#endif
+}
+
+void PlatformCondition::NotifyOne()
+{
+#ifdef _WIN32
+	WakeConditionVariable(&condition);
+#else
+	pthread_cond_signal(&condition);
+#endif
+}
+
+void PlatformCondition::NotifyAll()
+{
+#ifdef _WIN32
+	WakeAllConditionVariable(&condition);
+#else
+	pthread_cond_broadcast(&condition);
+#endif
+}
+
+//--- event
+
+#ifdef _WIN32
+PlatformEvent::PlatformEvent()
+{
+	handle = CreateEvent(NULL, FALSE, FALSE, NULL);
+}
+
+PlatformEvent::~PlatformEvent()
+{
+	if(handle != NULL)
+		CloseHandle(handle);
+}
+
+void PlatformEvent::Set()
+{
+	SetEvent(handle);
+}
+
+bool PlatformEvent::Wait(DWORD timeout)
+{
+	return WaitForSingleObject(handle, timeout) == WAIT_OBJECT_0;
+}
+#else
+PlatformEvent::PlatformEvent() :
+	signaled(false)
+{
+}
+
+PlatformEvent::~PlatformEvent()
+{
+}
+
+void PlatformEvent::Set()
+{
+	mutex.Lock();
+	signaled = true;
+	mutex.Unlock();
+	condition.NotifyOne();
+}
+
+bool PlatformEvent::Wait(DWORD timeout)
+{
+	mutex.Lock();
+	if(timeout == INFINITE)
+	{
+		while(!signaled)
+			condition.Wait(mutex, INFINITE);
+	}
+	else
+	{
+		unsigned long long deadline = PlatformMicroseconds() + (unsigned long long)timeout * 1000;
+		while(!signaled)
+		{
+			unsigned long long now = PlatformMicroseconds();
+			if(now >= deadline || !condition.Wait(mutex, (DWORD)((deadline - now + 999) / 1000)))
+				break;
+		}
+	}
+	bool result = signaled;
+	signaled = false;
+	mutex.Unlock();
+	return result;
+}
+#endif
+
+//--- thread
+
+PlatformThread::PlatformThread() :
+	started(false)
+{
+#ifdef _WIN32
+	handle = NULL;
+#endif
+}
+
+PlatformThread::~PlatformThread()
+{
+	if(!started)
+		return;
+#ifdef _WIN32
+	CloseHandle(handle);
+#else
+	pthread_detach(thread);
+#endif
+}
+
+#ifndef _WIN32
+struct PlatformThreadStart
+{
+	PlatformThread::Routine routine;
+	LPVOID param;
+};
+
+static void* PlatformThreadMain(void *param)
+{
+	PlatformThreadStart start = *(PlatformThreadStart*)param;
+	delete (PlatformThreadStart*)param;
+	start.routine(start.param);
+	return NULL;
+}
+#endif
+
+bool PlatformThread::Start(Routine routine, LPVOID param)
+{
+	if(started)
+		return false;
+#ifdef _WIN32
+	DWORD id;
+	handle = CreateThread(NULL, 0, routine, param, 0, &id);
+	started = handle != NULL;
+#else
+	PlatformThreadStart *start = new PlatformThreadStart();
+	start->routine = routine;
+	start->param = param;
+	started = pthread_create(&thread, NULL, PlatformThreadMain, start) == 0;
+	if(!started)
+		delete start;
+#endif
+	return started;
+}
+
+bool PlatformThread::Join(DWORD timeout)
+{
+	if(!started)
+		return true;
+#ifdef _WIN32
+	if(WaitForSingleObject(handle, timeout) != WAIT_OBJECT_0)
+		return false;
+	CloseHandle(handle);
+	handle = NULL;
+#else
+	if(timeout == INFINITE)
+	{
+		if(pthread_join(thread, NULL) != 0)
+			return false;
+	}
+	else
+	{
+		//--- pthread_timedjoin_np takes CLOCK_REALTIME
+		timespec deadline;
+		clock_gettime(CLOCK_REALTIME, &deadline);
+		deadline.tv_sec += timeout / 1000;
+		deadline.tv_nsec += (long)(timeout % 1000) * 1000000;
+		if(deadline.tv_nsec >= 1000000000)
+		{
+			deadline.tv_sec++;
+			deadline.tv_nsec -= 1000000000;
+		}
+		if(pthread_timedjoin_np(thread, NULL, &deadline) != 0)
+			return false;
+	}
+#endif
+	started = false;
+	return true;
+}
+
+bool PlatformThread::Run(Routine routine, LPVOID param)
+{
+	PlatformThread thread;
+	return thread.Start(routine, param);
+}
+
+//--- library
+
+PlatformLibrary::PlatformLibrary() :
+	module(NULL)
+{
+}
+
+PlatformLibrary::~PlatformLibrary()
+{
+	Free();
+}
+
+bool PlatformLibrary::Load(const char *path)
+{
+	Free();
+#ifdef _WIN32
+	module = LoadLibraryA(path);
+#else
+	module = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+#endif
+	return module != NULL;
+}
+
+void* PlatformLibrary::Symbol(const char *name)
+{
+	if(module == NULL)
+		return NULL;
+#ifdef _WIN32
+	return (void*)GetProcAddress((HMODULE)module, name);
+#else
+	return dlsym(module, name);
+#endif
+}
+
+void PlatformLibrary::Free()
+{
+	if(module == NULL)
+		return;
+#ifdef _WIN32
+	FreeLibrary((HMODULE)module);
+#else
+	dlclose(module);
+#endif
+	module = NULL;
+}
+
+//--- mapped file
+
+PlatformMappedFile::PlatformMappedFile() :
+	data(NULL), size(0)
+{
+#ifdef _WIN32
+	file = INVALID_HANDLE_VALUE;
+	mapping = NULL;
+#else
+	file = -1;
+#endif
+}
+
+PlatformMappedFile::~PlatformMappedFile()
+{
+	Close();
+}
+
+bool PlatformMappedFile::Open(const char *path, size_t size)
+{
+	Close();
+#ifdef _WIN32
+	file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	if(file == INVALID_HANDLE_VALUE)
+		return false;
+	LARGE_INTEGER current;
+	if(!GetFileSizeEx(file, &current))
+	{
+		Close();
+		return false;
+	}
+	//--- an existing file keeps its size, mapping a part of it would cut records off
+	if((unsigned long long)current.QuadPart > size)
+		size = (size_t)current.QuadPart;
+	LARGE_INTEGER length;
+	length.QuadPart = (LONGLONG)size;
+	mapping = CreateFileMappingA(file, NULL, PAGE_READWRITE, length.HighPart, length.LowPart, NULL);
+	if(mapping == NULL)
+	{
+		Close();
+		return false;
+	}
+	data = (char*)MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+#else
+	file = open(path, O_RDWR | O_CREAT, 0644);
+	if(file < 0)
+		return false;
+	struct stat info;
+	if(fstat(file, &info) != 0)
+	{
+		Close();
+		return false;
+	}
+	if((unsigned long long)info.st_size > size)
+		size = (size_t)info.st_size;
+	else if((size_t)info.st_size < size && ftruncate(file, (off_t)size) != 0)
+	{
+		Close();
+		return false;
+	}
+	void *view = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+	data = view == MAP_FAILED ? NULL : (char*)view;
+#endif
+	if(data == NULL)
+	{
+		Close();
+		return false;
+	}
+	this->size = size;
+	return true;
+}
+
+bool PlatformMappedFile::Flush(size_t offset, size_t length)
+{
+	if(data == NULL || offset >= size)
+		return false;
+	if(length > size - offset)
+		length = size - offset;
+#ifdef _WIN32
+	return FlushViewOfFile(data + offset, length) != FALSE && FlushFileBuffers(file) != FALSE;
+#else
+	//--- msync wants a page aligned start
+	size_t page = (size_t)sysconf(_SC_PAGESIZE);
+	size_t start = offset / page * page;
+	return msync(data + start, length + offset - start, MS_SYNC) == 0;
+#endif
+}
+
+void PlatformMappedFile::Close()
+{
+#ifdef _WIN32
+	if(data != NULL)
+		UnmapViewOfFile(data);
+	if(mapping != NULL)
+		CloseHandle(mapping);
+	if(file != INVALID_HANDLE_VALUE)
+		CloseHandle(file);
+	mapping = NULL;
+	file = INVALID_HANDLE_VALUE;
+#else
+	if(data != NULL)
+		munmap(data, size);
+	if(file >= 0)
+		close(file);
+	file = -1;
+#endif
+	data = NULL;
+	size = 0;
+}
+
+//--- shared memory
+
+PlatformSharedMemory::PlatformSharedMemory() :
+	data(NULL), size(0), created(false)
+{
+#ifdef _WIN32
+	mapping = NULL;
+#else
+	file = -1;
+#endif
+}
+
+PlatformSharedMemory::~PlatformSharedMemory()
+{
+	Close();
+}
+
+bool PlatformSharedMemory::Open(const char *name, size_t size)
+{
+	Close();
+	char path[256];
+#ifdef _WIN32
+	_snprintf_s(path, sizeof(path), _TRUNCATE, "Local\\%s", name);
+	LARGE_INTEGER length;
+	length.QuadPart = (LONGLONG)size;
+	mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, length.HighPart, length.LowPart, path);
+	if(mapping == NULL)
+		return false;
+	created = GetLastError() != ERROR_ALREADY_EXISTS;
+	data = (char*)MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+#else
+	snprintf(path, sizeof(path), "/%s", name);
+	file = shm_open(path, O_RDWR | O_CREAT | O_EXCL, 0600);
+	created = file >= 0;
+	if(!created)
+		file = shm_open(path, O_RDWR, 0600);
+	if(file < 0)
+		return false;
+	struct stat info;
+	//--- the creator may not have sized it yet
+	if((created && ftruncate(file, (off_t)size) != 0) || fstat(file, &info) != 0 || (size_t)info.st_size < size)
+	{
+		Close();
+		return false;
+	}
+	void *view = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+	data = view == MAP_FAILED ? NULL : (char*)view;
+#endif
+	if(data == NULL)
+	{
+		Close();
+		return false;
+	}
+	this->size = size;
+	return true;
+}
+
+void PlatformSharedMemory::Close()
+{
+#ifdef _WIN32
+	if(data != NULL)
+		UnmapViewOfFile(data);
+	if(mapping != NULL)
+		CloseHandle(mapping);
+	mapping = NULL;
+#else
+	if(data != NULL)
+		munmap(data, size);
+	if(file >= 0)
+		close(file);
+	file = -1;
+#endif
+	data = NULL;
+	size = 0;
+	created = false;
+}
+
+void PlatformSharedMemory::Remove(const char *name)
+{
+#ifndef _WIN32
+	char path[256];
+	snprintf(path, sizeof(path), "/%s", name);
+	shm_unlink(path);
+#endif
+}
+
+//--- shared event
+
+PlatformSharedEvent::PlatformSharedEvent()
+{
+#ifdef _WIN32
+	handle = NULL;
+#else
+	word = NULL;
+#endif
+}
+
+PlatformSharedEvent::~PlatformSharedEvent()
+{
+	Close();
+}
+
+bool PlatformSharedEvent::Open(const char *name, volatile unsigned int *word)
+{
+	Close();
+#ifdef _WIN32
+	char path[256];
+	_snprintf_s(path, sizeof(path), _TRUNCATE, "Local\\%s", name);
+	handle = CreateEventA(NULL, FALSE, FALSE, path);
+	(void)word;
+	return handle != NULL;
+#else
+	//--- the futex word is shared already, it needs no name
+	(void)name;
+	this->word = word;
+	return word != NULL;
+#endif
+}
+
+void PlatformSharedEvent::Close()
+{
+#ifdef _WIN32
+	if(handle != NULL)
+		CloseHandle(handle);
+	handle = NULL;
+#else
+	word = NULL;
+#endif
+}
+
+void PlatformSharedEvent::Set()
+{
+#ifdef _WIN32
+	if(handle != NULL)
+		SetEvent(handle);
+#else
+	//--- the word is 1 while the event is set, a waiter sleeps on 0
+	if(word != NULL && __atomic_exchange_n(word, 1, __ATOMIC_SEQ_CST) == 0)
+	{
+#ifdef __linux__
+		syscall(SYS_futex, word, FUTEX_WAKE, 1, NULL, NULL, 0);
+#endif
+	}
+#endif
+}
+
+bool PlatformSharedEvent::Wait(DWORD timeout)
+{
+#ifdef _WIN32
+	return handle != NULL && WaitForSingleObject(handle, timeout) == WAIT_OBJECT_0;
+#else
+	if(word == NULL)
+		return false;
+	if(__atomic_exchange_n(word, 0, __ATOMIC_SEQ_CST) == 1)
+		return true;
+#ifdef __linux__
+	timespec interval;
+	interval.tv_sec = timeout / 1000;
+	interval.tv_nsec = (long)(timeout % 1000) * 1000000;
+	syscall(SYS_futex, word, FUTEX_WAIT, 0, timeout == INFINITE ? NULL : &interval, NULL, 0);
+#else
+	PlatformSleep(1);
+#endif
+	return __atomic_exchange_n(word, 0, __ATOMIC_SEQ_CST) == 1;
+#endif
+}
+
+//--- clocks
+
+void PlatformSleep(DWORD ms)
+{
+#ifdef _WIN32
+	Sleep(ms);
+#else
+	if(ms == 0)
+	{
+		sched_yield();
+		return;
+	}
+	timespec interval;
+	interval.tv_sec = ms / 1000;
+	interval.tv_nsec = (long)(ms % 1000) * 1000000;
+	while(nanosleep(&interval, &interval) != 0 && errno == EINTR);
+#endif
+}
+
+void PlatformYield()
+{
+#ifdef _WIN32
+	SwitchToThread();
+#else
+	sched_yield();
+#endif
+}
+
+DWORD PlatformTickCount()
+{
+#ifdef _WIN32
+	return GetTickCount();
+#else
+	return (DWORD)(PlatformMicroseconds() / 1000);
+#endif
+}
+
+unsigned long long PlatformMicroseconds()
+{
+#ifdef _WIN32
+	static LARGE_INTEGER frequency = { 0 };
+	if(frequency.QuadPart == 0)
+		QueryPerformanceFrequency(&frequency);
+	LARGE_INTEGER counter;
+	QueryPerformanceCounter(&counter);
+	return (unsigned long long)(counter.QuadPart / frequency.QuadPart) * 1000000 +
+		(unsigned long long)(counter.QuadPart % frequency.QuadPart) * 1000000 / frequency.QuadPart;
+#else
+	timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (unsigned long long)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+#endif
+}
+
+unsigned long long PlatformCpuMicroseconds()
+{
+#ifdef _WIN32
+	FILETIME creation, exit, kernel, user;
+	if(!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user))
+		return 0;
+	//--- 100 ns units
+	return ((unsigned long long)kernel.dwHighDateTime << 32 | kernel.dwLowDateTime) / 10 +
+		((unsigned long long)user.dwHighDateTime << 32 | user.dwLowDateTime) / 10;
+#else
+	timespec now;
+	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &now);
+	return (unsigned long long)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+#endif
+}
+
+void PlatformHighResolutionTimer(bool enable)
+{
+	//--- Linux sleeps are precise already
+#ifdef _WIN32
+	if(enable)
+		timeBeginPeriod(1);
+	else
+		timeEndPeriod(1);
+#else
+	(void)enable;
+#endif
+}
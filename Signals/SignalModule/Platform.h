@@ -0,0 +1,297 @@
+#ifndef _PLATFORM_H_
+#define _PLATFORM_H_
+
+#ifdef _WIN32
+
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+
+#else
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/// Win32 names used by the plugin sources and the MT4 server API
+typedef int                BOOL;
+typedef unsigned char      UCHAR;
+typedef unsigned char      BYTE;
+typedef unsigned short     WORD;
+typedef unsigned int       UINT;
+typedef int32_t            LONG;
+typedef uint32_t           DWORD;
+typedef long long          __int64;
+typedef void*              HANDLE;
+typedef void*              HMODULE;
+typedef void*              LPVOID;
+typedef const char*        LPCSTR;
+typedef const char*        LPCTSTR;
+
+const BOOL   TRUE      = 1;
+const BOOL   FALSE     = 0;
+const DWORD  INFINITE  = 0xFFFFFFFF;
+const size_t _TRUNCATE = (size_t)-1;
+
+inline int sprintf_s(char *buffer, size_t size, const char *format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	int written = vsnprintf(buffer, size, format, args);
+	va_end(args);
+	return written;
+}
+
+/// Callers pass _TRUNCATE as the count, the output is cut at the buffer size
+inline int _snprintf_s(char *buffer, size_t size, size_t, const char *format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	int written = vsnprintf(buffer, size, format, args);
+	va_end(args);
+	return written;
+}
+
+inline void ZeroMemory(void *ptr, size_t size)
+{
+	memset(ptr, 0, size);
+}
+
+inline int fopen_s(FILE **file, const char *name, const char *mode)
+{
+	*file = fopen(name, mode);
+	return *file != NULL ? 0 : errno;
+}
+
+#endif
+
+/// Calling convention of thread routines
+#ifdef _WIN32
+#define PLATFORM_THREAD_CALL WINAPI
+#else
+#define PLATFORM_THREAD_CALL
+#endif
+
+/// Recursive lock, a critical section on Windows
+class PlatformMutex
+{
+public:
+	PlatformMutex();
+	~PlatformMutex();
+
+	void Lock();
+	bool TryLock();
+	void Unlock();
+
+private:
+	PlatformMutex(const PlatformMutex&);
+	PlatformMutex& operator=(const PlatformMutex&);
+
+	friend class PlatformCondition;
+#ifdef _WIN32
+	CRITICAL_SECTION section;
+#else
+	pthread_mutex_t mutex;
+#endif
+};
+
+/// Condition variable waited with a locked PlatformMutex
+class PlatformCondition
+{
+public:
+	PlatformCondition();
+	~PlatformCondition();
+
+	/// Returns false on timeout, milliseconds or INFINITE
+	bool Wait(PlatformMutex &mutex, DWORD timeout);
+	void NotifyOne();
+	void NotifyAll();
+
+private:
+	PlatformCondition(const PlatformCondition&);
+	PlatformCondition& operator=(const PlatformCondition&);
+
+#ifdef _WIN32
+	CONDITION_VARIABLE condition;
+#else
+	pthread_cond_t condition;
+#endif
+};
+
+/// Auto-reset event: Set wakes one waiter, or the next one if nobody waits
+class PlatformEvent
+{
+public:
+	PlatformEvent();
+	~PlatformEvent();
+
+	void Set();
+	/// Returns false on timeout, milliseconds or INFINITE
+	bool Wait(DWORD timeout);
+
+private:
+	PlatformEvent(const PlatformEvent&);
+	PlatformEvent& operator=(const PlatformEvent&);
+
+#ifdef _WIN32
+	HANDLE handle;
+#else
+	PlatformMutex mutex;
+	PlatformCondition condition;
+	bool signaled;
+#endif
+};
+
+/// Native thread
+class PlatformThread
+{
+public:
+	typedef DWORD (PLATFORM_THREAD_CALL *Routine)(LPVOID param);
+
+	PlatformThread();
+	/// Detaches a thread still running
+	~PlatformThread();
+
+	bool Start(Routine routine, LPVOID param);
+	/// Wait for the thread, false when it is still running after timeout milliseconds
+	bool Join(DWORD timeout);
+	bool IsStarted() const { return started; }
+
+	/// Fire-and-forget thread
+	static bool Run(Routine routine, LPVOID param);
+
+private:
+	PlatformThread(const PlatformThread&);
+	PlatformThread& operator=(const PlatformThread&);
+
+#ifdef _WIN32
+	HANDLE handle;
+#else
+	pthread_t thread;
+#endif
+	bool started;
+};
+
+/// Dynamic library
+class PlatformLibrary
+{
+public:
+	PlatformLibrary();
+	~PlatformLibrary();
+
+	bool  Load(const char *path);
+	void* Symbol(const char *name);
+	void  Free();
+	bool  IsLoaded() const { return module != NULL; }
+
+private:
+	PlatformLibrary(const PlatformLibrary&);
+	PlatformLibrary& operator=(const PlatformLibrary&);
+
+	void *module;
+};
+
+/// Read-write shared file mapping, grown to the requested size on open
+class PlatformMappedFile
+{
+public:
+	PlatformMappedFile();
+	~PlatformMappedFile();
+
+	bool   Open(const char *path, size_t size);
+	/// Write the range through to disk, returns when it is durable
+	bool   Flush(size_t offset, size_t length);
+	void   Close();
+	bool   IsOpen() const { return data != NULL; }
+	char*  Data() const { return data; }
+	size_t Size() const { return size; }
+
+private:
+	PlatformMappedFile(const PlatformMappedFile&);
+	PlatformMappedFile& operator=(const PlatformMappedFile&);
+
+#ifdef _WIN32
+	HANDLE file;
+	HANDLE mapping;
+#else
+	int    file;
+#endif
+	char  *data;
+	size_t size;
+};
+
+/// Named shared memory, the first process opening the name creates it zeroed
+class PlatformSharedMemory
+{
+public:
+	PlatformSharedMemory();
+	~PlatformSharedMemory();
+
+	bool   Open(const char *name, size_t size);
+	/// Unmap, the memory lives on while another process maps it
+	void   Close();
+	bool   IsOpen() const { return data != NULL; }
+	/// This process created the memory
+	bool   Created() const { return created; }
+	char*  Data() const { return data; }
+	size_t Size() const { return size; }
+
+	/// Remove the name once no process needs it (POSIX), later opens create new memory
+	static void Remove(const char *name);
+
+private:
+	PlatformSharedMemory(const PlatformSharedMemory&);
+	PlatformSharedMemory& operator=(const PlatformSharedMemory&);
+
+#ifdef _WIN32
+	HANDLE mapping;
+#else
+	int    file;
+#endif
+	char  *data;
+	size_t size;
+	bool   created;
+};
+
+/// Auto-reset event of two processes: a named event on Windows, a futex on a zeroed word of shared memory elsewhere
+class PlatformSharedEvent
+{
+public:
+	PlatformSharedEvent();
+	~PlatformSharedEvent();
+
+	bool Open(const char *name, volatile unsigned int *word);
+	void Close();
+	void Set();
+	/// Returns false on timeout, milliseconds or INFINITE
+	bool Wait(DWORD timeout);
+
+private:
+	PlatformSharedEvent(const PlatformSharedEvent&);
+	PlatformSharedEvent& operator=(const PlatformSharedEvent&);
+
+#ifdef _WIN32
+	HANDLE handle;
+#else
+	volatile unsigned int *word;
+#endif
+};
+
+/// Sleep milliseconds, 0 gives up the time slice
+void PlatformSleep(DWORD ms);
+/// Give up the time slice
+void PlatformYield();
+/// Monotonic milliseconds, wraps like GetTickCount
+DWORD PlatformTickCount();
+/// Monotonic microseconds
+unsigned long long PlatformMicroseconds();
+/// CPU time of all threads of the process, microseconds
+unsigned long long PlatformCpuMicroseconds();
+/// Ask for 1 ms timer resolution while precise sleeps are needed, calls are counted
+void PlatformHighResolutionTimer(bool enable);
+
+#endif //_PLATFORM_H_
@@ -0,0 +1,318 @@
+#include "PositionsBoard.h"
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+
+#define BOARD_MAGIC   0x44524250 // "PBRD"
+#define BOARD_VERSION 1
+/// Slots start after the header
+#define BOARD_DATA    128
+#define BOARD_ALIGN   64
+
+/// Board header at offset 0
+struct PositionsBoard::Header
+{
+	std::atomic<unsigned int>       magic;
+	unsigned int                    version;
+	unsigned int                    logins;
+	unsigned int                    positions;
+	char                            padding[48];
+	/// Written by the writer only
+	std::atomic<unsigned long long> generation;
+	std::atomic<unsigned int>       rejected;
+	char                            generationPadding[52];
+};
+
+/// Slot of a login, a free slot has login 0. The login never changes once the slot is taken
+struct PositionsBoard::Slot
+{
+	/// Odd while the writer changes the slot
+	std::atomic<unsigned int> sequence;
+	std::atomic<int>          login;
+	/// Fields below are read under the sequence only
+	int                       count;
+	/// Positions are loaded, a reader does not see the login before
+	char                      ready;
+	char                      overflown;
+	char                      padding[2];
+	BoardPosition             positions[1];
+};
+
+PositionsBoard::PositionsBoard() :
+	loading(false), logins(0), positions(0), slotSize(0)
+{
+}
+
+PositionsBoard::~PositionsBoard()
+{
+	Close();
+}
+
+bool PositionsBoard::Open(const std::string &name, int side, int logins, int positions)
+{
+	Close();
+	if(logins <= 0 || positions <= 0)
+		return false;
+	size_t slotSize = (sizeof(Slot) - sizeof(BoardPosition) + positions * sizeof(BoardPosition) + BOARD_ALIGN - 1) / BOARD_ALIGN * BOARD_ALIGN;
+	if(!memory.Open(name.c_str(), BOARD_DATA + logins * slotSize))
+		return false;
+
+	Header *header = GetHeader();
+	if(memory.Created())
+	{
+		//--- zeroed memory is a board of free slots, the magic publishes it
+		header->version = BOARD_VERSION;
+		header->logins = logins;
+		header->positions = positions;
+		header->magic.store(BOARD_MAGIC, std::memory_order_release);
+	}
+	else
+	{
+		//--- the creator is a moment away from writing the header
+		for(int i = 0; i < 1000 && header->magic.load(std::memory_order_acquire) != BOARD_MAGIC; i++)
+			PlatformSleep(1);
+		if(header->magic.load(std::memory_order_acquire) != BOARD_MAGIC || header->version != BOARD_VERSION ||
+			header->logins != (unsigned int)logins || header->positions != (unsigned int)positions)
+		{
+			std::cout << "Positions board " << name << " has another format" << std::endl;
+			Close();
+			return false;
+		}
+	}
+	this->logins = logins;
+	this->positions = positions;
+	this->slotSize = slotSize;
+
+	if(side == PositionsBoardWriter && !memory.Created())
+	{
+		//--- positions of a previous writer are stale, the logins keep their slots until they are loaded again
+		writeLock.Lock();
+		for(int i = 0; i < logins; i++)
+		{
+			Slot *slot = GetSlot(i);
+			if(slot->login.load(std::memory_order_relaxed) == 0)
+				continue;
+			BeginWrite(slot);
+			slot->ready = 0;
+			slot->count = 0;
+			slot->overflown = 0;
+			EndWrite(slot);
+		}
+		writeLock.Unlock();
+	}
+	return true;
+}
+
+void PositionsBoard::Close()
+{
+	writeLock.Lock();
+	memory.Close();
+	removed.clear();
+	pending.clear();
+	loading = false;
+	logins = positions = 0;
+	slotSize = 0;
+	writeLock.Unlock();
+}
+
+PositionsBoard::Slot* PositionsBoard::GetSlot(int index) const
+{
+	return (Slot*)(memory.Data() + BOARD_DATA + index * slotSize);
+}
+
+PositionsBoard::Slot* PositionsBoard::FindSlot(int login, bool claim) const
+{
+	if(login == 0 || logins == 0)
+		return NULL;
+	unsigned int index = ((unsigned int)login * 2654435761u) % (unsigned int)logins;
+	for(int i = 0; i < logins; i++)
+	{
+		Slot *slot = GetSlot(index);
+		int current = slot->login.load(std::memory_order_acquire);
+		if(current == login)
+			return slot;
+		if(current == 0)
+		{
+			if(!claim)
+				return NULL;
+			//--- a free slot is zeroed or cleared, readers find the login once it is stored
+			slot->login.store(login, std::memory_order_release);
+			return slot;
+		}
+		if(++index == (unsigned int)logins)
+			index = 0;
+	}
+	return NULL;
+}
+
+void PositionsBoard::BeginWrite(Slot *slot)
+{
+	slot->sequence.store(slot->sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	//--- the odd sequence is visible before any change of the slot
+	std::atomic_thread_fence(std::memory_order_release);
+}
+
+void PositionsBoard::EndWrite(Slot *slot)
+{
+	slot->sequence.store(slot->sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	GetHeader()->generation.fetch_add(1, std::memory_order_release);
+}
+
+int PositionsBoard::FindPosition(const Slot *slot, int order) const
+{
+	for(int i = 0; i < slot->count; i++)
+		if(slot->positions[i].order == order)
+			return i;
+	return -1;
+}
+
+void PositionsBoard::AddPosition(Slot *slot, const BoardPosition &position)
+{
+	if(slot->count < positions)
+		slot->positions[slot->count++] = position;
+	else
+		slot->overflown = 1;
+}
+
+void PositionsBoard::BeginLoad(const int *logins, int count)
+{
+	writeLock.Lock();
+	if(memory.IsOpen())
+	{
+		loading = true;
+		removed.clear();
+		for(int i = 0; i < count; i++)
+		{
+			Slot *slot = FindSlot(logins[i], true);
+			if(slot == NULL)
+			{
+				if(logins[i] != 0)
+					GetHeader()->rejected.fetch_add(1, std::memory_order_relaxed);
+			}
+			else if(!slot->ready)
+				pending.push_back(slot);
+		}
+	}
+	writeLock.Unlock();
+}
+
+void PositionsBoard::Load(int login, const BoardPosition &position)
+{
+	writeLock.Lock();
+	Slot *slot = memory.IsOpen() ? FindSlot(login, false) : NULL;
+	//--- a ready slot is kept up to date by the trade hooks already
+	if(slot != NULL && !slot->ready && FindPosition(slot, position.order) < 0 &&
+		std::find(removed.begin(), removed.end(), position.order) == removed.end())
+	{
+		BeginWrite(slot);
+		AddPosition(slot, position);
+		EndWrite(slot);
+	}
+	writeLock.Unlock();
+}
+
+void PositionsBoard::EndLoad()
+{
+	writeLock.Lock();
+	if(memory.IsOpen())
+	{
+		for(size_t i = 0; i < pending.size(); i++)
+		{
+			Slot *slot = pending[i];
+			if(slot->ready)
+				continue;
+			BeginWrite(slot);
+			slot->ready = 1;
+			EndWrite(slot);
+		}
+	}
+	loading = false;
+	removed.clear();
+	pending.clear();
+	writeLock.Unlock();
+}
+
+void PositionsBoard::Put(int login, const BoardPosition &position)
+{
+	writeLock.Lock();
+	Slot *slot = memory.IsOpen() ? FindSlot(login, false) : NULL;
+	if(slot != NULL)
+	{
+		BeginWrite(slot);
+		int index = FindPosition(slot, position.order);
+		if(index >= 0)
+			slot->positions[index] = position;
+		else
+			AddPosition(slot, position);
+		EndWrite(slot);
+	}
+	writeLock.Unlock();
+}
+
+void PositionsBoard::Erase(int login, int order)
+{
+	writeLock.Lock();
+	Slot *slot = memory.IsOpen() ? FindSlot(login, false) : NULL;
+	if(slot != NULL)
+	{
+		if(loading)
+			removed.push_back(order);
+		int index = FindPosition(slot, order);
+		if(index >= 0)
+		{
+			//--- the order of positions does not matter, the last one fills the hole
+			BeginWrite(slot);
+			slot->positions[index] = slot->positions[slot->count - 1];
+			slot->count--;
+			EndWrite(slot);
+		}
+	}
+	writeLock.Unlock();
+}
+
+bool PositionsBoard::Read(int login, std::vector<BoardPosition> &result, bool *overflown) const
+{
+	result.clear();
+	Slot *slot = memory.IsOpen() ? FindSlot(login, false) : NULL;
+	if(slot == NULL)
+		return false;
+	for(int attempt = 0; ; attempt++)
+	{
+		unsigned int begin = slot->sequence.load(std::memory_order_acquire);
+		if((begin & 1) == 0)
+		{
+			//--- the copy may be torn, it is used only when the sequence did not move
+			bool ready = slot->ready != 0;
+			bool full = slot->overflown != 0;
+			int count = (std::min)((std::max)(slot->count, 0), positions);
+			result.assign(slot->positions, slot->positions + count);
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if(slot->sequence.load(std::memory_order_relaxed) == begin)
+			{
+				if(overflown != NULL)
+					*overflown = full;
+				if(!ready)
+					result.clear();
+				return ready;
+			}
+		}
+		//--- the writer holds the slot for a few copies only
+		if(attempt >= 64)
+			PlatformYield();
+	}
+}
+
+unsigned long long PositionsBoard::Generation() const
+{
+	return memory.IsOpen() ? GetHeader()->generation.load(std::memory_order_acquire) : 0;
+}
+
+unsigned int PositionsBoard::Rejected() const
+{
+	return memory.IsOpen() ? GetHeader()->rejected.load(std::memory_order_relaxed) : 0;
+}
+
+void PositionsBoard::Remove(const std::string &name)
+{
+	PlatformSharedMemory::Remove(name.c_str());
+}
@@ -0,0 +1,108 @@
+#ifndef _POSITIONS_BOARD_H_
+#define _POSITIONS_BOARD_H_
+
+#include <string>
+#include <vector>
+#include "Platform.h"
+
+/// Side of a positions board
+enum PositionsBoardSide { PositionsBoardReader = 0, PositionsBoardWriter = 1 };
+
+/// Open position of a login on the board
+struct BoardPosition
+{
+	int       order;
+	/// 0 buy, 1 sell
+	int       cmd;
+	/// Hundredths of a lot, like the trade record
+	int       volume;
+	int       reserved;
+	long long openTime;
+	double    openPrice;
+	double    sl;
+	double    tp;
+	char      symbol[12];
+	char      comment[32];
+};
+
+/// Open positions of logins published in named shared memory for readers on the same host.
+/// Every login has a slot of a fixed number of positions guarded by a seqlock: the writer makes
+/// the sequence odd while it changes the slot, a reader copies the slot and retries when the
+/// sequence was odd or moved meanwhile. Readers never block the writer and make no system call.
+/// A login stays on the board once it is loaded, a slot holding more positions than fit is marked as overflown.
+class PositionsBoard
+{
+/// Construction / destruction
+public:
+	PositionsBoard();
+	~PositionsBoard();
+
+/// Public methods
+public:
+	/// Map the board of the name with slots for the logins, each of the positions. The writer clears
+	/// what a previous writer left, a reader waits for the writer to lay the board out
+	bool Open(const std::string &name, int side, int logins, int positions);
+
+	void Close();
+
+	bool IsOpen() const { return memory.IsOpen(); }
+
+	/// Slots and positions per slot of the open board
+	int Logins() const { return logins; }
+	int Positions() const { return positions; }
+
+	/// Writer: take slots for the logins, their positions are loaded next.
+	/// Erases made until EndLoad are remembered, so a load never brings a closed position back
+	void BeginLoad(const int *logins, int count);
+	/// Writer: add a loaded position unless the slot has it already
+	void Load(int login, const BoardPosition &position);
+	void EndLoad();
+
+	/// Writer: add or replace the position of a login on the board, other logins are ignored
+	void Put(int login, const BoardPosition &position);
+	/// Writer: remove the position of a login on the board
+	void Erase(int login, int order);
+
+	/// Reader: consistent copy of the positions of the login, false when the login is not on the board.
+	/// Overflown is set when the slot could not hold every position of the login
+	bool Read(int login, std::vector<BoardPosition> &result, bool *overflown = NULL) const;
+
+	/// Changes made to the board so far, a reader polls it to learn that something changed
+	unsigned long long Generation() const;
+
+	/// Logins which did not find a free slot
+	unsigned int Rejected() const;
+
+	/// Remove the shared memory name once both sides are done
+	static void Remove(const std::string &name);
+
+///Private methods
+private:
+	struct Header;
+	struct Slot;
+
+	Header* GetHeader() const { return (Header*)memory.Data(); }
+	Slot* GetSlot(int index) const;
+	/// Slot of the login, NULL when it is not on the board; claim takes a free slot for it
+	Slot* FindSlot(int login, bool claim) const;
+	void BeginWrite(Slot *slot);
+	void EndWrite(Slot *slot);
+	int FindPosition(const Slot *slot, int order) const;
+	void AddPosition(Slot *slot, const BoardPosition &position);
+
+/// Private fields
+private:
+	PlatformSharedMemory memory;
+	/// Hooks of several server threads write, the seqlock allows one writer at a time
+	PlatformMutex writeLock;
+	/// Orders erased while a load runs
+	std::vector<int> removed;
+	/// Slots taken by BeginLoad, ready on EndLoad
+	std::vector<Slot*> pending;
+	bool loading;
+	int logins;
+	int positions;
+	size_t slotSize;
+};
+
+#endif //_POSITIONS_BOARD_H_
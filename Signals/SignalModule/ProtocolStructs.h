@@ -20,8 +20,8 @@ struct MT4TradeSignal
 {
 public:
 	TradeSide Side;
-	ActionType ActionType;
-	__int64 DateTime;
+	::ActionType ActionType;
+	long long DateTime;
 	double Equity;
 	double Balance;
 	double Volume;
@@ -41,7 +41,7 @@ struct OrderStatus
 public:
 	int OrderID;
 	TradeSide Side;
-	__int64 DateTime;
+	long long DateTime;
 	double Volume;
 	std::string Symbol;
 	double StopLoss;
@@ -63,8 +63,8 @@ struct OrdersStatusResponse
 struct ExecutionOrder
 {
 	int Login;
-	ActionType ActionType;
-	TradeSide TradeSide;
+	::ActionType ActionType;
+	::TradeSide TradeSide;
 	double Volume;
 	std::string Symbol;
 	int OrderID;
@@ -73,8 +73,49 @@ struct ExecutionOrder
 
 struct ExecutionSignal
 {
+	ExecutionSignal() : Received(0) {}
+
 	std::string comment;
 	std::vector<ExecutionOrder> Orders;
+	/// Receive time of the signal, PlatformMicroseconds
+	unsigned long long Received;
+};
+
+enum ExecutionResult
+{
+	ResultUnknown = 0,
+	ResultExecuted = 1,
+	ResultRequestAdded = 2,
+	ResultDuplicate = 3,
+	ResultInvalidOrder = 4,
+	ResultInvalidVolume = 5,
+	ResultInvalidSymbol = 6,
+	ResultInvalidPrice = 7,
+	ResultInvalidStops = 8,
+	ResultNoMoney = 9,
+	ResultRejected = 10,
+	ResultServerError = 11
+};
+
+struct ExecutionOrderReport
+{
+	int Login;
+	::ActionType ActionType;
+	int OrderID;
+	ExecutionResult Result;
+	int Ticket;
+	double Price;
+	int RequestId;
+	/// Microseconds
+	long long QueueTime;
+	long long CheckTime;
+	long long ExecuteTime;
+};
+
+struct ExecutionSignalReport
+{
+	std::string Comment;
+	std::vector<ExecutionOrderReport> Orders;
 };
 
 #endif //_PROTOCOL_STRUCTS_H
\ No newline at end of file
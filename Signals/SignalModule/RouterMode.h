@@ -0,0 +1,29 @@
+#ifndef _ROUTER_MODE_H_
+#define _ROUTER_MODE_H_
+
+/// How signals are spread over the routers of the connection
+enum RouterMode
+{
+	/// Signals go to the active router, the next live one takes over once it misses heartbeats
+	RouterActiveStandby = 0,
+	/// Signals go to every router
+	RouterActiveActive = 1
+};
+
+/// Counters of the router connection
+struct RouterStats
+{
+	int routers;
+	int alive;
+	/// Router receiving the signals in active/standby mode, -1 in active/active mode
+	int active;
+	unsigned long long failovers;
+	/// Signals sent again to the router taking over
+	unsigned long long resent;
+	/// Requests dropped because another router delivered them already
+	unsigned long long duplicates;
+
+	RouterStats() : routers(0), alive(0), active(-1), failovers(0), resent(0), duplicates(0) {}
+};
+
+#endif //_ROUTER_MODE_H_
@@ -0,0 +1,93 @@
+#include "RouterTransport.h"
+#include "SharedMemoryChannel.h"
+#include <iostream>
+
+#define SHARED_MEMORY_SCHEME "shm://"
+
+/// DEALER socket connected over tcp or ipc
+class ZeroMqTransport : public RouterTransport
+{
+public:
+	ZeroMqTransport(zmq::context_t &context, const std::string &address, const std::string &identity) :
+		socket(context, ZMQ_DEALER)
+	{
+		socket.setsockopt(ZMQ_IDENTITY, identity.c_str(), identity.size());
+		int linger = 0;
+		socket.setsockopt(ZMQ_LINGER, &linger, sizeof(linger));
+		socket.connect(address.c_str());
+	}
+
+	virtual bool Send(const void *data, size_t size)
+	{
+		return socket.send(data, size, ZMQ_DONTWAIT) != 0;
+	}
+
+	virtual bool Receive(std::string &message)
+	{
+		zmq::message_t received;
+		if(!socket.recv(&received, ZMQ_DONTWAIT))
+			return false;
+		message.assign((char*)received.data(), received.size());
+		return true;
+	}
+
+	virtual bool GetPollItem(zmq::pollitem_t &item)
+	{
+		item.socket = (void*)socket;
+		item.fd = 0;
+		item.events = ZMQ_POLLIN;
+		item.revents = 0;
+		return true;
+	}
+
+	virtual void Wait(DWORD timeout)
+	{
+		zmq::pollitem_t item;
+		GetPollItem(item);
+		zmq::poll(&item, 1, timeout);
+	}
+
+private:
+	zmq::socket_t socket;
+};
+
+/// Dealer side of a shared memory channel, one channel per plugin identity
+class SharedMemoryTransport : public RouterTransport
+{
+public:
+	SharedMemoryTransport(const std::string &name)
+	{
+		if(!channel.Open(name, SharedMemoryDealer))
+			std::cout << "Shared memory channel " << name << " can not be opened" << std::endl;
+	}
+
+	virtual bool Send(const void *data, size_t size)
+	{
+		return channel.Send(data, size);
+	}
+
+	virtual bool Receive(std::string &message)
+	{
+		return channel.Receive(message);
+	}
+
+	virtual bool GetPollItem(zmq::pollitem_t&)
+	{
+		return false;
+	}
+
+	virtual void Wait(DWORD timeout)
+	{
+		channel.Wait(timeout);
+	}
+
+private:
+	SharedMemoryChannel channel;
+};
+
+RouterTransport* RouterTransport::Create(zmq::context_t &context, const std::string &address, const std::string &identity)
+{
+	if(address.compare(0, sizeof(SHARED_MEMORY_SCHEME) - 1, SHARED_MEMORY_SCHEME) == 0)
+		return new SharedMemoryTransport(address.substr(sizeof(SHARED_MEMORY_SCHEME) - 1) + "_" + identity);
+	return new ZeroMqTransport(context, address, identity);
+}
@@ -0,0 +1,31 @@
+#ifndef _ROUTER_TRANSPORT_H_
+#define _ROUTER_TRANSPORT_H_
+
+#include <string>
+#include "Platform.h"
+#include "include/zmq.hpp"
+
+/// Connection of the dealer to one router. Calls come from the dealer poll thread only
+class RouterTransport
+{
+public:
+	virtual ~RouterTransport() {}
+
+	/// Hand the message over without blocking, false when it was refused
+	virtual bool Send(const void *data, size_t size) = 0;
+
+	/// Next received message without blocking, false when there is none
+	virtual bool Receive(std::string &message) = 0;
+
+	/// ZeroMQ poll item of the transport, false when it has a wake-up of its own
+	virtual bool GetPollItem(zmq::pollitem_t &item) = 0;
+
+	/// Wait for a received message with the own wake-up, milliseconds
+	virtual void Wait(DWORD timeout) = 0;
+
+	/// Transport of the address: tcp://host:port and ipc://path are ZeroMQ sockets,
+	/// shm://name is a shared memory channel of the name and the identity
+	static RouterTransport* Create(zmq::context_t &context, const std::string &address, const std::string &identity);
+};
+
+#endif //_ROUTER_TRANSPORT_H_
@@ -0,0 +1,189 @@
+#include "SharedMemoryChannel.h"
+#include <atomic>
+#include <iostream>
+
+#define CHANNEL_MAGIC   0x4D485353 // "SSHM"
+#define CHANNEL_VERSION 1
+/// Ring data starts after the header page
+#define CHANNEL_DATA    4096
+#define CHANNEL_ALIGN   8
+/// Record length which sends the reader to the start of the ring
+#define CHANNEL_WRAP    0xFFFFFFFFu
+
+/// Ring positions, each on its own cache line. Positions count bytes and never wrap
+struct SharedMemoryChannel::Ring
+{
+	/// Written by the producer only
+	std::atomic<unsigned long long> head;
+	char                            headPadding[56];
+	/// Written by the consumer only
+	std::atomic<unsigned long long> tail;
+	char                            tailPadding[56];
+	/// Consumer is about to sleep, the producer sets the event
+	std::atomic<unsigned int>       waiting;
+	/// Futex word of the event
+	volatile unsigned int           wakeup;
+	char                            wakeupPadding[56];
+};
+
+/// Channel header at offset 0, rings follow it
+struct SharedMemoryChannel::Header
+{
+	std::atomic<unsigned int> magic;
+	unsigned int              version;
+	unsigned long long        capacity;
+	char                      padding[48];
+	Ring                      rings[2];
+};
+
+static size_t RecordSize(size_t length)
+{
+	return (sizeof(unsigned int) + length + CHANNEL_ALIGN - 1) / CHANNEL_ALIGN * CHANNEL_ALIGN;
+}
+
+SharedMemoryChannel::SharedMemoryChannel() :
+	inbound(0), outbound(1), capacity(0)
+{
+}
+
+SharedMemoryChannel::~SharedMemoryChannel()
+{
+	Close();
+}
+
+bool SharedMemoryChannel::Open(const std::string &name, int side, size_t capacity)
+{
+	Close();
+	capacity = (capacity + CHANNEL_ALIGN - 1) / CHANNEL_ALIGN * CHANNEL_ALIGN;
+	if(!memory.Open(name.c_str(), CHANNEL_DATA + 2 * capacity))
+		return false;
+
+	Header *header = GetHeader();
+	if(memory.Created())
+	{
+		//--- zeroed memory is a pair of empty rings, the magic publishes them
+		header->version = CHANNEL_VERSION;
+		header->capacity = capacity;
+		header->magic.store(CHANNEL_MAGIC, std::memory_order_release);
+	}
+	else
+	{
+		//--- the creator is a moment away from writing the header
+		for(int i = 0; i < 1000 && header->magic.load(std::memory_order_acquire) != CHANNEL_MAGIC; i++)
+			PlatformSleep(1);
+		if(header->magic.load(std::memory_order_acquire) != CHANNEL_MAGIC || header->version != CHANNEL_VERSION || header->capacity != capacity)
+		{
+			std::cout << "Shared memory " << name << " has another format" << std::endl;
+			Close();
+			return false;
+		}
+	}
+	this->capacity = capacity;
+	//--- the dealer writes ring 0 and reads ring 1
+	outbound = side == SharedMemoryDealer ? 0 : 1;
+	inbound = 1 - outbound;
+	for(int i = 0; i < 2; i++)
+		if(!events[i].Open((name + "_" + (char)('0' + i)).c_str(), &header->rings[i].wakeup))
+		{
+			Close();
+			return false;
+		}
+	//--- messages a previous reader left unread stay in the ring, the new reader takes them first
+	return true;
+}
+
+void SharedMemoryChannel::Close()
+{
+	events[0].Close();
+	events[1].Close();
+	memory.Close();
+	capacity = 0;
+}
+
+SharedMemoryChannel::Ring* SharedMemoryChannel::GetRing(int index) const
+{
+	return &GetHeader()->rings[index];
+}
+
+char* SharedMemoryChannel::RingData(int index) const
+{
+	return memory.Data() + CHANNEL_DATA + index * capacity;
+}
+
+bool SharedMemoryChannel::Send(const void *data, size_t size)
+{
+	size_t need = RecordSize(size);
+	if(!memory.IsOpen() || need > capacity / 2)
+		return false;
+	Ring *ring = GetRing(outbound);
+	char *buffer = RingData(outbound);
+	unsigned long long head = ring->head.load(std::memory_order_relaxed);
+	unsigned long long tail = ring->tail.load(std::memory_order_acquire);
+	//--- a record never wraps, the rest of the ring is skipped instead
+	size_t offset = (size_t)(head % capacity);
+	size_t skip = capacity - offset < need ? capacity - offset : 0;
+	if(head + skip + need - tail > capacity)
+		return false;
+	if(skip != 0)
+	{
+		*(unsigned int*)(buffer + offset) = CHANNEL_WRAP;
+		head += skip;
+		offset = 0;
+	}
+	*(unsigned int*)(buffer + offset) = (unsigned int)size;
+	memcpy(buffer + offset + sizeof(unsigned int), data, size);
+	ring->head.store(head + need, std::memory_order_release);
+	//--- pairs with the fence of Wait: either the reader sees the record or we see it waiting
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if(ring->waiting.load(std::memory_order_relaxed) != 0)
+		events[outbound].Set();
+	return true;
+}
+
+bool SharedMemoryChannel::Receive(std::string &message)
+{
+	if(!memory.IsOpen())
+		return false;
+	Ring *ring = GetRing(inbound);
+	const char *buffer = RingData(inbound);
+	unsigned long long tail = ring->tail.load(std::memory_order_relaxed);
+	unsigned long long head = ring->head.load(std::memory_order_acquire);
+	while(tail != head)
+	{
+		size_t offset = (size_t)(tail % capacity);
+		unsigned int length = *(const unsigned int*)(buffer + offset);
+		if(length == CHANNEL_WRAP)
+		{
+			tail += capacity - offset;
+			continue;
+		}
+		message.assign(buffer + offset + sizeof(unsigned int), length);
+		ring->tail.store(tail + RecordSize(length), std::memory_order_release);
+		return true;
+	}
+	ring->tail.store(tail, std::memory_order_release);
+	return false;
+}
+
+bool SharedMemoryChannel::Wait(DWORD timeout)
+{
+	if(!memory.IsOpen())
+	{
+		PlatformSleep(timeout);
+		return false;
+	}
+	Ring *ring = GetRing(inbound);
+	if(ring->head.load(std::memory_order_acquire) != ring->tail.load(std::memory_order_relaxed))
+		return true;
+	ring->waiting.store(1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if(ring->head.load(std::memory_order_relaxed) == ring->tail.load(std::memory_order_relaxed))
+		events[inbound].Wait(timeout);
+	ring->waiting.store(0, std::memory_order_relaxed);
+	return ring->head.load(std::memory_order_acquire) != ring->tail.load(std::memory_order_relaxed);
+}
+
+void SharedMemoryChannel::Remove(const std::string &name)
+{
+	PlatformSharedMemory::Remove(name.c_str());
+}
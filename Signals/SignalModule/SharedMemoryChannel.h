@@ -0,0 +1,64 @@
+#ifndef _SHARED_MEMORY_CHANNEL_H_
+#define _SHARED_MEMORY_CHANNEL_H_
+
+#include <string>
+#include "Platform.h"
+
+/// Side of a shared memory channel
+enum SharedMemorySide { SharedMemoryDealer = 0, SharedMemoryRouter = 1 };
+
+/// Default capacity of each ring, bytes
+#define SHARED_MEMORY_CAPACITY (1024 * 1024)
+
+/// Router connection of two processes on one host: a single-producer single-consumer ring per direction
+/// in named shared memory. A message is copied once into the ring and once out of it, no system call
+/// is made unless the reader sleeps; a sleeping reader is woken by a shared event (futex on Linux).
+/// Either side may open the channel first, messages sent while the reader was away wait in the ring.
+class SharedMemoryChannel
+{
+/// Construction / destruction
+public:
+	SharedMemoryChannel();
+	~SharedMemoryChannel();
+
+/// Public methods
+public:
+	/// Map the channel of the name, capacity is rounded up to 8 bytes
+	bool Open(const std::string &name, int side, size_t capacity = SHARED_MEMORY_CAPACITY);
+
+	void Close();
+
+	bool IsOpen() const { return memory.IsOpen(); }
+
+	/// Copy the message into the outbound ring, false when the ring has no room for it
+	bool Send(const void *data, size_t size);
+
+	/// Take the next message of the inbound ring, false when it is empty
+	bool Receive(std::string &message);
+
+	/// Wait for an inbound message, false on timeout (milliseconds)
+	bool Wait(DWORD timeout);
+
+	/// Remove the shared memory name once both sides are done
+	static void Remove(const std::string &name);
+
+///Private methods
+private:
+	struct Header;
+	struct Ring;
+
+	Header* GetHeader() const { return (Header*)memory.Data(); }
+	Ring* GetRing(int index) const;
+	char* RingData(int index) const;
+
+/// Private fields
+private:
+	PlatformSharedMemory memory;
+	/// Wake-ups of the reader of each ring
+	PlatformSharedEvent events[2];
+	int inbound;
+	int outbound;
+	size_t capacity;
+};
+
+#endif //_SHARED_MEMORY_CHANNEL_H_
@@ -0,0 +1,238 @@
+#include "SignalCodec.h"
+#include "proto/Request.pb.h"
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/wire_format_lite_inl.h>
+
+using google::protobuf::uint8;
+using google::protobuf::uint32;
+using google::protobuf::io::CodedInputStream;
+using google::protobuf::internal::WireFormatLite;
+
+/// Field numbers of Request and ExecutionSignal read by RequestLane
+#define REQUEST_TYPE_FIELD      1
+#define REQUEST_CONTENT_FIELD   3
+#define EXECUTION_ORDERS_FIELD  3
+#define ORDER_ACTION_FIELD      2
+/// Field numbers of Signal written by BuildSignal and StampSignal
+#define SIGNAL_TYPE_FIELD       1
+#define SIGNAL_CONTENT_FIELD    2
+#define SIGNAL_SOURCE_FIELD     3
+#define SIGNAL_SEQUENCE_FIELD   5
+
+/// Trade signal to proto
+void SignalCodec::MT4TradeSignalToProto(const MT4TradeSignal &tradeSignal, ProtoTypes::MT4TradeSignal &proto)
+{
+	proto.set_side(tradeSignal.Side == 
+		TradeSide::Buy ? ProtoTypes::TradeSide::Buy : ProtoTypes::TradeSide::Sell);
+	proto.set_actiontype(tradeSignal.ActionType == 
+		ActionType::Open ? ProtoTypes::ActionType::Open : ProtoTypes::ActionType::Close);
+	proto.set_datetime(tradeSignal.DateTime);
+	proto.set_equity(tradeSignal.Equity);
+	proto.set_balance(tradeSignal.Balance);
+	proto.set_volume(tradeSignal.Volume);
+	proto.set_symbol(tradeSignal.Symbol);
+	if(tradeSignal.StopLoss != 0.0)
+		proto.set_stoploss(tradeSignal.StopLoss);
+	if(tradeSignal.TakeProfit != 0.0)
+		proto.set_takeprofit(tradeSignal.TakeProfit);
+	proto.set_login(tradeSignal.Login);
+	proto.set_server(tradeSignal.Server);
+	proto.set_orderid(tradeSignal.OrderID);
+	proto.set_comment(tradeSignal.Comment);
+	proto.set_profit(tradeSignal.Profit);
+	proto.set_providercommission(tradeSignal.ProviderCommission);
+}
+
+/// Orders status response to proto
+void SignalCodec::OrdersStatusResponseToProto(const OrdersStatusResponse &response, ProtoTypes::OrdersStatusResponse &proto)
+{
+	for(int i = 0, n = response.OrdersStatus.size(); i < n; ++i)
+	{
+		const AccountOrdersStatus &account = response.OrdersStatus[i];
+		auto ordersStatus = proto.add_ordersstatus();
+		ordersStatus->set_login(account.Login);
+
+		for(int j = 0, size = account.Status.size(); j < size; j++)
+		{
+			const OrderStatus &status = account.Status[j];
+			auto orderStatus = ordersStatus->add_orderstatus();
+			orderStatus->set_orderid(status.OrderID);
+			orderStatus->set_side(status.Side == 
+				TradeSide::Buy ? ProtoTypes::TradeSide::Buy : ProtoTypes::TradeSide::Sell);
+			orderStatus->set_datetime(status.DateTime);
+			orderStatus->set_volume(status.Volume);
+			orderStatus->set_symbol(status.Symbol);
+			orderStatus->set_comment(status.Comment);
+			if(status.StopLoss != 0.0)
+				orderStatus->set_stoploss(status.StopLoss);
+			if(status.TakeProfit != 0.0)
+				orderStatus->set_takeprofit(status.TakeProfit);
+		}
+	}
+}
+
+/// Execution report to proto
+void SignalCodec::ExecutionSignalReportToProto(const ExecutionSignalReport &report, ProtoTypes::ExecutionSignalReport &proto)
+{
+	proto.set_comment(report.Comment);
+	for(int i = 0, n = report.Orders.size(); i < n; ++i)
+	{
+		const ExecutionOrderReport &order = report.Orders[i];
+		auto orderReport = proto.add_orders();
+		orderReport->set_login(order.Login);
+		orderReport->set_actiontype(order.ActionType == 
+			ActionType::Open ? ProtoTypes::ActionType::Open : ProtoTypes::ActionType::Close);
+		orderReport->set_result((ProtoTypes::ExecutionResult)order.Result);
+		if(order.OrderID != 0)
+			orderReport->set_orderid(order.OrderID);
+		if(order.Ticket != 0)
+			orderReport->set_ticket(order.Ticket);
+		if(order.Price != 0.0)
+			orderReport->set_price(order.Price);
+		if(order.RequestId != 0)
+			orderReport->set_requestid(order.RequestId);
+		orderReport->set_queuetime(order.QueueTime);
+		orderReport->set_checktime(order.CheckTime);
+		orderReport->set_executetime(order.ExecuteTime);
+	}
+}
+
+/// Execution request from proto
+void SignalCodec::ProtoToExecutionSignal(const ProtoTypes::ExecutionSignal &proto, ExecutionSignal &signal)
+{
+	signal.comment = proto.comment();
+	signal.Orders.reserve(signal.Orders.size() + proto.orders_size());
+	for(int i = 0, n = proto.orders_size(); i < n; ++i)
+	{
+		const ProtoTypes::ExecutionOrder &source = proto.orders(i);
+		ExecutionOrder order;
+		order.Login = source.login();
+		order.ActionType = 
+			source.actiontype() == ProtoTypes::ActionType::Open ? ActionType::Open : ActionType::Close;
+		order.TradeSide = source.side() == ProtoTypes::TradeSide::Buy ? TradeSide::Buy : TradeSide::Sell;
+		order.Symbol = source.symbol();
+		order.Volume = source.volume();
+		order.Commission = source.commission();
+		order.OrderID = source.has_orderid() ? source.orderid() : 0;
+		signal.Orders.push_back(order);
+	}
+}
+
+/// Serialized Signal envelope around serialized content
+void SignalCodec::BuildSignal(ProtoTypes::SignalType signalType, const std::string &source, const std::string &content, std::string &message)
+{
+	//--- fields in the order of the generated serializer, the content is copied once
+	message.resize(1 + 10 + 1 + 5 + content.size() + 1 + 5 + source.size());
+	uint8 *start = (uint8*)&message[0];
+	uint8 *target = WireFormatLite::WriteEnumToArray(SIGNAL_TYPE_FIELD, signalType, start);
+	target = WireFormatLite::WriteBytesToArray(SIGNAL_CONTENT_FIELD, content, target);
+	target = WireFormatLite::WriteStringToArray(SIGNAL_SOURCE_FIELD, source, target);
+	message.resize(target - start);
+}
+
+/// Append the SequenceId field to a serialized Signal
+void SignalCodec::StampSignal(std::string &message, unsigned long long sequenceId)
+{
+	//--- a field may follow the others on the wire, the parser takes it like a serialized one
+	uint8 buffer[1 + 10];
+	uint8 *end = WireFormatLite::WriteUInt64ToArray(SIGNAL_SEQUENCE_FIELD, sequenceId, buffer);
+	message.append((const char*)buffer, end - buffer);
+}
+
+/// Any order of the execution signal closes a position
+static bool ExecutionCloses(const void *data, int size)
+{
+	CodedInputStream input((const google::protobuf::uint8*)data, size);
+	uint32 tag;
+	while((tag = input.ReadTag()) != 0)
+	{
+		if(tag != WireFormatLite::MakeTag(EXECUTION_ORDERS_FIELD, WireFormatLite::WIRETYPE_LENGTH_DELIMITED))
+		{
+			if(!WireFormatLite::SkipField(&input, tag))
+				return false;
+			continue;
+		}
+		uint32 length;
+		if(!input.ReadVarint32(&length))
+			return false;
+		CodedInputStream::Limit limit = input.PushLimit((int)length);
+		while((tag = input.ReadTag()) != 0)
+		{
+			if(tag == WireFormatLite::MakeTag(ORDER_ACTION_FIELD, WireFormatLite::WIRETYPE_VARINT))
+			{
+				uint32 action;
+				if(!input.ReadVarint32(&action))
+					return false;
+				if(action == ProtoTypes::Close)
+					return true;
+			}
+			else if(!WireFormatLite::SkipField(&input, tag))
+				return false;
+		}
+		input.PopLimit(limit);
+	}
+	return false;
+}
+
+/// Type and content of a serialized Request, type is -1 when missing
+static void ReadRequest(const std::string &message, int &type, const void *&content, int &contentSize)
+{
+	CodedInputStream input((const google::protobuf::uint8*)message.data(), (int)message.size());
+	uint32 tag;
+	type = -1;
+	content = NULL;
+	contentSize = 0;
+	while((tag = input.ReadTag()) != 0)
+	{
+		if(tag == WireFormatLite::MakeTag(REQUEST_TYPE_FIELD, WireFormatLite::WIRETYPE_VARINT))
+		{
+			uint32 value;
+			if(!input.ReadVarint32(&value))
+				break;
+			type = (int)value;
+		}
+		else if(tag == WireFormatLite::MakeTag(REQUEST_CONTENT_FIELD, WireFormatLite::WIRETYPE_LENGTH_DELIMITED))
+		{
+			uint32 length;
+			int available;
+			if(!input.ReadVarint32(&length) || !input.GetDirectBufferPointer(&content, &available) || (int)length > available)
+			{
+				content = NULL;
+				break;
+			}
+			contentSize = (int)length;
+			input.Skip(contentSize);
+		}
+		else if(!WireFormatLite::SkipField(&input, tag))
+			break;
+	}
+}
+
+/// Type of a serialized Request
+int SignalCodec::RequestType(const std::string &message)
+{
+	int type, contentSize;
+	const void *content;
+	ReadRequest(message, type, content, contentSize);
+	return type;
+}
+
+/// Lane of a serialized Request
+int SignalCodec::RequestLane(const std::string &message)
+{
+	int type, contentSize;
+	const void *content;
+	ReadRequest(message, type, content, contentSize);
+
+	switch(type)
+	{
+		case ProtoTypes::OrderStatusRequestType:
+			return LaneStatus;
+		case ProtoTypes::ExecutionRequestType:
+			return content != NULL && ExecutionCloses(content, contentSize) ? LaneClose : LaneOpen;
+		default:
+			//--- the handler reports a malformed message
+			return LaneOpen;
+	}
+}
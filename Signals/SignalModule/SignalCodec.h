@@ -0,0 +1,42 @@
+#ifndef _SIGNAL_CODEC_H_
+#define _SIGNAL_CODEC_H_
+
+#include "ProtocolStructs.h"
+#include "MessageLanes.h"
+#include "proto/Signal.pb.h"
+#include "proto/SignalMT4Trade.pb.h"
+#include "proto/SignalOrdersStatus.pb.h"
+#include "proto/SignalExecutionReport.pb.h"
+#include "proto/RequestExecution.pb.h"
+
+/// Conversions between protocol structures and their protobuf messages
+class SignalCodec
+{
+/// Public methods
+public:
+	/// Trade signal to proto
+	static void MT4TradeSignalToProto(const MT4TradeSignal &tradeSignal, ProtoTypes::MT4TradeSignal &proto);
+
+	/// Orders status response to proto
+	static void OrdersStatusResponseToProto(const OrdersStatusResponse &response, ProtoTypes::OrdersStatusResponse &proto);
+
+	/// Execution report to proto
+	static void ExecutionSignalReportToProto(const ExecutionSignalReport &report, ProtoTypes::ExecutionSignalReport &proto);
+
+	/// Execution request from proto
+	static void ProtoToExecutionSignal(const ProtoTypes::ExecutionSignal &proto, ExecutionSignal &signal);
+
+	/// Lane of a serialized Request, read from the wire without parsing the messages
+	static int RequestLane(const std::string &message);
+
+	/// Type of a serialized Request read from the wire, -1 when it has none
+	static int RequestType(const std::string &message);
+
+	/// Serialized Signal envelope around serialized content
+	static void BuildSignal(ProtoTypes::SignalType signalType, const std::string &source, const std::string &content, std::string &message);
+
+	/// Append the SequenceId field to a serialized Signal without parsing it again
+	static void StampSignal(std::string &message, unsigned long long sequenceId);
+};
+
+#endif //_SIGNAL_CODEC_H_
@@ -0,0 +1,379 @@
+#include "SignalJournal.h"
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+#define JOURNAL_MAGIC   0x4C4E4A53 // "SJNL"
+#define JOURNAL_VERSION 2
+/// Version whose record checksums do not cover the append time, upgraded on open
+#define JOURNAL_VERSION_TIMELESS 1
+/// Records start after the header page, so a header flush never rewrites record pages
+#define JOURNAL_DATA    4096
+#define JOURNAL_ALIGN   8
+#define JOURNAL_WINDOW  (4 * 1024 * 1024)
+
+/// Checkpoint, written in place at offset 0
+struct SignalJournal::Header
+{
+	unsigned int       magic;
+	unsigned int       version;
+	unsigned long long head;
+	unsigned long long sequence;
+	unsigned long long acknowledged[2];
+};
+
+/// Record header, the message follows it. A zero length record ends the journal
+struct SignalJournal::Record
+{
+	unsigned int       length;
+	unsigned int       crc;
+	unsigned long long sequence;
+	unsigned int       direction;
+	/// Append time, seconds. Zero in records of builds which did not keep it
+	unsigned int       time;
+};
+
+/// CRC-32 tables for eight bytes per step, filled before main
+static struct Crc32Table
+{
+	unsigned int values[8][256];
+
+	Crc32Table()
+	{
+		for(unsigned int i = 0; i < 256; i++)
+		{
+			unsigned int value = i;
+			for(int bit = 0; bit < 8; bit++)
+				value = value & 1 ? 0xEDB88320 ^ (value >> 1) : value >> 1;
+			values[0][i] = value;
+		}
+		for(unsigned int i = 0; i < 256; i++)
+			for(int slice = 1; slice < 8; slice++)
+				values[slice][i] = (values[slice - 1][i] >> 8) ^ values[0][values[slice - 1][i] & 0xFF];
+	}
+} ExtCrc32Table;
+
+static unsigned int Crc32(unsigned int crc, const void *data, size_t length)
+{
+	const unsigned int (*table)[256] = ExtCrc32Table.values;
+	const unsigned char *bytes = (const unsigned char*)data;
+	crc = ~crc;
+	//--- slicing-by-8, the byte order of the reads is little-endian like every MT4 host
+	for(; length >= 8; length -= 8, bytes += 8)
+	{
+		unsigned int low = crc ^ ((unsigned int)bytes[0] | (unsigned int)bytes[1] << 8 | (unsigned int)bytes[2] << 16 | (unsigned int)bytes[3] << 24);
+		unsigned int high = (unsigned int)bytes[4] | (unsigned int)bytes[5] << 8 | (unsigned int)bytes[6] << 16 | (unsigned int)bytes[7] << 24;
+		crc = table[7][low & 0xFF] ^ table[6][(low >> 8) & 0xFF] ^ table[5][(low >> 16) & 0xFF] ^ table[4][low >> 24] ^
+			table[3][high & 0xFF] ^ table[2][(high >> 8) & 0xFF] ^ table[1][(high >> 16) & 0xFF] ^ table[0][high >> 24];
+	}
+	for(; length > 0; length--)
+		crc = table[0][(crc ^ *bytes++) & 0xFF] ^ (crc >> 8);
+	return ~crc;
+}
+
+size_t SignalJournal::RecordSize(size_t length)
+{
+	return (sizeof(Record) + length + JOURNAL_ALIGN - 1) / JOURNAL_ALIGN * JOURNAL_ALIGN;
+}
+
+unsigned int SignalJournal::RecordCrc(const Record *record, unsigned int messageCrc, bool timed)
+{
+	unsigned int crc = Crc32(messageCrc, &record->sequence, sizeof(record->sequence));
+	crc = Crc32(crc, &record->direction, sizeof(record->direction));
+	if(timed)
+		crc = Crc32(crc, &record->time, sizeof(record->time));
+	return Crc32(crc, &record->length, sizeof(record->length));
+}
+
+SignalJournal::SignalJournal() :
+	running(false), head(JOURNAL_DATA), tail(JOURNAL_DATA), dirtyFrom(JOURNAL_DATA), sequence(0), changed(false),
+	appended(0), commits(0), dropped(0)
+{
+	acknowledged[JournalInbound] = acknowledged[JournalOutbound] = 0;
+}
+
+SignalJournal::~SignalJournal()
+{
+	Close();
+}
+
+bool SignalJournal::Open(const JournalSettings &settings)
+{
+	Close();
+	if(settings.path.empty())
+		return false;
+
+	this->settings = settings;
+	size_t size = (size_t)(settings.size > 0 ? settings.size : 1) * 1024 * 1024;
+	if(!file.Open(settings.path.c_str(), size))
+	{
+		std::cout << "Journal " << settings.path << " can not be mapped" << std::endl;
+		return false;
+	}
+
+	Header *header = GetHeader();
+	if(header->magic != JOURNAL_MAGIC || (header->version != JOURNAL_VERSION && header->version != JOURNAL_VERSION_TIMELESS) ||
+		header->head < JOURNAL_DATA || header->head >= file.Size())
+	{
+		if(header->magic != 0)
+			std::cout << "Journal " << settings.path << " has unknown format, starting a new one" << std::endl;
+		ZeroMemory(header, sizeof(Header));
+		ZeroMemory(RecordAt(JOURNAL_DATA), sizeof(Record));
+		header->magic = JOURNAL_MAGIC;
+		header->version = JOURNAL_VERSION;
+		header->head = JOURNAL_DATA;
+		file.Flush(0, JOURNAL_DATA + sizeof(Record));
+	}
+	Recover();
+
+	running = true;
+	if(!committer.Start(CommitThread, this))
+		running = false;
+	return true;
+}
+
+void SignalJournal::Close()
+{
+	if(running)
+	{
+		running = false;
+		wakeup.Set();
+		committer.Join(INFINITE);
+	}
+	if(!file.IsOpen())
+		return;
+	Commit();
+	sync.Lock();
+	file.Close();
+	sync.Unlock();
+}
+
+unsigned long long SignalJournal::Append(int direction, const std::string &message)
+{
+	size_t need = RecordSize(message.size());
+	//--- the message part of the checksum does not need the lock
+	unsigned int messageCrc = Crc32(0, message.data(), message.size());
+	sync.Lock();
+	if(!file.IsOpen())
+	{
+		sync.Unlock();
+		return 0;
+	}
+	//--- records are kept in the first window while they fit, its pages stay resident and cached.
+	//--- Room for the record and the terminator behind it
+	if(tail + need + sizeof(Record) > (std::min)(file.Size(), (size_t)JOURNAL_WINDOW))
+		Compact();
+	if(tail + need + sizeof(Record) > file.Size())
+	{
+		sync.Unlock();
+		if(dropped.fetch_add(1) == 0)
+			std::cout << "Journal is full, messages are not journaled until pending ones are acknowledged" << std::endl;
+		return 0;
+	}
+
+	Record *record = RecordAt(tail);
+	record->length = (unsigned int)message.size();
+	record->sequence = ++sequence;
+	record->direction = (unsigned int)direction;
+	record->time = (unsigned int)::time(NULL);
+	memcpy(record + 1, message.data(), message.size());
+	ZeroMemory(RecordAt(tail + need), sizeof(Record));
+	//--- checksum last, a record torn by a crash fails it
+	record->crc = RecordCrc(record, messageCrc, true);
+	tail += need;
+	GetHeader()->sequence = sequence;
+	changed = true;
+	unsigned long long result = sequence;
+	size_t unflushed = tail - dirtyFrom;
+	sync.Unlock();
+
+	appended.fetch_add(1);
+	if(unflushed >= (size_t)settings.commitBytes)
+		wakeup.Set();
+	return result;
+}
+
+void SignalJournal::Acknowledge(int direction, unsigned long long sequence)
+{
+	if(sequence == 0)
+		return;
+	sync.Lock();
+	if(file.IsOpen() && sequence > acknowledged[direction])
+	{
+		acknowledged[direction] = sequence;
+		GetHeader()->acknowledged[direction] = sequence;
+		AdvanceHead();
+		changed = true;
+	}
+	sync.Unlock();
+}
+
+void SignalJournal::Replay(std::function<void(int, unsigned long long, time_t, std::string&)> func)
+{
+	struct Entry
+	{
+		int direction;
+		unsigned long long sequence;
+		time_t time;
+		std::string message;
+	};
+	std::vector<Entry> pending;
+
+	//--- copy out, the handlers append new records
+	sync.Lock();
+	for(size_t offset = head; file.IsOpen() && offset < tail; )
+	{
+		Record *record = RecordAt(offset);
+		if(record->sequence > acknowledged[record->direction])
+		{
+			Entry entry;
+			entry.direction = (int)record->direction;
+			entry.sequence = record->sequence;
+			entry.time = (time_t)record->time;
+			entry.message.assign((const char*)(record + 1), record->length);
+			pending.push_back(entry);
+		}
+		offset += RecordSize(record->length);
+	}
+	sync.Unlock();
+
+	for(size_t i = 0; i < pending.size(); i++)
+		func(pending[i].direction, pending[i].sequence, pending[i].time, pending[i].message);
+}
+
+void SignalJournal::Commit()
+{
+	sync.Lock();
+	if(!file.IsOpen() || !changed)
+	{
+		sync.Unlock();
+		return;
+	}
+	size_t from = dirtyFrom, to = tail;
+	dirtyFrom = tail;
+	changed = false;
+	sync.Unlock();
+
+	//--- flushed without the lock, appends go on meanwhile and make the next group
+	//--- the terminator is part of the flushed range
+	if(to + sizeof(Record) <= file.Size())
+		to += sizeof(Record);
+	//--- records first, a checkpoint never points at records which are not on disk
+	if(to > from)
+		file.Flush(from, to - from);
+	file.Flush(0, sizeof(Header));
+	commits.fetch_add(1);
+}
+
+size_t SignalJournal::Pending()
+{
+	size_t count = 0;
+	sync.Lock();
+	for(size_t offset = head; file.IsOpen() && offset < tail; )
+	{
+		Record *record = RecordAt(offset);
+		if(record->sequence > acknowledged[record->direction])
+			count++;
+		offset += RecordSize(record->length);
+	}
+	sync.Unlock();
+	return count;
+}
+
+DWORD PLATFORM_THREAD_CALL SignalJournal::CommitThread(LPVOID param)
+{
+	((SignalJournal*)param)->Committer();
+	return 0;
+}
+
+void SignalJournal::Committer()
+{
+	while(running)
+	{
+		wakeup.Wait((DWORD)(settings.commitInterval > 0 ? settings.commitInterval : 1));
+		Commit();
+	}
+}
+
+void SignalJournal::Recover()
+{
+	Header *header = GetHeader();
+	head = tail = (size_t)header->head;
+	sequence = header->sequence;
+	acknowledged[JournalInbound] = header->acknowledged[JournalInbound];
+	acknowledged[JournalOutbound] = header->acknowledged[JournalOutbound];
+
+	//--- valid records follow each other with consecutive sequences, anything else is a torn or stale record
+	//--- an old version journal may hold records already upgraded by a run which crashed before its checkpoint
+	bool timed = header->version != JOURNAL_VERSION_TIMELESS;
+	unsigned long long last = 0;
+	while(tail + sizeof(Record) <= file.Size())
+	{
+		Record *record = RecordAt(tail);
+		if(record->length == 0 || record->direction > JournalOutbound ||
+			tail + RecordSize(record->length) + sizeof(Record) > file.Size() ||
+			(last != 0 && record->sequence != last + 1))
+			break;
+		unsigned int messageCrc = Crc32(0, record + 1, record->length);
+		if(record->crc != RecordCrc(record, messageCrc, true) &&
+			(timed || record->crc != RecordCrc(record, messageCrc, false)))
+			break;
+		last = record->sequence;
+		tail += RecordSize(record->length);
+	}
+	if(tail + sizeof(Record) <= file.Size())
+		ZeroMemory(RecordAt(tail), sizeof(Record));
+	if(last > sequence)
+		sequence = last;
+	header->sequence = sequence;
+	dirtyFrom = tail;
+	//--- records of the old version get checksums covering their time, the committer flushes them with the new version
+	if(!timed)
+	{
+		for(size_t pos = head; pos < tail; pos += RecordSize(RecordAt(pos)->length))
+		{
+			Record *record = RecordAt(pos);
+			record->crc = RecordCrc(record, Crc32(0, record + 1, record->length), true);
+		}
+		header->version = JOURNAL_VERSION;
+		dirtyFrom = head;
+	}
+	AdvanceHead();
+	changed = true;
+}
+
+void SignalJournal::Compact()
+{
+	AdvanceHead();
+	size_t length = tail - head;
+	//--- move only over free space, the old copy stays valid until the checkpoint points at the new one
+	if(head == JOURNAL_DATA || head - JOURNAL_DATA < length)
+		return;
+	memmove(file.Data() + JOURNAL_DATA, file.Data() + head, length);
+	head = JOURNAL_DATA;
+	tail = JOURNAL_DATA + length;
+	ZeroMemory(RecordAt(tail), sizeof(Record));
+	GetHeader()->head = head;
+	dirtyFrom = JOURNAL_DATA;
+	changed = true;
+}
+
+void SignalJournal::AdvanceHead()
+{
+	while(head < tail)
+	{
+		Record *record = RecordAt(head);
+		if(record->sequence > acknowledged[record->direction])
+			break;
+		head += RecordSize(record->length);
+	}
+	if(head == tail && head != JOURNAL_DATA)
+	{
+		//--- everything is acknowledged, start over from the beginning
+		head = tail = JOURNAL_DATA;
+		ZeroMemory(RecordAt(tail), sizeof(Record));
+		if(dirtyFrom > tail)
+			dirtyFrom = tail;
+	}
+	GetHeader()->head = head;
+}
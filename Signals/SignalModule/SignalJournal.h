@@ -0,0 +1,113 @@
+#ifndef _SIGNAL_JOURNAL_H_
+#define _SIGNAL_JOURNAL_H_
+
+#include <atomic>
+#include <ctime>
+#include <functional>
+#include <string>
+#include "Platform.h"
+
+/// Direction of a journaled message
+enum JournalDirection { JournalInbound = 0, JournalOutbound = 1 };
+
+/// Journal settings, an empty path disables the journal
+struct JournalSettings
+{
+	std::string path;
+	/// File size, megabytes
+	int size;
+	/// Longest time between two flushes, milliseconds
+	int commitInterval;
+	/// Unflushed bytes which start a flush before the interval ends
+	int commitBytes;
+	/// Seconds a journaled execution request stays worth replaying, 0 replays every one
+	int replayAge;
+
+	JournalSettings() : size(64), commitInterval(10), commitBytes(256 * 1024), replayAge(0) {}
+};
+
+/// Append-only memory-mapped journal of raw router messages.
+/// Every message gets the next sequence number; a message is pending until its direction is acknowledged
+/// up to its sequence (inbound: handled, outbound: confirmed by the router).
+/// Appends only copy into the mapping. A committer thread flushes all records appended since the last
+/// flush at once, then the checkpoint header, so many appends share one disk write.
+/// The mapping outlives a crashed process, records of the last commit interval are lost only with the OS.
+class SignalJournal
+{
+/// Construction / destruction
+public:
+	SignalJournal();
+	~SignalJournal();
+
+/// Public methods
+public:
+	/// Map the journal file and recover its records, starts the committer
+	bool Open(const JournalSettings &settings);
+
+	/// Final commit and unmap
+	void Close();
+
+	/// Journal is open
+	bool IsOpen() const { return file.IsOpen(); }
+
+	/// Append a message, returns its sequence or 0 when the journal is closed or full
+	unsigned long long Append(int direction, const std::string &message);
+
+	/// Mark messages of the direction up to the sequence as done
+	void Acknowledge(int direction, unsigned long long sequence);
+
+	/// Call func for every pending message in sequence order with its append time, 0 when unknown
+	void Replay(std::function<void(int, unsigned long long, time_t, std::string&)> func);
+
+	/// Flush appended records and the checkpoint now
+	void Commit();
+
+	/// Counters
+	unsigned long long Appended() const { return appended.load(); }
+	unsigned long long Commits() const { return commits.load(); }
+	unsigned long long Dropped() const { return dropped.load(); }
+	/// Count of pending messages
+	size_t Pending();
+
+///Private methods
+private:
+	struct Header;
+	struct Record;
+
+	static size_t RecordSize(size_t length);
+	/// Checksum of the record fields chained to the checksum of its message, the time is left out for journals of version 1
+	static unsigned int RecordCrc(const Record *record, unsigned int messageCrc, bool timed);
+	static DWORD PLATFORM_THREAD_CALL CommitThread(LPVOID param);
+	void Committer();
+	void Recover();
+	void Compact();
+	/// Skip acknowledged records at the head of the journal
+	void AdvanceHead();
+	Header* GetHeader() const { return (Header*)file.Data(); }
+	Record* RecordAt(size_t offset) const { return (Record*)(file.Data() + offset); }
+
+/// Private fields
+private:
+	PlatformMappedFile file;
+	JournalSettings settings;
+	PlatformMutex sync;
+	PlatformThread committer;
+	PlatformEvent wakeup;
+	volatile bool running;
+
+	/// Offset of the first record and of the end of the last one
+	size_t head;
+	size_t tail;
+	/// Unflushed range, dirtyFrom == tail when everything is flushed
+	size_t dirtyFrom;
+	unsigned long long sequence;
+	unsigned long long acknowledged[2];
+	/// Something to flush since the last commit
+	bool changed;
+
+	std::atomic<unsigned long long> appended;
+	std::atomic<unsigned long long> commits;
+	std::atomic<unsigned long long> dropped;
+};
+
+#endif //_SIGNAL_JOURNAL_H_
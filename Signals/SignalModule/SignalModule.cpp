@@ -1,16 +1,33 @@
-#include "proto\Request.pb.h"
-#include "proto\RequestOrdersStatus.pb.h"
-#include "proto\SignalOrdersStatus.pb.h"
-#include "proto\Signal.pb.h"
-#include "proto\SignalMT4Trade.pb.h"
-#include "proto\RequestExecution.pb.h"
+#include "proto/Request.pb.h"
+#include "proto/RequestOrdersStatus.pb.h"
+#include "proto/RequestWatchedLogins.pb.h"
+#include "proto/SignalOrdersStatus.pb.h"
+#include "proto/Signal.pb.h"
+#include "proto/SignalMT4Trade.pb.h"
+#include "proto/SignalExecutionReport.pb.h"
+#include "proto/RequestExecution.pb.h"
 
 #include "SignalModule.h"
+#include "SignalCodec.h"
+#include "SignalJournal.h"
 #include "ZeroMqDealer.h"
+#include "Platform.h"
 
+/// Low bits of a sequence id counting the signals of one run
+#define SEQUENCE_COUNTER_BITS 20
+
+#include <chrono>
 #include <iostream>
 #include <thread>
 
+/// Descriptors of the message and a round trip through the serializer and the parser
+template<class Message> static void WarmUpMessage(const Message &message)
+{
+	message.GetDescriptor();
+	Message parsed;
+	parsed.ParsePartialFromString(message.SerializePartialAsString());
+}
+
 class SignalModule_pimpl
 {
 /// Public methods
@@ -22,6 +39,37 @@ public:
 		this->host = host;
 		this->port = port;
 	}
+	/// Journal settings
+	void SetJournal(std::string path, int size, int commitInterval, int replayAge)
+	{
+		journalSettings.path = path;
+		journalSettings.size = size;
+		journalSettings.commitInterval = commitInterval;
+		journalSettings.replayAge = replayAge;
+	}
+	/// Router mode and heartbeats
+	void SetRouters(int mode, int heartbeatInterval, int failoverTimeout)
+	{
+		routerMode = mode;
+		this->heartbeatInterval = heartbeatInterval;
+		this->failoverTimeout = failoverTimeout;
+	}
+	/// Router counters
+	RouterStats GetRouterStats()
+	{
+		return dealer.GetRouterStats();
+	}
+	/// Lane weights
+	void SetLaneWeights(int close, int open, int status)
+	{
+		int weights[LaneCount] = { close, open, status };
+		dealer.SetLaneWeights(weights);
+	}
+	/// Lane counters
+	LaneStats GetLaneStats(int lane)
+	{
+		return dealer.GetLaneStats(lane);
+	}
 	/// Start signal module
 	void Start()
 	{
@@ -29,6 +77,13 @@ public:
 		{
 			if (isStarted)
 				Stop();
+			//--- milliseconds of the start in the high bits, sequence ids of a later run are higher
+			sequenceId = (unsigned long long)std::chrono::duration_cast<std::chrono::milliseconds>(
+				std::chrono::system_clock::now().time_since_epoch()).count() << SEQUENCE_COUNTER_BITS;
+			//--- replay happens in Connect, handlers subscribed by now get the pending messages
+			dealer.SetJournal(journal.Open(journalSettings) ? &journal : NULL, journalSettings.replayAge);
+			dealer.SetClassifier(std::function<int(const std::string&)>(&SignalCodec::RequestLane));
+			dealer.SetFailover(routerMode, heartbeatInterval, failoverTimeout);
 			dealer.Connect(host, port, serverName);
 			dealer.Subscribe(std::function<void(std::string)>(std::bind(&SignalModule_pimpl::HandleMessage, this, std::placeholders::_1)));
 			isStarted = true;
@@ -52,6 +107,7 @@ public:
 
 				dealer.Close();
 				poller.join();
+				journal.Close();
 			}
 			//heartbeatThread.join();
 		}
@@ -87,10 +143,26 @@ public:
 				{
 					std::cout << "Error deserialize ExecutionRequest" << std::endl;
 				}
-				ExecutionSignal signal = ProtoToExecutionSignal(executionSignal);
+				ExecutionSignal signal;
+				SignalCodec::ProtoToExecutionSignal(executionSignal, signal);
+				//--- the time spent in the lane counts into the queue time of the orders
+				signal.Received = dealer.HandlingSince();
+				if(signal.Received == 0)
+					signal.Received = PlatformMicroseconds();
 				HandleExecutionRequest(signal);
 				break;
 			}
+		case ProtoTypes::RequestType::WatchedLoginsRequestType:
+			{
+				ProtoTypes::WatchedLoginsRequest watchedRequest;
+				if(!watchedRequest.ParseFromString(request.content()))
+				{
+					std::cout << "Error deserialize WatchedLoginsRequest" << std::endl;
+					break;
+				}
+				HandleWatchedLoginsRequest(watchedRequest);
+				break;
+			}
 			// Handling other messages put here
 		default:
 			break;
@@ -106,113 +178,43 @@ public:
 	{
 		executionSignalHandler = func;
 	}
+	/// Subscribe on watched logins update
+	void SubscribeOnWatchedLogins(std::function<void(std::vector<int>&)> func)
+	{
+		watchedLoginsHandler = func;
+	}
 	/// Send orders status response
 	void SendOrdersStatusResponse(OrdersStatusResponse& response)
 	{
-		ProtoTypes::OrdersStatusResponse proto = OrdersStatusResponseToProto(response);
+		ProtoTypes::OrdersStatusResponse proto;
+		SignalCodec::OrdersStatusResponseToProto(response, proto);
 		auto content = proto.SerializeAsString();
 		SendSignal(ProtoTypes::SignalOrdersStatus, content);
 	}
+	/// Send orders status response serialized by the writer
+	void SendOrdersStatusResponse(const OrdersStatusWriter &writer)
+	{
+		SendSignal(ProtoTypes::SignalOrdersStatus, writer.Content());
+	}
 	/// Send trade signal
 	void SendTradeSignal(MT4TradeSignal &tradeSignal)
 	{
-		ProtoTypes::MT4TradeSignal proto = MT4TradeSignalToProto(tradeSignal);
+		ProtoTypes::MT4TradeSignal proto;
+		SignalCodec::MT4TradeSignalToProto(tradeSignal, proto);
 		auto content = proto.SerializeAsString();
 		SendSignal(ProtoTypes::TradeSignal, content);
 	}
-///Private methods
-private:
-
-	ProtoTypes::MT4TradeSignal MT4TradeSignalToProto(MT4TradeSignal &tradeSignal)
+	/// Send execution report
+	void SendExecutionReport(ExecutionSignalReport &report)
 	{
-		ProtoTypes::MT4TradeSignal proto;
-		proto.set_side(tradeSignal.Side == 
-			TradeSide::Buy ? ProtoTypes::TradeSide::Buy : ProtoTypes::TradeSide::Sell);
-		proto.set_actiontype(tradeSignal.ActionType == 
-			ActionType::Open ? ProtoTypes::ActionType::Open : ProtoTypes::ActionType::Close);
-		proto.set_datetime(tradeSignal.DateTime);
-		proto.set_equity(tradeSignal.Equity);
-		proto.set_balance(tradeSignal.Balance);
-		proto.set_volume(tradeSignal.Volume);
-		proto.set_symbol(tradeSignal.Symbol);
-		if(tradeSignal.StopLoss != 0.0)
-			proto.set_stoploss(tradeSignal.StopLoss);
-		if(tradeSignal.TakeProfit != 0.0)
-			proto.set_takeprofit(tradeSignal.TakeProfit);
-		proto.set_login(tradeSignal.Login);
-		proto.set_server(tradeSignal.Server);
-		proto.set_orderid(tradeSignal.OrderID);
-		proto.set_comment(tradeSignal.Comment);
-		proto.set_profit(tradeSignal.Profit);
-		proto.set_providercommission(tradeSignal.ProviderCommission);
-
-		std::cout << "MT4TradeSignalToProto commission " << tradeSignal.ProviderCommission << std::endl;
-
-		return proto;
-	}
-
-	ProtoTypes::OrdersStatusResponse OrdersStatusResponseToProto(OrdersStatusResponse& response)
-	{		
-
-		ProtoTypes::OrdersStatusResponse proto;
-
-		for(int i = 0, n = response.OrdersStatus.size();  i < n; ++i)
-		{
-			auto ordersStatus = proto.add_ordersstatus();
-			ordersStatus->set_login(response.OrdersStatus[i].Login);
-			
-			int size = response.OrdersStatus[i].Status.size();
-
-			for (int j = 0; j < size; j++)
-			{				
-				auto orderStatus = ordersStatus->add_orderstatus();
-				orderStatus->set_orderid(response.OrdersStatus[i].Status[j].OrderID);
-				orderStatus->set_side(response.OrdersStatus[i].Status[j].Side == 
-					TradeSide::Buy ? ProtoTypes::TradeSide::Buy : ProtoTypes::TradeSide::Sell);
-				orderStatus->set_datetime(response.OrdersStatus[i].Status[j].DateTime);
-				orderStatus->set_volume(response.OrdersStatus[i].Status[j].Volume);
-				orderStatus->set_symbol(response.OrdersStatus[i].Status[j].Symbol);
-				orderStatus->set_comment(response.OrdersStatus[i].Status[j].Comment);
-				if(response.OrdersStatus[i].Status[j].StopLoss != 0.0)
-					orderStatus->set_stoploss(response.OrdersStatus[i].Status[j].StopLoss);
-				if(response.OrdersStatus[i].Status[j].TakeProfit != 0.0)
-					orderStatus->set_takeprofit(response.OrdersStatus[i].Status[j].TakeProfit);
-				
-			}
-		}
-
-		for (int i = 0, n = response.OrdersStatus.size(); i < n; ++i)
-		{
-			int size = response.OrdersStatus[i].Status.size();
-
-		}
-		
-		return proto;
+		ProtoTypes::ExecutionSignalReport proto;
+		SignalCodec::ExecutionSignalReportToProto(report, proto);
+		auto content = proto.SerializeAsString();
+		SendSignal(ProtoTypes::ExecutionReport, content);
 	}
+///Private methods
+private:
 
-	ExecutionSignal ProtoToExecutionSignal(ProtoTypes::ExecutionSignal signal)
-	{
-		ExecutionSignal executionSignal;
-		executionSignal.comment = signal.comment();
-		for(int i = 0, n = signal.orders_size(); i < n; ++i)
-		{
-			ExecutionOrder order;
-			order.Login = signal.orders(i).login();
-			order.ActionType = 
-				signal.orders(i).actiontype() == ProtoTypes::ActionType::Open ? ActionType::Open : ActionType::Close;
-			order.TradeSide = signal.orders(i).side() == ProtoTypes::TradeSide::Buy ? TradeSide::Buy : TradeSide::Sell;
-			order.Symbol = signal.orders(i).symbol();
-			order.Volume = signal.orders(i).volume();
-			order.Commission = signal.orders(i).commission();
-			if(signal.orders(i).has_orderid())
-			{
-				order.OrderID = signal.orders(i).orderid();
-			}
-			executionSignal.Orders.push_back(order);
-		}
-		return executionSignal;
-	}
-	
 	void PollerThread()
 	{
 		dealer.Poll();
@@ -225,20 +227,20 @@ private:
 		while (isStarted)
 		{
 			SendSignal(ProtoTypes::SignalType::ConnectSignal, mess);
-			Sleep(100);
+			PlatformSleep(100);
 		}
 		std::cout << "HeartbeatThread finished" << std::endl;
 	}
 
-	void SendSignal(ProtoTypes::SignalType signalType, std::string &content)
+	void SendSignal(ProtoTypes::SignalType signalType, const std::string &content)
 	{
-		ProtoTypes::Signal signal;
-		signal.set_type(signalType);
-		signal.set_source(serverName);
-		signal.set_content(content);
-		auto mess = signal.SerializeAsString();
-
+		std::string mess;
+		SignalCodec::BuildSignal(signalType, serverName, content, mess);
+		//--- routers drop a sequence id they had, so ids have to reach the queue in their order
+		sendLock.Lock();
+		SignalCodec::StampSignal(mess, ++sequenceId);
 		Send(mess);
+		sendLock.Unlock();
 	}
 
 	void HandleOrderStatusRequest(ProtoTypes::OrdersStatusRequest request)
@@ -253,6 +255,13 @@ private:
 			statusRequestHandler(logins);
 	}
 
+	void HandleWatchedLoginsRequest(ProtoTypes::WatchedLoginsRequest &request)
+	{
+		std::vector<int> logins(request.logins().begin(), request.logins().end());
+		if(watchedLoginsHandler)
+			watchedLoginsHandler(logins);
+	}
+
 	void HandleExecutionRequest(ExecutionSignal executionSignal)
 	{
 		if(executionSignalHandler)
@@ -268,13 +277,23 @@ private:
 private:
 	std::function<void(std::vector<int>&)> statusRequestHandler;
 	std::function<void(ExecutionSignal)> executionSignalHandler;
+	std::function<void(std::vector<int>&)> watchedLoginsHandler;
 	std::string serverName;
 	std::string host;
 	std::string port;
+	int routerMode = RouterActiveStandby;
+	int heartbeatInterval = 0;
+	int failoverTimeout = 0;
+	JournalSettings journalSettings;
+	/// Declared before the dealer which points at it
+	SignalJournal journal;
 	ZeroMqDealer dealer;
 	std::thread poller;
 	std::thread heartbeatThread;
 	bool isStarted = false;
+	/// Last sequence id of a sent signal
+	unsigned long long sequenceId = 0;
+	PlatformMutex sendLock;
 };
 
 
@@ -287,6 +306,65 @@ void SignalModule::Init(std::string host, std::string port, std::string serverNa
 	pimpl->Init(host, port, serverName);
 }
 
+/// Journal router messages
+void SignalModule::SetJournal(std::string path, int size, int commitInterval, int replayAge)
+{
+	pimpl->SetJournal(path, size, commitInterval, replayAge);
+}
+
+/// Router mode and heartbeats
+void SignalModule::SetRouters(int mode, int heartbeatInterval, int failoverTimeout)
+{
+	pimpl->SetRouters(mode, heartbeatInterval, failoverTimeout);
+}
+
+/// Router counters
+RouterStats SignalModule::GetRouterStats()
+{
+	return pimpl->GetRouterStats();
+}
+
+/// Lane weights
+void SignalModule::SetLaneWeights(int close, int open, int status)
+{
+	pimpl->SetLaneWeights(close, open, status);
+}
+
+/// Lane counters
+LaneStats SignalModule::GetLaneStats(int lane)
+{
+	return pimpl->GetLaneStats(lane);
+}
+
+/// Warm up the messages
+int SignalModule::WarmUp()
+{
+	ProtoTypes::Request request;
+	WarmUpMessage(request);
+	ProtoTypes::ExecutionSignal execution;
+	execution.add_orders();
+	WarmUpMessage(execution);
+	ExecutionSignal signal;
+	SignalCodec::ProtoToExecutionSignal(execution, signal);
+	ProtoTypes::OrdersStatusRequest status;
+	status.add_logins(0);
+	WarmUpMessage(status);
+	ProtoTypes::WatchedLoginsRequest watched;
+	watched.add_logins(0);
+	WarmUpMessage(watched);
+	ProtoTypes::Signal envelope;
+	WarmUpMessage(envelope);
+	ProtoTypes::MT4TradeSignal trade;
+	WarmUpMessage(trade);
+	ProtoTypes::OrdersStatusResponse response;
+	response.add_ordersstatus()->add_orderstatus();
+	WarmUpMessage(response);
+	ProtoTypes::ExecutionSignalReport report;
+	report.add_orders();
+	WarmUpMessage(report);
+	return 8;
+}
+
 /// Start signal module
 void SignalModule::Start()
 {
@@ -318,19 +396,34 @@ void SignalModule::SubscribeOnExecuteSignal(std::function<void(ExecutionSignal)>
 
 
 
+/// Subscribe on watched logins update
+void SignalModule::SubscribeOnWatchedLogins(std::function<void(std::vector<int>&)> func)
+{
+	pimpl->SubscribeOnWatchedLogins(func);
+}
+
 /// Send orders status response
 void SignalModule::SendOrdersStatusResponse(OrdersStatusResponse& response)
 {
 	pimpl->SendOrdersStatusResponse(response);
 }
 
+void SignalModule::SendOrdersStatusResponse(const OrdersStatusWriter &writer)
+{
+	pimpl->SendOrdersStatusResponse(writer);
+}
+
 /// Send trade signal
 void SignalModule::SendTradeSignal(MT4TradeSignal &tradeSignal)
 {
 	pimpl->SendTradeSignal(tradeSignal);
 }
 
-
+/// Send execution report
+void SignalModule::SendExecutionReport(ExecutionSignalReport &report)
+{
+	pimpl->SendExecutionReport(report);
+}
 
 
 
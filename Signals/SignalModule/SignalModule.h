@@ -1,8 +1,12 @@
 #ifndef _MESSAGE_HANDLER_H_
 #define _MESSAGE_HANDLER_H_
 #include "ProtocolStructs.h"
+#include "MessageLanes.h"
+#include "RouterMode.h"
+#include "OrdersStatusWriter.h"
 
 #include <functional>
+#include <memory>
 
 class SignalModule_pimpl;
 
@@ -15,9 +19,31 @@ public:
 /// Public methods
 public:
 
-	/// Initialize connection settings
+	/// Initialize connection settings, host is a comma separated list of routers: host[:port] where port is the default port,
+	/// tcp://host:port, ipc://path or shm://name for a router on this host
 	void Init(std::string host, std::string port, std::string serverName);
 
+	/// Router mode (RouterMode), heartbeat interval and silence after which a router is dead, milliseconds.
+	/// Applied on the next Start. Signals carry sequence ids, so routers drop the copies of hedged and failed over sends
+	void SetRouters(int mode, int heartbeatInterval, int failoverTimeout);
+
+	/// Counters of the router connection
+	RouterStats GetRouterStats();
+
+	/// Journal router messages in the file, applied on the next Start. Empty path disables the journal.
+	/// Start replays the messages a previous run had not handled or sent, execution requests only within replayAge seconds
+	void SetJournal(std::string path, int size, int commitInterval, int replayAge);
+
+	/// Messages handled from the close, open and status lanes per round
+	void SetLaneWeights(int close, int open, int status);
+
+	/// Counters of the inbound lane
+	LaneStats GetLaneStats(int lane);
+
+	/// Assign the protobuf descriptors and run every message through the serializer and the parser once,
+	/// so the first request does not pay for it. Returns the count of messages
+	static int WarmUp();
+
 	/// Start signal module
 	void Start();
 
@@ -33,12 +59,21 @@ public:
 	///Subscribe on Order status request
 	void SubscribeOnExecuteSignal(std::function<void(ExecutionSignal)> func);
 
+	/// Subscribe on watched logins update, pushed by the router
+	void SubscribeOnWatchedLogins(std::function<void(std::vector<int>&)> func);
+
 	/// Send orders status response
 	void SendOrdersStatusResponse(OrdersStatusResponse& response);
+
+	/// Send orders status response serialized by the writer
+	void SendOrdersStatusResponse(const OrdersStatusWriter &writer);
 	
 	/// Send trade signal
 	void SendTradeSignal(MT4TradeSignal &tradeSignal);
 
+	/// Send outcome of the orders of an execution signal
+	void SendExecutionReport(ExecutionSignalReport &report);
+
 private:
 	std::auto_ptr<SignalModule_pimpl> pimpl;
 	
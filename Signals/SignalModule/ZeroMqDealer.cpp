@@ -1,53 +1,146 @@
 #include <thread>
 #include <mutex>
+#include <deque>
+#include <set>
+#include <unordered_map>
+#include <vector>
 #include <iostream>
 
 #include "ZeroMqDealer.h"
-#include "proto\Signal.pb.h"
+#include "RouterTransport.h"
+#include "SignalCodec.h"
+#include "SignalJournal.h"
+#include "proto/Signal.pb.h"
+#include "Platform.h"
+
+/// Handler thread wait for a received message, milliseconds
+#define DEALER_IDLE_WAIT 10
+/// Poll thread wait for a router message when there is nothing to do, milliseconds
+#define DEALER_POLL_WAIT 1
+/// A request another router delivered within this time is a duplicate, milliseconds
+#define DEALER_DUPLICATE_WINDOW 2000
+/// Heartbeat interval and failover timeout of active/standby routers when none is set, milliseconds
+#define DEALER_STANDBY_HEARTBEAT 50
+#define DEALER_STANDBY_FAILOVER 200
 
 bool temp = false;
 
+static const int ExtDefaultLaneWeights[LaneCount] = { 8, 4, 1 };
+
 class ZeroMqDealer_pimpl // ()
 {
 	/// Construction
 public:
 	ZeroMqDealer_pimpl() :
 		context(1)
-		//, socket (context, ZMQ_DEALER)
 		, isStarted(false)
+		, waiting(NULL)
+		, mode(RouterActiveStandby)
+		, heartbeatSetting(0)
+		, failoverSetting(0)
+		, heartbeatInterval(0)
+		, failoverTimeout(0)
+		, active(0)
+		, lastInbound(0)
+		, handling(0)
+		, journal(NULL)
+		, replayAge(0)
+	{
+		SetLaneWeights(ExtDefaultLaneWeights);
+	}
+
+	~ZeroMqDealer_pimpl()
 	{
+		CloseLinks();
 	}
 
 	/// Public methods
 public:
-	/// Connect to router
+	/// Journal messages
+	void SetJournal(SignalJournal *journal, int replayAge)
+	{
+		this->journal = journal;
+		this->replayAge = replayAge;
+	}
+
+	/// Router mode and heartbeats, set before Connect
+	void SetFailover(int mode, int heartbeatInterval, int failoverTimeout)
+	{
+		this->mode = mode == RouterActiveActive ? RouterActiveActive : RouterActiveStandby;
+		heartbeatSetting = heartbeatInterval;
+		failoverSetting = failoverTimeout;
+	}
+
+	/// Connect to routers
 	void Connect(std::string host, std::string port, std::string serverName)
 	{
-		if (socket != NULL)
-			delete socket;
-		socket = new zmq::socket_t(context, ZMQ_DEALER);
-		socket->setsockopt(ZMQ_IDENTITY, serverName.c_str(), serverName.size());
-		int linger = 0;
-		socket->setsockopt(ZMQ_LINGER, &linger, sizeof(linger));
-		auto address = std::string("tcp://" + host + ":" + port);
-		socket->connect(address.c_str());
-		isStarted = true;
+		CloseLinks();
 		ProtoTypes::Signal signal;
 		signal.set_type(ProtoTypes::ConnectSignal);
 		signal.set_source(serverName);
+		signal.set_content("Heartbeat");
+		heartbeatMess = signal.SerializeAsString();
 		signal.set_content("Connect");
 		auto connectMess = signal.SerializeAsString();
-		Send(connectMess);
+
+		//--- the connect signal goes to every router before anything else, it is not journaled
+		DWORD now = PlatformTickCount();
+		std::vector<std::string> addresses = ParseRouters(host, port);
+		//--- only heartbeats tell the standby router to take over, several active/standby routers always send them
+		heartbeatInterval = heartbeatSetting;
+		failoverTimeout = failoverSetting;
+		if (heartbeatInterval <= 0 && mode == RouterActiveStandby && addresses.size() > 1)
+		{
+			heartbeatInterval = DEALER_STANDBY_HEARTBEAT;
+			if (failoverTimeout <= 0)
+				failoverTimeout = DEALER_STANDBY_FAILOVER;
+		}
+		if (failoverTimeout <= heartbeatInterval)
+			failoverTimeout = 2 * heartbeatInterval;
+		for (size_t i = 0; i < addresses.size(); i++)
+		{
+			RouterLink link;
+			link.address = addresses[i];
+			link.transport = RouterTransport::Create(context, link.address, serverName);
+			link.sent = 0;
+			//--- the router answers the connect signal like a heartbeat, the answer confirms nothing
+			if (link.transport->Send(connectMess.data(), connectMess.size()))
+				link.confirming.push_back(0);
+			link.lastSeen = link.lastHeartbeat = now;
+			//--- without heartbeats nothing tells a router is gone, every router counts as live
+			link.alive = heartbeatInterval <= 0;
+			links.push_back(link);
+			zmq::pollitem_t item;
+			if (link.transport->GetPollItem(item))
+				pollItems.push_back(item);
+			else if (waiting == NULL)
+				waiting = link.transport;
+		}
+		active = 0;
+		PublishStats();
+		isStarted = true;
+		if (journal == NULL)
+			return;
+		//--- queues are rebuilt from the journal, messages queued before it was open are journaled behind them
+		std::vector<std::string> unjournaled;
+		while (!sendingQueue.IsEmpty())
+		{
+			auto mess = sendingQueue.Pop();
+			if (Dequeue(sentSequences) == 0)
+				unjournaled.push_back(mess);
+		}
+		ClearLanes();
+		sentSequences.clear();
+		journal->Replay(std::bind(&ZeroMqDealer_pimpl::Requeue, this, std::placeholders::_1, std::placeholders::_2,
+			std::placeholders::_3, std::placeholders::_4));
+		for (size_t i = 0; i < unjournaled.size(); i++)
+			Send(unjournaled[i]);
 	}
 
-	/// Close connection
+	/// Close connection, the poll thread closes the sockets when it ends
 	void Close()
 	{
 		isStarted = false;
-		if (socket->connected())
-		{
-			socket->close();
-		}
 	}
 
 
@@ -58,37 +151,27 @@ public:
 		{
 			std::cout << "Poll started" << std::endl;
 			queueHandlingThread = std::thread(std::bind(&ZeroMqDealer_pimpl::QueueLoop, this));
-			zmq::message_t message;
+			std::string message;
 			while (isStarted)
 			{
 				try
 				{
-					bool sendingRes = false;
+					DWORD now = PlatformTickCount();
+					CheckRouters(now);
 					while (isStarted && !sendingQueue.IsEmpty())
 					{
 						auto mess = sendingQueue.Pop();
+						unsigned long long sequence = journal != NULL ? Dequeue(sentSequences) : 0;
 						if (isStarted)
 						{
-							socket->send(&mess[0], mess.size(), ZMQ_DONTWAIT);
-						}
-					}
-					if (isStarted)
-					{
-						auto res = true;
-						res = socket->recv(&message, ZMQ_DONTWAIT);
-						if (res)
-						{
-							if (message.size() != 0)
-							{
-								std::string mess((char*)message.data(), message.size());
-								receivedQueue.Push(mess);
-							}
-						}
-						else
-						{
-							Sleep(1);
+							//--- a refused message is covered by the acknowledgement of a later one.
+							//--- Without heartbeats nothing confirms a message, it is done once a socket took it
+							if (SendRouters(mess, now, sequence) && journal != NULL && heartbeatInterval <= 0)
+								journal->Acknowledge(JournalOutbound, sequence);
 						}
 					}
+					if (isStarted && !ReceiveRouters(message, now))
+						WaitRouters();
 				}
 				catch (std::exception &ex)
 				{
@@ -101,6 +184,7 @@ public:
 		{
 			std::cout << "Exception in poll: " << ex.what();
 		}
+		CloseLinks();
 	}
 
 	/// Subscribe on messages
@@ -109,26 +193,459 @@ public:
 		messageHandler = func;
 	}
 
+	/// Set lane classifier
+	void SetClassifier(std::function<int(const std::string&)> func)
+	{
+		classifier = func;
+	}
+
+	/// Set lane weights
+	void SetLaneWeights(const int weights[LaneCount])
+	{
+		laneLock.Lock();
+		for (int lane = 0; lane < LaneCount; lane++)
+		{
+			laneWeights[lane] = weights[lane] < 1 ? 1 : weights[lane];
+			laneCredits[lane] = laneWeights[lane];
+		}
+		laneLock.Unlock();
+	}
+
+	/// Receive time of the message being handled
+	unsigned long long HandlingSince()
+	{
+		return handling;
+	}
+
+	/// Counters of the lane
+	LaneStats GetLaneStats(int lane)
+	{
+		LaneStats stats;
+		if (lane < 0 || lane >= LaneCount)
+			return stats;
+		laneLock.Lock();
+		stats = laneStats[lane];
+		laneLock.Unlock();
+		return stats;
+	}
+
 	/// Send message (add to queue)
 	void Send(std::string &mess)
 	{
-		sendingQueue.Push(mess);
+		if (journal != NULL)
+			Enqueue(sendingQueue, sentSequences, mess, journal->Append(JournalOutbound, mess));
+		else
+			sendingQueue.Push(mess);
+	}
+
+	/// Counters of the router connection
+	RouterStats GetRouterStats()
+	{
+		statsLock.Lock();
+		RouterStats stats = routerStats;
+		statsLock.Unlock();
+		return stats;
 	}
 
 	/// Private methods
 private:
+	/// Connection to one router, used by the poll thread only
+	struct RouterLink
+	{
+		std::string address;
+		RouterTransport *transport;
+		/// Last message from the router and last heartbeat to it, ticks
+		DWORD lastSeen;
+		DWORD lastHeartbeat;
+		bool alive;
+		/// Journal sequence of the last message handed to the router
+		unsigned long long sent;
+		/// Sequence sent before each unanswered heartbeat, the router answers them in order
+		std::deque<unsigned long long> confirming;
+	};
+
+	/// Signal sent to the active router recently, sent again to the router taking over
+	struct RecentSignal
+	{
+		DWORD sent;
+		std::string message;
+	};
+
+	/// Router and time of a received request
+	struct SeenRequest
+	{
+		size_t router;
+		DWORD received;
+	};
+
+	/// Addresses of a comma separated list of host[:port] or scheme://address, the port defaults to port
+	static std::vector<std::string> ParseRouters(const std::string &host, const std::string &port)
+	{
+		std::vector<std::string> addresses;
+		size_t begin = 0;
+		while (begin <= host.size())
+		{
+			size_t end = host.find(',', begin);
+			if (end == std::string::npos)
+				end = host.size();
+			size_t first = host.find_first_not_of(" \t", begin);
+			size_t last = host.find_last_not_of(" \t", end - 1);
+			if (first != std::string::npos && first < end && last != std::string::npos && last >= first)
+			{
+				std::string address = host.substr(first, last - first + 1);
+				if (address.find("://") == std::string::npos)
+					address = "tcp://" + (address.find(':') == std::string::npos ? address + ":" + port : address);
+				addresses.push_back(address);
+			}
+			begin = end + 1;
+		}
+		if (addresses.empty())
+			addresses.push_back("tcp://" + host + ":" + port);
+		return addresses;
+	}
+
+	/// Send to the routers of the mode, false when no router took the message
+	bool SendRouters(std::string &mess, DWORD now, unsigned long long sequence)
+	{
+		if (links.empty())
+			return false;
+		if (mode == RouterActiveActive || links.size() == 1)
+		{
+			//--- hedged: every live router gets the signal, they drop copies by sequence id.
+			//--- While none is live the sockets queue it for whichever comes back
+			bool anyAlive = false;
+			for (size_t i = 0; i < links.size(); i++)
+				anyAlive |= links[i].alive;
+			bool sent = false;
+			for (size_t i = 0; i < links.size(); i++)
+				if ((links[i].alive || !anyAlive) && links[i].transport->Send(mess.data(), mess.size()))
+				{
+					links[i].sent = sequence != 0 ? sequence : links[i].sent;
+					sent = true;
+				}
+			return sent;
+		}
+		//--- a router which died is noticed failoverTimeout later, what it got meanwhile goes to the next one again
+		while (!recent.empty() && now - recent.front().sent > (DWORD)(2 * failoverTimeout))
+			recent.pop_front();
+		RecentSignal signal;
+		signal.sent = now;
+		signal.message = mess;
+		recent.push_back(std::move(signal));
+		if (!links[active].transport->Send(mess.data(), mess.size()))
+			return false;
+		links[active].sent = sequence != 0 ? sequence : links[active].sent;
+		return true;
+	}
+
+	/// Receive one message of every router, false when none had any
+	bool ReceiveRouters(std::string &mess, DWORD now)
+	{
+		bool received = false;
+		for (size_t i = 0; i < links.size() && isStarted; i++)
+		{
+			RouterLink &link = links[i];
+			if (!link.transport->Receive(mess))
+				continue;
+			received = true;
+			link.lastSeen = now;
+			if (!link.alive)
+			{
+				link.alive = true;
+				std::cout << "Router " << link.address << " is live" << std::endl;
+				PublishStats();
+			}
+			if (mess.empty())
+				continue;
+			//--- the answer to a heartbeat tells the router is live and got everything sent before the heartbeat
+			if (SignalCodec::RequestType(mess) == ProtoTypes::Connected)
+			{
+				if (!link.confirming.empty())
+				{
+					if (journal != NULL)
+						journal->Acknowledge(JournalOutbound, link.confirming.front());
+					link.confirming.pop_front();
+				}
+				continue;
+			}
+			if (links.size() > 1 && Duplicate(i, mess, now))
+				continue;
+			Receive(mess, journal != NULL ? journal->Append(JournalInbound, mess) : 0);
+		}
+		return received;
+	}
+
+	/// Heartbeats to the routers, a router silent for failoverTimeout is dead
+	void CheckRouters(DWORD now)
+	{
+		if (heartbeatInterval <= 0)
+			return;
+		for (size_t i = 0; i < links.size(); i++)
+		{
+			RouterLink &link = links[i];
+			if (now - link.lastHeartbeat >= (DWORD)heartbeatInterval)
+			{
+				if (link.transport->Send(heartbeatMess.data(), heartbeatMess.size()))
+					link.confirming.push_back(link.sent);
+				link.lastHeartbeat = now;
+			}
+			if (link.alive && now - link.lastSeen > (DWORD)failoverTimeout)
+			{
+				//--- answers of a dead router are not coming, later heartbeats confirm what it got
+				link.confirming.clear();
+				link.alive = false;
+				std::cout << "Router " << link.address << " missed heartbeats for " << now - link.lastSeen << " ms" << std::endl;
+				PublishStats();
+			}
+		}
+		//--- the active router keeps the signals while it is live, there is no failback.
+		//--- Right after Connect it gets failoverTimeout to answer first
+		if (mode != RouterActiveStandby || links.size() < 2 || now - links[active].lastSeen <= (DWORD)failoverTimeout)
+			return;
+		for (size_t i = 1; i < links.size(); i++)
+		{
+			size_t next = (active + i) % links.size();
+			if (links[next].alive)
+			{
+				Failover(next);
+				break;
+			}
+		}
+	}
+
+	/// Make the router active and send it the signals the previous one may have lost
+	void Failover(size_t next)
+	{
+		std::cout << "Router " << links[active].address << " failed over to " << links[next].address << std::endl;
+		active = next;
+		RouterTransport *transport = links[active].transport;
+		for (size_t i = 0; i < recent.size(); i++)
+			transport->Send(recent[i].message.data(), recent[i].message.size());
+		statsLock.Lock();
+		routerStats.failovers++;
+		routerStats.resent += recent.size();
+		statsLock.Unlock();
+		PublishStats();
+	}
+
+	/// Request delivered by another router within the duplicate window
+	bool Duplicate(size_t router, const std::string &mess, DWORD now)
+	{
+		//--- FNV-1a of the whole message
+		unsigned long long hash = 14695981039346656037ULL;
+		for (size_t i = 0; i < mess.size(); i++)
+			hash = (hash ^ (unsigned char)mess[i]) * 1099511628211ULL;
+
+		while (!seenOrder.empty() && now - seenOrder.front().second > DEALER_DUPLICATE_WINDOW)
+		{
+			auto it = seen.find(seenOrder.front().first);
+			if (it != seen.end() && it->second.received == seenOrder.front().second)
+				seen.erase(it);
+			seenOrder.pop_front();
+		}
+		auto it = seen.find(hash);
+		if (it != seen.end() && it->second.router != router)
+		{
+			statsLock.Lock();
+			routerStats.duplicates++;
+			statsLock.Unlock();
+			return true;
+		}
+		SeenRequest request;
+		request.router = router;
+		request.received = now;
+		seen[hash] = request;
+		seenOrder.push_back(std::make_pair(hash, now));
+		return false;
+	}
+
+	/// Counters after a router changed
+	void PublishStats()
+	{
+		statsLock.Lock();
+		routerStats.routers = (int)links.size();
+		routerStats.alive = 0;
+		for (size_t i = 0; i < links.size(); i++)
+			routerStats.alive += links[i].alive ? 1 : 0;
+		routerStats.active = mode == RouterActiveStandby && !links.empty() ? (int)active : -1;
+		statsLock.Unlock();
+	}
+
+	/// Wait for a router message, a transport with its own wake-up waits for all
+	void WaitRouters()
+	{
+		if (waiting != NULL)
+		{
+			//--- sockets are only polled, their messages wait for the next round at most DEALER_POLL_WAIT
+			waiting->Wait(DEALER_POLL_WAIT);
+			return;
+		}
+		if (!pollItems.empty())
+			zmq::poll(&pollItems[0], (int)pollItems.size(), DEALER_POLL_WAIT);
+	}
+
+	/// Close router connections
+	void CloseLinks()
+	{
+		for (size_t i = 0; i < links.size(); i++)
+			delete links[i].transport;
+		links.clear();
+		pollItems.clear();
+		waiting = NULL;
+		recent.clear();
+		seen.clear();
+		seenOrder.clear();
+	}
+	/// Received message waiting in a lane
+	struct InboundMessage
+	{
+		std::string message;
+		/// Journal sequence, 0 when not journaled
+		unsigned long long sequence;
+		unsigned long long enqueued;
+	};
+
+	/// Queue message together with its journal sequence, both queues keep the same order
+	void Enqueue(ConcurrentQueue &queue, std::deque<unsigned long long> &sequences, std::string &mess, unsigned long long sequence)
+	{
+		sequenceLock.Lock();
+		sequences.push_back(sequence);
+		queue.Push(mess);
+		sequenceLock.Unlock();
+	}
+
+	/// Journal sequence of the message just popped from the queue
+	unsigned long long Dequeue(std::deque<unsigned long long> &sequences)
+	{
+		unsigned long long sequence = 0;
+		sequenceLock.Lock();
+		if (!sequences.empty())
+		{
+			sequence = sequences.front();
+			sequences.pop_front();
+		}
+		sequenceLock.Unlock();
+		return sequence;
+	}
+
+	/// Queue pending journal message again, execution requests older than the replay age are dropped
+	void Requeue(int direction, unsigned long long sequence, time_t appended, std::string &mess)
+	{
+		if (direction != JournalInbound)
+		{
+			Enqueue(sendingQueue, sentSequences, mess, sequence);
+			return;
+		}
+		if (replayAge > 0 && appended != 0 && time(NULL) - appended > replayAge &&
+			SignalCodec::RequestType(mess) == ProtoTypes::ExecutionRequestType)
+		{
+			std::cout << "Journaled execution request dropped, received " << time(NULL) - appended << " s ago" << std::endl;
+			return;
+		}
+		Receive(mess, sequence);
+	}
+
+	/// Queue received message in its lane
+	void Receive(std::string &mess, unsigned long long sequence)
+	{
+		int lane = classifier ? classifier(mess) : LaneOpen;
+		if (lane < 0 || lane >= LaneCount)
+			lane = LaneOpen;
+		InboundMessage inbound;
+		inbound.message.swap(mess);
+		inbound.sequence = sequence;
+		inbound.enqueued = PlatformMicroseconds();
+
+		laneLock.Lock();
+		lanes[lane].push_back(std::move(inbound));
+		LaneStats &stats = laneStats[lane];
+		stats.depth = lanes[lane].size();
+		if (stats.depth > stats.maxDepth)
+			stats.maxDepth = stats.depth;
+		if (sequence != 0)
+		{
+			inflight.insert(sequence);
+			lastInbound = sequence;
+		}
+		laneLock.Unlock();
+		laneWakeup.Set();
+	}
+
+	/// Take the next message of the weighted lanes, false when all lanes are empty
+	bool NextInbound(InboundMessage &inbound)
+	{
+		laneLock.Lock();
+		int lane = -1;
+		//--- the first lane with messages and credit wins, credits are refilled once every waiting lane spent them
+		for (int pass = 0; pass < 2 && lane < 0; pass++)
+		{
+			for (int i = 0; i < LaneCount && lane < 0; i++)
+				if (!lanes[i].empty() && laneCredits[i] > 0)
+					lane = i;
+			if (lane < 0)
+				for (int i = 0; i < LaneCount; i++)
+					laneCredits[i] = laneWeights[i];
+		}
+		if (lane < 0)
+		{
+			laneLock.Unlock();
+			return false;
+		}
+		laneCredits[lane]--;
+		inbound = std::move(lanes[lane].front());
+		lanes[lane].pop_front();
+
+		LaneStats &stats = laneStats[lane];
+		unsigned long long wait = PlatformMicroseconds() - inbound.enqueued;
+		stats.depth = lanes[lane].size();
+		stats.handled++;
+		stats.waitTotal += wait;
+		if (wait > stats.waitMax)
+			stats.waitMax = wait;
+		laneLock.Unlock();
+		return true;
+	}
+
+	/// Journal watermark once the message is handled: every message below the oldest one still queued
+	unsigned long long Handled(unsigned long long sequence)
+	{
+		laneLock.Lock();
+		inflight.erase(sequence);
+		unsigned long long watermark = inflight.empty() ? lastInbound : *inflight.begin() - 1;
+		laneLock.Unlock();
+		return watermark;
+	}
+
+	/// Drop queued received messages
+	void ClearLanes()
+	{
+		laneLock.Lock();
+		for (int lane = 0; lane < LaneCount; lane++)
+		{
+			lanes[lane].clear();
+			laneStats[lane].depth = 0;
+		}
+		inflight.clear();
+		laneLock.Unlock();
+	}
+
 	void QueueLoop()
 	{
+		InboundMessage inbound;
 		while (isStarted)
 		{
-			if (!receivedQueue.IsEmpty())
+			if (!NextInbound(inbound))
 			{
-				auto mess = receivedQueue.Pop();
-				if (messageHandler)
-					messageHandler(mess);
+				laneWakeup.Wait(DEALER_IDLE_WAIT);
+				continue;
 			}
-			else
-				Sleep(1);
+			handling = inbound.enqueued;
+			if (messageHandler)
+				messageHandler(inbound.message);
+			handling = 0;
+			//--- handled, it is not replayed after a restart
+			if (journal != NULL && inbound.sequence != 0)
+				journal->Acknowledge(JournalInbound, Handled(inbound.sequence));
 		}
 	}
 
@@ -136,16 +653,53 @@ private:
 private:
 	/// Zero mq context
 	zmq::context_t context;
-	/// Dealer socket
-	zmq::socket_t *socket;
 	/// Is started
 	bool isStarted;
 
-	ConcurrentQueue receivedQueue;
+	/// Routers in the order of the host list
+	std::vector<RouterLink> links;
+	std::vector<zmq::pollitem_t> pollItems;
+	/// First router transport which is not a ZeroMQ socket
+	RouterTransport *waiting;
+	int mode;
+	/// Heartbeat interval and failover timeout as set, and as used with the routers of the last Connect
+	int heartbeatSetting;
+	int failoverSetting;
+	int heartbeatInterval;
+	int failoverTimeout;
+	size_t active;
+	std::string heartbeatMess;
+	std::deque<RecentSignal> recent;
+	std::unordered_map<unsigned long long, SeenRequest> seen;
+	std::deque<std::pair<unsigned long long, DWORD> > seenOrder;
+	RouterStats routerStats;
+	PlatformMutex statsLock;
+
+	std::deque<InboundMessage> lanes[LaneCount];
+	LaneStats laneStats[LaneCount];
+	int laneWeights[LaneCount];
+	int laneCredits[LaneCount];
+	PlatformMutex laneLock;
+	PlatformEvent laneWakeup;
+	std::function<int(const std::string&)> classifier;
+	/// Journal sequences of received messages queued or being handled
+	std::set<unsigned long long> inflight;
+	unsigned long long lastInbound;
+
 	ConcurrentQueue sendingQueue;
 
 	/// Message handler
 	std::function<void(std::string)> messageHandler;
+	/// Receive time of the message in the handler, 0 between messages
+	unsigned long long handling;
+
+	/// Journal, NULL when disabled
+	SignalJournal *journal;
+	/// Seconds a journaled execution request stays worth replaying, 0 replays every one
+	int replayAge;
+	/// Journal sequences of the queued messages to send, 0 for not journaled ones
+	std::deque<unsigned long long> sentSequences;
+	PlatformMutex sequenceLock;
 
 	std::thread queueHandlingThread;
 };
@@ -155,7 +709,19 @@ pimpl(new ZeroMqDealer_pimpl())
 {
 }
 
-/// Connect to router
+/// Journal messages
+void ZeroMqDealer::SetJournal(SignalJournal *journal, int replayAge)
+{
+	pimpl->SetJournal(journal, replayAge);
+}
+
+/// Router mode and heartbeats
+void ZeroMqDealer::SetFailover(int mode, int heartbeatInterval, int failoverTimeout)
+{
+	pimpl->SetFailover(mode, heartbeatInterval, failoverTimeout);
+}
+
+/// Connect to routers
 void ZeroMqDealer::Connect(std::string host, std::string port, std::string serverName)
 {
 	pimpl->Connect(host, port, serverName);
@@ -179,9 +745,38 @@ void ZeroMqDealer::Subscribe(std::function<void(std::string)> func)
 	pimpl->Subscribe(func);
 }
 
+/// Set lane classifier
+void ZeroMqDealer::SetClassifier(std::function<int(const std::string&)> func)
+{
+	pimpl->SetClassifier(func);
+}
+
+/// Set lane weights
+void ZeroMqDealer::SetLaneWeights(const int weights[LaneCount])
+{
+	pimpl->SetLaneWeights(weights);
+}
+
+/// Counters of the lane
+LaneStats ZeroMqDealer::GetLaneStats(int lane)
+{
+	return pimpl->GetLaneStats(lane);
+}
+
+/// Receive time of the message being handled
+unsigned long long ZeroMqDealer::HandlingSince()
+{
+	return pimpl->HandlingSince();
+}
+
 /// Send message (add to queue)
 void ZeroMqDealer::Send(std::string &mess)
 {
 	pimpl->Send(mess);
 }
 
+/// Counters of the router connection
+RouterStats ZeroMqDealer::GetRouterStats()
+{
+	return pimpl->GetRouterStats();
+}
@@ -1,10 +1,15 @@
 #ifndef _ZERO_MQ_DEALER_H
 #define _ZERO_MQ_DEALER_H
 
+#include <functional>
+#include <memory>
 #include "ConcurrentQueue.h"
-#include "proto\Request.pb.h"
-#include "include\zmq.hpp"
+#include "MessageLanes.h"
+#include "RouterMode.h"
+#include "proto/Request.pb.h"
+#include "include/zmq.hpp"
 class ZeroMqDealer_pimpl;
+class SignalJournal;
 
 /// Class-connection with signal router
 class ZeroMqDealer
@@ -16,7 +21,18 @@ public:
 
 	/// Public methods
 public:
-	/// Connect to router
+	/// Journal messages, set before Connect. Pending journal messages are queued again on Connect,
+	/// except execution requests journaled more than replayAge seconds ago (0 replays every one).
+	/// A sent message is acknowledged when the router answers the next heartbeat
+	void SetJournal(SignalJournal *journal, int replayAge);
+
+	/// Router mode, heartbeat interval and silence after which a router is dead (milliseconds), set before Connect.
+	/// A zero interval sends no heartbeats and every router counts as live, except with several active/standby
+	/// routers: failover needs heartbeats, they are sent every 50 ms and a router silent for 200 ms is dead
+	void SetFailover(int mode, int heartbeatInterval, int failoverTimeout);
+
+	/// Connect to routers, host is a comma separated list of host[:port] (tcp, port is the default port),
+	/// tcp://host:port, ipc://path or shm://name (shared memory channel of a router on this host)
 	void Connect(std::string host, std::string port, std::string serverName);
 
 	/// Close connection
@@ -28,9 +44,25 @@ public:
 	/// Subscribe on messages
 	void Subscribe(std::function<void(std::string)> func);
 
+	/// Set lane classifier of received messages, without it every message goes to LaneOpen
+	void SetClassifier(std::function<int(const std::string&)> func);
+
+	/// Count of messages handled from each lane per round, a lane with waiting messages gets at least one
+	void SetLaneWeights(const int weights[LaneCount]);
+
+	/// Counters of the lane
+	LaneStats GetLaneStats(int lane);
+
+	/// Receive time (PlatformMicroseconds) of the message the subscriber is handling, 0 outside of the handler.
+	/// Valid on the handler thread only
+	unsigned long long HandlingSince();
+
 	/// Send message (add to queue)
 	void Send(std::string &mess);
 
+	/// Counters of the router connection
+	RouterStats GetRouterStats();
+
 private:
 	std::auto_ptr<ZeroMqDealer_pimpl> pimpl;
 };
@@ -85,9 +85,9 @@ void protobuf_AddDesc_Request_2eproto() {
     "\n\rRequest.proto\022\nProtoTypes\"]\n\007Request\022,"
     "\n\013requestType\030\001 \002(\0162\027.ProtoTypes.Request"
     "Type\022\023\n\013destination\030\002 \002(\t\022\017\n\007Content\030\003 \001"
-    "(\014*R\n\013RequestType\022\032\n\026OrderStatusRequestT"
+    "(\014*p\n\013RequestType\022\032\n\026OrderStatusRequestT"
     "ype\020\001\022\030\n\024ExecutionRequestType\020\002\022\r\n\tConne"
-    "cted\020\003", 206);
+    "cted\020\003\022\034\n\030WatchedLoginsRequestType\020\004", 236);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "Request.proto", &protobuf_RegisterTypes);
   Request::default_instance_ = new Request();
@@ -110,6 +110,7 @@ bool RequestType_IsValid(int value) {
     case 1:
     case 2:
     case 3:
+    case 4:
       return true;
     default:
       return false;
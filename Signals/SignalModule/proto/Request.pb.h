@@ -39,11 +39,12 @@ class Request;
 enum RequestType {
   OrderStatusRequestType = 1,
   ExecutionRequestType = 2,
-  Connected = 3
+  Connected = 3,
+  WatchedLoginsRequestType = 4
 };
 bool RequestType_IsValid(int value);
 const RequestType RequestType_MIN = OrderStatusRequestType;
-const RequestType RequestType_MAX = Connected;
+const RequestType RequestType_MAX = WatchedLoginsRequestType;
 const int RequestType_ARRAYSIZE = RequestType_MAX + 1;
 
 const ::google::protobuf::EnumDescriptor* RequestType_descriptor();
@@ -35,11 +35,12 @@ void protobuf_AssignDesc_Signal_2eproto() {
       "Signal.proto");
   GOOGLE_CHECK(file != NULL);
   Signal_descriptor_ = file->message_type(0);
-  static const int Signal_offsets_[4] = {
+  static const int Signal_offsets_[5] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Signal, type_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Signal, content_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Signal, source_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Signal, description_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Signal, sequenceid_),
   };
   Signal_reflection_ =
     new ::google::protobuf::internal::GeneratedMessageReflection(
@@ -83,12 +84,13 @@ void protobuf_AddDesc_Signal_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
   ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\014Signal.proto\022\nProtoTypes\"d\n\006Signal\022$\n\004"
+    "\n\014Signal.proto\022\nProtoTypes\"x\n\006Signal\022$\n\004"
     "Type\030\001 \002(\0162\026.ProtoTypes.SignalType\022\017\n\007Co"
     "ntent\030\002 \001(\014\022\016\n\006Source\030\003 \002(\t\022\023\n\013Descripti"
-    "on\030\004 \001(\t*H\n\nSignalType\022\017\n\013TradeSignal\020\000\022"
-    "\021\n\rConnectSignal\020\001\022\026\n\022SignalOrdersStatus"
-    "\020\002", 202);
+    "on\030\004 \001(\t\022\022\n\nSequenceId\030\005 \001(\004*]\n\nSignalTy"
+    "pe\022\017\n\013TradeSignal\020\000\022\021\n\rConnectSignal\020\001\022\026"
+    "\n\022SignalOrdersStatus\020\002\022\023\n\017ExecutionRepor"
+    "t\020\003", 243);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "Signal.proto", &protobuf_RegisterTypes);
   Signal::default_instance_ = new Signal();
@@ -111,6 +113,7 @@ bool SignalType_IsValid(int value) {
     case 0:
     case 1:
     case 2:
+    case 3:
       return true;
     default:
       return false;
@@ -125,6 +128,7 @@ const int Signal::kTypeFieldNumber;
 const int Signal::kContentFieldNumber;
 const int Signal::kSourceFieldNumber;
 const int Signal::kDescriptionFieldNumber;
+const int Signal::kSequenceIdFieldNumber;
 #endif  // !_MSC_VER
 
 Signal::Signal()
@@ -147,6 +151,7 @@ void Signal::SharedCtor() {
   content_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   source_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   description_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  sequenceid_ = GOOGLE_ULONGLONG(0);
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -207,6 +212,7 @@ void Signal::Clear() {
         description_->clear();
       }
     }
+    sequenceid_ = GOOGLE_ULONGLONG(0);
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
@@ -282,6 +288,22 @@ bool Signal::MergePartialFromCodedStream(
         } else {
           goto handle_uninterpreted;
         }
+        if (input->ExpectTag(40)) goto parse_SequenceId;
+        break;
+      }
+
+      // optional uint64 SequenceId = 5;
+      case 5: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_SequenceId:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, &sequenceid_)));
+          set_has_sequenceid();
+        } else {
+          goto handle_uninterpreted;
+        }
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -334,6 +356,11 @@ void Signal::SerializeWithCachedSizes(
       4, this->description(), output);
   }
 
+  // optional uint64 SequenceId = 5;
+  if (has_sequenceid()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt64(5, this->sequenceid(), output);
+  }
+
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
@@ -375,6 +402,11 @@ void Signal::SerializeWithCachedSizes(
         4, this->description(), target);
   }
 
+  // optional uint64 SequenceId = 5;
+  if (has_sequenceid()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(5, this->sequenceid(), target);
+  }
+
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
@@ -413,6 +445,13 @@ int Signal::ByteSize() const {
           this->description());
     }
 
+    // optional uint64 SequenceId = 5;
+    if (has_sequenceid()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt64Size(
+          this->sequenceid());
+    }
+
   }
   if (!unknown_fields().empty()) {
     total_size +=
@@ -452,6 +491,9 @@ void Signal::MergeFrom(const Signal& from) {
     if (from.has_description()) {
       set_description(from.description());
     }
+    if (from.has_sequenceid()) {
+      set_sequenceid(from.sequenceid());
+    }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
@@ -480,6 +522,7 @@ void Signal::Swap(Signal* other) {
     std::swap(content_, other->content_);
     std::swap(source_, other->source_);
     std::swap(description_, other->description_);
+    std::swap(sequenceid_, other->sequenceid_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
@@ -39,11 +39,12 @@ class Signal;
 enum SignalType {
   TradeSignal = 0,
   ConnectSignal = 1,
-  SignalOrdersStatus = 2
+  SignalOrdersStatus = 2,
+  ExecutionReport = 3
 };
 bool SignalType_IsValid(int value);
 const SignalType SignalType_MIN = TradeSignal;
-const SignalType SignalType_MAX = SignalOrdersStatus;
+const SignalType SignalType_MAX = ExecutionReport;
 const int SignalType_ARRAYSIZE = SignalType_MAX + 1;
 
 const ::google::protobuf::EnumDescriptor* SignalType_descriptor();
@@ -155,6 +156,13 @@ class Signal : public ::google::protobuf::Message {
   inline ::std::string* release_description();
   inline void set_allocated_description(::std::string* description);
 
+  // optional uint64 SequenceId = 5;
+  inline bool has_sequenceid() const;
+  inline void clear_sequenceid();
+  static const int kSequenceIdFieldNumber = 5;
+  inline ::google::protobuf::uint64 sequenceid() const;
+  inline void set_sequenceid(::google::protobuf::uint64 value);
+
   // @@protoc_insertion_point(class_scope:ProtoTypes.Signal)
  private:
   inline void set_has_type();
@@ -165,16 +173,19 @@ class Signal : public ::google::protobuf::Message {
   inline void clear_has_source();
   inline void set_has_description();
   inline void clear_has_description();
+  inline void set_has_sequenceid();
+  inline void clear_has_sequenceid();
 
   ::google::protobuf::UnknownFieldSet _unknown_fields_;
 
   ::std::string* content_;
   ::std::string* source_;
   ::std::string* description_;
+  ::google::protobuf::uint64 sequenceid_;
   int type_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(5 + 31) / 32];
 
   friend void  protobuf_AddDesc_Signal_2eproto();
   friend void protobuf_AssignDesc_Signal_2eproto();
@@ -423,6 +434,28 @@ inline void Signal::set_allocated_description(::std::string* description) {
   }
 }
 
+// optional uint64 SequenceId = 5;
+inline bool Signal::has_sequenceid() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void Signal::set_has_sequenceid() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void Signal::clear_has_sequenceid() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void Signal::clear_sequenceid() {
+  sequenceid_ = GOOGLE_ULONGLONG(0);
+  clear_has_sequenceid();
+}
+inline ::google::protobuf::uint64 Signal::sequenceid() const {
+  return sequenceid_;
+}
+inline void Signal::set_sequenceid(::google::protobuf::uint64 value) {
+  set_has_sequenceid();
+  sequenceid_ = value;
+}
+
 
 // @@protoc_insertion_point(namespace_scope)
 
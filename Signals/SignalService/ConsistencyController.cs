@@ -37,6 +37,9 @@ namespace SignalService
 			this.serverController = serverController;
 
 			serverController.OrdersStatus += HandleOrderStatusResponse;
+			// A reconnected plugin may have restarted and forgotten its watched logins.
+			// Connected is raised on the receive thread, the database is not queried there
+			serverController.Connected += server => new Thread(() => PushWatchedLogins(server)).Start();
 		}
 
 		#endregion
@@ -78,8 +81,10 @@ namespace SignalService
 					var thread = new Thread(() =>
 					{
 						var typeIds = serversDictionary.Where(x => x.Value == server).Select(x => x.Key).ToList();
+						var logins = mt4Locations.Where(x => typeIds.Contains(x.AccountType)).Select(x => x.Login).ToList();
+						SendWatchedLogins(server, serversDictionary, mt4Locations);
 						var request = new OrdersStatusRequest();
-						request.logins.AddRange(mt4Locations.Where(x => typeIds.Contains(x.AccountType)).Select(x => x.Login));
+						request.logins.AddRange(logins);
 						serverController.OrdersStatusRequestsOnNext(new Tuple<string, OrdersStatusRequest>(server, request));
 						SignalService.Logger.Debug("Orders status request sended to server - {0}", server);
 					});
@@ -104,10 +109,60 @@ namespace SignalService
 			}
 		}
 
+		/// <summary>
+		/// Push provider and subscriber logins to every server, plugins send trades of these accounts only
+		/// </summary>
+		public void PushWatchedLogins()
+		{
+			PushWatchedLogins(null);
+		}
+
+		/// <summary>
+		/// Push provider and subscriber logins to the server, null pushes them to every server
+		/// </summary>
+		/// <param name="serverName">Server name</param>
+		public void PushWatchedLogins(string serverName)
+		{
+			try
+			{
+				var serversResult = accountService.GetAccountTypesWithServers();
+				if (!serversResult.IsSuccess)
+				{
+					SignalService.Logger.Error(serversResult.Error);
+					return;
+				}
+				var servers = serversResult.Result.ToDictionary(x => (int)x.AccountType, x => x.ServerName);
+				var mt4Locations = repository.GetAccountsMt4Location();
+
+				foreach (var server in servers.Values.Distinct())
+				{
+					if (serverName == null || server == serverName)
+						SendWatchedLogins(server, servers, mt4Locations);
+				}
+			}
+			catch (Exception e)
+			{
+				SignalService.Logger.Error("Watched logins push exception: {0}", e.ToString());
+			}
+		}
+
 		#endregion
 
 		#region Private methods
 
+		/// <summary>
+		/// Subscribers are watched with providers, closes of provider orders find the subscriber orders from their trades
+		/// </summary>
+		private void SendWatchedLogins(string server, Dictionary<int, string> servers, Mt4AccountLocation[] mt4Locations)
+		{
+			var watched = new WatchedLoginsRequest();
+			watched.logins.AddRange(mt4Locations
+				.Where(x => servers.ContainsKey(x.AccountType) && servers[x.AccountType] == server)
+				.Select(x => x.Login)
+				.Distinct());
+			serverController.WatchedLoginsRequestsOnNext(new Tuple<string, WatchedLoginsRequest>(server, watched));
+		}
+
 		private void HandleOrderStatusResponse(Tuple<string, OrdersStatusResponse> tuple)
 		{
 			SignalService.Logger.Debug("Orsers status response come from {0}", tuple.Item1);
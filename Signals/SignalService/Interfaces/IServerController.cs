@@ -27,6 +27,16 @@ namespace SignalService.Interfaces
 		/// </summary>
 		event Action<Tuple<string, OrdersStatusResponse>> OrdersStatus;
 
+		/// <summary>
+		/// Observable of servers whose plugin (re)connected
+		/// </summary>
+		event Action<string> Connected;
+
+		/// <summary>
+		/// Observable of outcomes of the orders of execution signals
+		/// </summary>
+		event Action<Tuple<string, ExecutionSignalReport>> ExecutionReports;
+
 		/// <summary>
 		/// Observer of signals
 		/// </summary>
@@ -41,5 +51,10 @@ namespace SignalService.Interfaces
 		/// Observer of orders status 
 		/// </summary>
 		void OrdersStatusRequestsOnNext(Tuple<string, OrdersStatusRequest> request);
+
+		/// <summary>
+		/// Observer of watched logins, only trades of these accounts are sent by the server
+		/// </summary>
+		void WatchedLoginsRequestsOnNext(Tuple<string, WatchedLoginsRequest> request);
 	}
 }
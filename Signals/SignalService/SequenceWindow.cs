@@ -0,0 +1,39 @@
+﻿using System.Collections.Generic;
+
+namespace SignalService
+{
+	/// <summary>
+	/// Sequence ids of the last trade signals of one server, the oldest id is forgotten when the window is full
+	/// </summary>
+	public class SequenceWindow
+	{
+		#region Fields
+
+		/// <summary>
+		/// Ids kept, copies of a signal come within a failover timeout of it
+		/// </summary>
+		private const int Capacity = 65536;
+
+		private readonly HashSet<ulong> ids = new HashSet<ulong>();
+		private readonly Queue<ulong> order = new Queue<ulong>();
+
+		#endregion
+
+		#region Public methods
+
+		/// <summary>
+		/// Remember the id, false when it is in the window already
+		/// </summary>
+		public bool Add(ulong id)
+		{
+			if (!ids.Add(id))
+				return false;
+			order.Enqueue(id);
+			if (order.Count > Capacity)
+				ids.Remove(order.Dequeue());
+			return true;
+		}
+
+		#endregion
+	}
+}
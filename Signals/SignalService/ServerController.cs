@@ -1,4 +1,5 @@
 ﻿using System;
+using System.Collections.Generic;
 using SignalService.Interfaces;
 using ProtoTypes;
 
@@ -8,6 +9,12 @@ namespace SignalService
 	{
 		#region Fields
 
+		/// <summary>
+		/// Trade signal sequence ids of every server seen lately, copies of hedged and failed over sends repeat one of them.
+		/// Only a repeated id is dropped: ids of a restarted plugin or of a plugin whose clock stepped back may be lower
+		/// </summary>
+		private readonly Dictionary<string, SequenceWindow> seenSequences = new Dictionary<string, SequenceWindow>();
+
 		#endregion
 
 		#region Construction
@@ -39,9 +46,16 @@ namespace SignalService
 
 		public event Action<Tuple<string, OrdersStatusResponse>> OrdersStatus;
 
+		public event Action<string> Connected;
+
+		public event Action<Tuple<string, ExecutionSignalReport>> ExecutionReports;
+
 		public void SignalOnNext(Tuple<string, Signal> signal)
 		{
 			var source = signal.Item1;
+			// A repeated trade signal would be copied twice, the other signals are harmless to handle again
+			if (signal.Item2.Type == SignalType.TradeSignal && IsDuplicate(source, signal.Item2))
+				return;
 			switch (signal.Item2.Type)
 			{
 				case SignalType.TradeSignal:
@@ -54,14 +68,38 @@ namespace SignalService
 					if (OrdersStatus != null)
 						OrdersStatus(new Tuple<string, OrdersStatusResponse>(source, stats));
 					break;
+				case SignalType.ExecutionReport:
+					var report = ProtoExtension.DeSerialize<ExecutionSignalReport>(signal.Item2.Content);
+					if (ExecutionReports != null)
+						ExecutionReports(new Tuple<string, ExecutionSignalReport>(source, report));
+					break;
 				case SignalType.ConnectSignal:
 					SignalService.Logger.Info("Connect signal received");
+					if (Connected != null)
+						Connected(source);
 					break;
 				default:
 					throw new ArgumentOutOfRangeException();
 			}
 		}
 
+		private bool IsDuplicate(string source, Signal signal)
+		{
+			// Signals of plugins without sequence ids are never dropped
+			if (signal.SequenceId == 0)
+				return false;
+			lock (seenSequences)
+			{
+				SequenceWindow window;
+				if (!seenSequences.TryGetValue(source, out window))
+				{
+					window = new SequenceWindow();
+					seenSequences.Add(source, window);
+				}
+				return !window.Add(signal.SequenceId);
+			}
+		}
+
 		public void ExecutionSignalOnNext(Tuple<string, ExecutionSignal> tuple)
 		{
 			var signal = new Request
@@ -86,6 +124,18 @@ namespace SignalService
 				RequestSignals(new Tuple<string, Request>(request.Item1, signal));
 		}
 
+		public void WatchedLoginsRequestsOnNext(Tuple<string, WatchedLoginsRequest> request)
+		{
+			var signal = new Request
+			{
+				destination = request.Item1,
+				requestType = RequestType.WatchedLoginsRequestType,
+				Content = request.Item2.Serialize()
+			};
+			if (RequestSignals != null)
+				RequestSignals(new Tuple<string, Request>(request.Item1, signal));
+		}
+
 		#endregion
 
 	}
@@ -27,6 +27,7 @@ namespace SignalService
 		public static Logger Logger = LogManager.GetCurrentClassLogger();
 		private readonly Dictionary<long, DateTime?> clientsLastUpdate = new Dictionary<long, DateTime?>();
 		private readonly IZeroMqServer server;
+		private ConsistencyController consistencyController;
 
 		private const int consistencyControlInterval = 60 * 5; // Interval in seconds
 
@@ -66,11 +67,12 @@ namespace SignalService
 			server.Signals += LogSignal;
 			//serverController.TradeSignals += LogTradeSignal;
 			tradeSignalProcessor.ExecutionSignals += LogExecutionSignal;
+			serverController.ExecutionReports += LogExecutionReport;
 			serverController.RequestSignals += server.Request;
 
 			server.Start();
 
-			var consistencyController = new ConsistencyController(signalServiceRepository, serverController, accService);
+			consistencyController = new ConsistencyController(signalServiceRepository, serverController, accService);
 
 			Observable.Timer(TimeSpan.FromSeconds(5), TimeSpan.FromSeconds(consistencyControlInterval))
 				.Subscribe(l =>
@@ -107,6 +109,10 @@ namespace SignalService
 					commission);
 
 				Logger.Trace("Provider added (account {0})", accountId);
+
+				// Trades of a new account are dropped by the plugin until it watches the login
+				if (consistencyController != null)
+					consistencyController.PushWatchedLogins();
 			});
 		}
 
@@ -120,6 +126,9 @@ namespace SignalService
 				signalServiceRepository.DeleteProvider(accountId);
 
 				Logger.Trace("Provider removed (account {0})", accountId);
+
+				if (consistencyController != null)
+					consistencyController.PushWatchedLogins();
 			});
 		}
 
@@ -133,6 +142,9 @@ namespace SignalService
 				signalServiceRepository.DeleteSubscriber(accountId);
 
 				Logger.Trace("Subscriber removed (account {0})", accountId);
+
+				if (consistencyController != null)
+					consistencyController.PushWatchedLogins();
 			});
 		}
 
@@ -170,6 +182,9 @@ namespace SignalService
 
 				signalServiceRepository.SignalSubscription((short)SubscriptionStatus.On, slaveId, masterId, settings,
 					accountInformation.Result);
+
+				if (consistencyController != null)
+					consistencyController.PushWatchedLogins();
 			});
 		}
 
@@ -190,6 +205,9 @@ namespace SignalService
 
 				signalServiceRepository.SignalSubscription((short)SubscriptionStatus.On, slaveId, masterNickname, settings,
 					accountInformation.Result);
+
+				if (consistencyController != null)
+					consistencyController.PushWatchedLogins();
 			});
 		}
 
@@ -692,6 +710,29 @@ namespace SignalService
 			Logger.Info(builder.ToString());
 		}
 
+		private static void LogExecutionReport(Tuple<string, ExecutionSignalReport> tuple)
+		{
+			var report = tuple.Item2;
+			var failed = report.Orders.Where(x => x.Result != ExecutionResult.ResultExecuted && x.Result != ExecutionResult.ResultRequestAdded).ToList();
+			if (failed.Count == 0)
+			{
+				Logger.Debug("Execution report from {0}, comment - {1}, orders - {2}", tuple.Item1, report.Comment, report.Orders.Count);
+				return;
+			}
+
+			var builder = new StringBuilder();
+			builder.AppendLine("Execution report");
+			builder.AppendLine(String.Format("From: {0}", tuple.Item1));
+			builder.AppendLine(String.Format("Comment: {0}", report.Comment));
+			builder.AppendLine(String.Format("Orders count: {0}, failed: {1}", report.Orders.Count, failed.Count));
+			foreach (var order in failed)
+			{
+				builder.AppendLine(String.Format("Order: login - {0}, action - {1}, id - {2}, result - {3}, check us - {4}, execute us - {5}",
+					order.Login, order.ActionType, order.OrderID, order.Result, order.CheckTime, order.ExecuteTime));
+			}
+			Logger.Error(builder.ToString());
+		}
+
 		private static void LogTradeSignal(Tuple<string, MT4TradeSignal> tuple)
 		{
 			var builder = new StringBuilder();
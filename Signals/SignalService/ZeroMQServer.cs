@@ -158,8 +158,13 @@ namespace SignalService
 				{
 					if (signal.Type == SignalType.ConnectSignal)
 					{
-						SignalService.Logger.Info("Connect message from client {0} ", clientId);
-						SendConnectedMessage(socket, clientId);
+						// Plugins send heartbeats as connect signals, the answer tells them the router is live
+						var heartbeat = signal.Content != null && Encoding.UTF8.GetString(signal.Content) == "Heartbeat";
+						if (!heartbeat)
+							SignalService.Logger.Info("Connect message from client {0} ", clientId);
+						SendConnectedMessage(socket, clientId, heartbeat);
+						if (heartbeat)
+							return;
 					}
 					if (Signals != null)
 						Signals((new Tuple<string, Signal>(clientId, signal)));
@@ -171,7 +176,7 @@ namespace SignalService
 			}
 		}
 
-		private void SendConnectedMessage(NetMQSocket socket, string clientId)
+		private void SendConnectedMessage(NetMQSocket socket, string clientId, bool heartbeat)
 		{
 			var connected = new Request { requestType = RequestType.Connected, destination = clientId };
 			var data = connected.Serialize();
@@ -179,7 +184,8 @@ namespace SignalService
 
 			router.SendMore(id);
 			router.Send(data);
-			SignalService.Logger.Info("Connected message sended to client {0}", clientId);
+			if (!heartbeat)
+				SignalService.Logger.Info("Connected message sended to client {0}", clientId);
 		}
 
 		#endregion